@@ -44,6 +44,7 @@ list(APPEND MAIN_SOURCE_FILES
   external/resinsight/CommonCode/cvfStructGrid.cpp
   external/resinsight/cafPdmCore/cafSignal.cpp
   external/resinsight/cafHexGridIntersectionTools/cafHexGridIntersectionTools.cpp
+  opm/common/OpmLog/AsyncLogBackend.cpp
   opm/common/OpmLog/CounterLog.cpp
   opm/common/OpmLog/EclipsePRTLog.cpp
   opm/common/OpmLog/LogBackend.cpp
@@ -59,6 +60,8 @@ list(APPEND MAIN_SOURCE_FILES
   opm/common/utility/FileSystem.cpp
   opm/common/utility/MemPacker.cpp
   opm/common/utility/OpmInputError.cpp
+  opm/common/utility/Profiler.cpp
+  opm/common/utility/Revision.cpp
   opm/common/utility/shmatch.cpp
   opm/common/utility/String.cpp
   opm/common/utility/SymmTensor.cpp
@@ -173,6 +176,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/EclipseState/Tables/BrineDensityTable.cpp
   opm/input/eclipse/EclipseState/Tables/SolventDensityTable.cpp
   opm/input/eclipse/EclipseState/Tables/Tabdims.cpp
+  opm/input/eclipse/Parser/BuiltinKeywordIndex.cpp
   opm/input/eclipse/Parser/ErrorGuard.cpp
   opm/input/eclipse/Parser/InputErrorAction.cpp
   opm/input/eclipse/Parser/ParseContext.cpp
@@ -228,6 +232,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/Schedule/Action/ActionValue.cpp
   opm/input/eclipse/Schedule/Action/ASTNode.cpp
   opm/input/eclipse/Schedule/Action/Condition.cpp
+  opm/input/eclipse/Schedule/Action/CompiledCondition.cpp
   opm/input/eclipse/Schedule/Action/Enums.cpp
   opm/input/eclipse/Schedule/Action/PyAction.cpp
   opm/input/eclipse/Schedule/Action/State.cpp
@@ -272,10 +277,12 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/Schedule/UDQ/UDQActive.cpp
   opm/input/eclipse/Schedule/UDQ/UDQAssign.cpp
   opm/input/eclipse/Schedule/UDQ/UDQASTNode.cpp
+  opm/input/eclipse/Schedule/UDQ/UDQCompiledDefine.cpp
   opm/input/eclipse/Schedule/UDQ/UDQConfig.cpp
   opm/input/eclipse/Schedule/UDQ/UDQContext.cpp
   opm/input/eclipse/Schedule/UDQ/UDQDefine.cpp
   opm/input/eclipse/Schedule/UDQ/UDQEnums.cpp
+  opm/input/eclipse/Schedule/UDQ/UDQEvalPlan.cpp
   opm/input/eclipse/Schedule/UDQ/UDQFunction.cpp
   opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.cpp
   opm/input/eclipse/Schedule/UDQ/UDQInput.cpp
@@ -332,6 +339,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/io/eclipse/ERft.cpp
   opm/io/eclipse/ERst.cpp
   opm/io/eclipse/ERsm.cpp
+  opm/io/eclipse/EnsembleSummary.cpp
   opm/io/eclipse/ESmry.cpp
   opm/io/eclipse/ExtESmry.cpp
   opm/io/eclipse/ESmry_write_rsm.cpp
@@ -370,6 +378,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/material/fluidsystems/PhaseUsageInfo.cpp
   opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.cpp
   opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.cpp
+  opm/material/fluidsystems/blackoilpvt/Co2BrineTabulation.cpp
   opm/material/fluidsystems/blackoilpvt/Co2GasPvt.cpp
   opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityBrinePvt.cpp
   opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityOilPvt.cpp
@@ -515,9 +524,11 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_EclIO.cpp
   tests/test_EGrid.cpp
   tests/test_EInit.cpp
+  tests/test_EModel.cpp
   tests/test_ERft.cpp
   tests/test_ERsm.cpp
   tests/test_ERst.cpp
+  tests/test_EnsembleSummary.cpp
   tests/test_ESmry.cpp
   tests/test_ExtESmry.cpp
   tests/test_FastSmallVector.cpp
@@ -541,6 +552,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_param.cpp
   tests/test_PAvgCalculator.cpp
   tests/test_PAvgDynamicSourceData.cpp
+  tests/test_Profiler.cpp
   tests/test_regionCache.cpp
   tests/test_RegionSetMatcher.cpp
   tests/test_Restart.cpp
@@ -574,6 +586,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_WindowedArray.cpp
   tests/material/test_2dtables.cpp
   tests/material/test_eclmateriallawmanager.cpp
+  tests/material/test_evaluationblock.cpp
   tests/material/test_hysteresis.cpp
   tests/material/test_spline.cpp
   tests/ml/test_ml_model.cpp
@@ -583,6 +596,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/parser/AquiferTests.cpp
   tests/parser/BCConfigTests.cpp
   tests/parser/BoxTests.cpp
+  tests/parser/BuiltinKeywordIndexTests.cpp
   tests/parser/CarfinTests.cpp
   tests/parser/ColumnSchemaTests.cpp
   tests/parser/ConnectionTests.cpp
@@ -852,6 +866,23 @@ list(APPEND EXAMPLE_SOURCE_FILES
   examples/networkgraph.cpp
 )
 
+# sources of the opm-benchmarks program, which is only built if the
+# OPM_ENABLE_BENCHMARKS option is set
+list(APPEND BENCHMARK_SOURCE_FILES
+  benchmarks/Benchmark.cpp
+  benchmarks/densead_simd.cpp
+  benchmarks/opm_benchmarks.cpp
+  benchmarks/parser_startup.cpp
+  benchmarks/pvt_batch.cpp
+  benchmarks/tabulation.cpp
+)
+
+if(dune-common_FOUND)
+  list(APPEND BENCHMARK_SOURCE_FILES
+    benchmarks/ptflash_batch.cpp
+  )
+endif()
+
 # programs listed here will not only be compiled, but also marked for
 # installation
 list(APPEND PROGRAM_SOURCE_FILES
@@ -869,6 +900,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/common/CriticalError.hpp
   opm/common/ErrorMacros.hpp
   opm/common/Exceptions.hpp
+  opm/common/OpmLog/AsyncLogBackend.hpp
   opm/common/OpmLog/CounterLog.hpp
   opm/common/OpmLog/EclipsePRTLog.hpp
   opm/common/OpmLog/InfoLogger.hpp
@@ -890,6 +922,8 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/common/utility/FileSystem.hpp
   opm/common/utility/MemPacker.hpp
   opm/common/utility/OpmInputError.hpp
+  opm/common/utility/Profiler.hpp
+  opm/common/utility/Revision.hpp
   opm/common/utility/Serializer.hpp
   opm/common/utility/String.hpp
   opm/common/utility/SymmTensor.hpp
@@ -1097,6 +1131,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/EclipseState/checkDeck.hpp
   opm/input/eclipse/Generator/KeywordGenerator.hpp
   opm/input/eclipse/Generator/KeywordLoader.hpp
+  opm/input/eclipse/Parser/BuiltinKeywordIndex.hpp
   opm/input/eclipse/Parser/ErrorGuard.hpp
   opm/input/eclipse/Parser/InputErrorAction.hpp
   opm/input/eclipse/Parser/ParseContext.hpp
@@ -1115,6 +1150,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/Schedule/Action/ActionValue.hpp
   opm/input/eclipse/Schedule/Action/ActionX.hpp
   opm/input/eclipse/Schedule/Action/Actions.hpp
+  opm/input/eclipse/Schedule/Action/CompiledCondition.hpp
   opm/input/eclipse/Schedule/Action/Condition.hpp
   opm/input/eclipse/Schedule/Action/Enums.hpp
   opm/input/eclipse/Schedule/Action/PyAction.hpp
@@ -1179,10 +1215,12 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp
   opm/input/eclipse/Schedule/UDQ/UDQActive.hpp
   opm/input/eclipse/Schedule/UDQ/UDQAssign.hpp
+  opm/input/eclipse/Schedule/UDQ/UDQCompiledDefine.hpp
   opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp
   opm/input/eclipse/Schedule/UDQ/UDQContext.hpp
   opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp
   opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp
+  opm/input/eclipse/Schedule/UDQ/UDQEvalPlan.hpp
   opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp
   opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp
   opm/input/eclipse/Schedule/UDQ/UDQInput.hpp
@@ -1234,6 +1272,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/io/eclipse/ERft.hpp
   opm/io/eclipse/ERsm.hpp
   opm/io/eclipse/ERst.hpp
+  opm/io/eclipse/EnsembleSummary.hpp
   opm/io/eclipse/ESmry.hpp
   opm/io/eclipse/EclFile.hpp
   opm/io/eclipse/EclIOdata.hpp
@@ -1281,6 +1320,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/common/Means.hpp
   opm/material/common/PolynomialUtils.hpp
   opm/material/common/ResetLocale.hpp
+  opm/material/common/SegmentLookup.hpp
   opm/material/common/Spline.hpp
   opm/material/common/Tabulated1DFunction.hpp
   opm/material/common/TridiagonalMatrix.hpp
@@ -1319,6 +1359,8 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/constraintsolvers/MiscibleMultiPhaseComposition.hpp
   opm/material/constraintsolvers/NcpFlash.hpp
   opm/material/constraintsolvers/PTFlash.hpp
+  opm/material/constraintsolvers/PTFlashBatch.hpp
+  opm/material/constraintsolvers/PTFlashStabilityCache.hpp
   opm/material/densead/DynamicEvaluation.hpp
   opm/material/densead/Evaluation.hpp
   opm/material/densead/Evaluation1.hpp
@@ -1333,7 +1375,9 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/densead/Evaluation7.hpp
   opm/material/densead/Evaluation8.hpp
   opm/material/densead/Evaluation9.hpp
+  opm/material/densead/EvaluationBlock.hpp
   opm/material/densead/EvaluationFormat.hpp
+  opm/material/densead/EvaluationSimd.hpp
   opm/material/densead/EvaluationSpecializations.hpp
   opm/material/densead/Math.hpp
   opm/material/eos/CubicEOS.hpp
@@ -1440,6 +1484,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/fluidsystems/TwoPhaseImmiscibleFluidSystem.hpp
   opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp
   opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp
+  opm/material/fluidsystems/blackoilpvt/Co2BrineTabulation.hpp
   opm/material/fluidsystems/blackoilpvt/Co2GasPvt.hpp
   opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityBrinePvt.hpp
   opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityOilPvt.hpp
@@ -1455,6 +1500,8 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/fluidsystems/blackoilpvt/NullOilPvt.hpp
   opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp
   opm/material/fluidsystems/blackoilpvt/OilPvtThermal.hpp
+  opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp
+  opm/material/fluidsystems/blackoilpvt/PvtValues.hpp
   opm/material/fluidsystems/blackoilpvt/SolventPvt.hpp
   opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp
   opm/material/fluidsystems/blackoilpvt/WaterPvtThermal.hpp
@@ -15,6 +15,7 @@ opm_add_executable(
     opm/input/eclipse/Generator/KeywordGenerator.cpp
     opm/input/eclipse/Generator/KeywordLoader.cpp
     opm/input/eclipse/Schedule/UDQ/UDQEnums.cpp
+    opm/input/eclipse/Parser/BuiltinKeywordIndex.cpp
     opm/input/eclipse/Parser/createDefaultKeywordList.cpp
     opm/input/eclipse/Parser/ErrorGuard.cpp
     opm/input/eclipse/Parser/ParseContext.cpp
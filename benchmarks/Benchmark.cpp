@@ -0,0 +1,66 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Benchmark.hpp"
+
+#include <iomanip>
+#include <ostream>
+
+namespace {
+
+constexpr int caseWidth = 32;
+constexpr int valueWidth = 14;
+
+} // Anonymous namespace
+
+std::size_t Opm::Benchmark::argument(const Arguments& args,
+                                     const std::size_t i,
+                                     const std::size_t fallback)
+{
+    return (i < args.size()) ? std::stoul(args[i]) : fallback;
+}
+
+Opm::Benchmark::Table::Table(std::ostream& os,
+                             const std::string& caseHeading,
+                             const std::vector<std::string>& columnHeadings)
+    : os_ { os }
+{
+    this->os_ << '\n' << std::left << std::setw(caseWidth) << caseHeading << std::right;
+    for (const auto& heading : columnHeadings) {
+        this->os_ << std::setw(valueWidth) << heading;
+    }
+    this->os_ << '\n';
+}
+
+void Opm::Benchmark::Table::row(const std::string& what, const std::vector<double>& values)
+{
+    this->os_ << std::left << std::setw(caseWidth) << what << std::right
+              << std::setprecision(4) << std::defaultfloat;
+    for (const auto& value : values) {
+        this->os_ << std::setw(valueWidth) << value;
+    }
+    this->os_ << std::endl;
+}
+
+void Opm::Benchmark::Table::comparison(const std::string& what,
+                                       const double reference,
+                                       const double candidate)
+{
+    this->row(what, { reference, candidate, reference / candidate });
+}
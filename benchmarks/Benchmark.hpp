@@ -0,0 +1,96 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*!
+ * \file
+ *
+ * \brief Timing and reporting helpers shared by the benchmarks of the
+ *        opm-benchmarks program.
+ */
+#ifndef OPM_BENCHMARK_HPP
+#define OPM_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace Opm::Benchmark {
+
+/// Command line arguments of a single benchmark, i.e., those following
+/// the benchmark's name.
+using Arguments = std::vector<std::string>;
+
+/// Numeric command line argument.
+///
+/// \param[in] args Command line arguments of benchmark.
+/// \param[in] i Position of argument.
+/// \param[in] fallback Value if argument is not given.
+std::size_t argument(const Arguments& args, std::size_t i, std::size_t fallback);
+
+/// Average wall-clock time, in seconds, of a function call.
+///
+/// \param[in] numRepetitions Number of times to call function.
+/// \param[in] function Function to time.  No arguments.
+template <class Function>
+double timeIt(const int numRepetitions, Function&& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < numRepetitions; ++rep) {
+        function();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(stop - start).count() / numRepetitions;
+}
+
+/// Table of measurements, one row per case, written as the rows are added.
+class Table
+{
+public:
+    /// Constructor.  Writes the table heading.
+    ///
+    /// \param[in,out] os Output stream.
+    /// \param[in] caseHeading Heading of the case column.
+    /// \param[in] columnHeadings Headings of the value columns.
+    Table(std::ostream& os,
+          const std::string& caseHeading,
+          const std::vector<std::string>& columnHeadings);
+
+    /// Write row of values.
+    void row(const std::string& what, const std::vector<double>& values);
+
+    /// Write row comparing the times of a reference and a candidate
+    /// implementation, followed by the speed-up of the candidate.
+    void comparison(const std::string& what, double reference, double candidate);
+
+private:
+    std::ostream& os_;
+};
+
+/// Benchmarks.  Each returns the exit status of the program.
+int pvtBatch(const Arguments& args);
+int tabulation(const Arguments& args);
+int denseAdSimd(const Arguments& args);
+int ptFlashBatch(const Arguments& args);
+int parserStartup(const Arguments& args);
+
+} // namespace Opm::Benchmark
+
+#endif // OPM_BENCHMARK_HPP
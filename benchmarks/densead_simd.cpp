@@ -0,0 +1,206 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Time typical flux expressions on statically sized dense-AD
+ *        evaluations with 3, 4 and 6 derivatives.
+ *
+ * Build once with and once without the CMake option OPM_DENSEAD_SIMD to
+ * compare the unrolled and the SIMD-padded Evaluation specializations.  The
+ * same expressions are also timed on EvaluationBlock objects, which process
+ * several faces per operation.
+ *
+ * Usage: opm-benchmarks densead [number of faces] [number of repetitions]
+ */
+#include "config.h"
+
+#include "Benchmark.hpp"
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/EvaluationBlock.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <class Evaluation>
+struct FaceStates
+{
+    explicit FaceStates(const std::size_t numFaces)
+        : p0(numFaces), p1(numFaces), rho(numFaces), mu(numFaces), sat(numFaces)
+        , trans(numFaces), dz(numFaces), flux(numFaces)
+    {
+        std::mt19937 gen{42};
+        std::uniform_real_distribution<double> p{100.0e5, 300.0e5};
+        std::uniform_real_distribution<double> unit{0.0, 1.0};
+
+        for (std::size_t face = 0; face < numFaces; ++face) {
+            p0[face] = Evaluation::createVariable(p(gen), 0);
+            p1[face] = Evaluation{p(gen)};
+            sat[face] = Evaluation::createVariable(0.1 + 0.8*unit(gen), 1);
+            rho[face] = Evaluation{800.0 + 200.0*unit(gen)};
+            mu[face] = Evaluation{1.0e-3*(1.0 + unit(gen))};
+            trans[face] = 1.0e-12*(1.0 + unit(gen));
+            dz[face] = unit(gen) - 0.5;
+
+            // Mimic the dependence of densities and viscosities on pressure
+            // and of the other derivatives on further primary variables.
+            rho[face].setDerivative(0, 1.0e-6);
+            mu[face].setDerivative(0, 1.0e-12);
+            for (int varIdx = 2; varIdx < Evaluation::numVars; ++varIdx) {
+                rho[face].setDerivative(varIdx, unit(gen));
+                mu[face].setDerivative(varIdx, 1.0e-4*unit(gen));
+            }
+        }
+    }
+
+    std::vector<Evaluation> p0, p1, rho, mu, sat;
+    std::vector<double> trans, dz;
+    std::vector<Evaluation> flux;
+};
+
+// Face states gathered into blocks of consecutive faces.
+template <class Evaluation, int blockSize>
+struct BlockFaceStates
+{
+    using Block = Opm::DenseAd::EvaluationBlock<double, Evaluation::numVars, blockSize>;
+    using ValueBlock = Opm::DenseAd::ValueBlock<double, blockSize>;
+
+    explicit BlockFaceStates(const std::size_t numFaces)
+    {
+        const FaceStates<Evaluation> s(numFaces);
+        for (std::size_t face = 0; face + blockSize <= numFaces; face += blockSize) {
+            p0.push_back(Opm::DenseAd::loadBlock<blockSize>(&s.p0[face]));
+            p1.push_back(Opm::DenseAd::loadBlock<blockSize>(&s.p1[face]));
+            rho.push_back(Opm::DenseAd::loadBlock<blockSize>(&s.rho[face]));
+            mu.push_back(Opm::DenseAd::loadBlock<blockSize>(&s.mu[face]));
+            sat.push_back(Opm::DenseAd::loadBlock<blockSize>(&s.sat[face]));
+
+            std::array<double, blockSize> t, z;
+            std::copy_n(&s.trans[face], blockSize, t.begin());
+            std::copy_n(&s.dz[face], blockSize, z.begin());
+            trans.emplace_back(t);
+            dz.emplace_back(z);
+        }
+        flux.resize(p0.size());
+    }
+
+    std::vector<Block> p0, p1, rho, mu, sat;
+    std::vector<ValueBlock> trans, dz;
+    std::vector<Block> flux;
+};
+
+// Run the flux expressions on all elements of the face states, which are
+// either individual evaluations or blocks of evaluations.
+template <class States>
+void runKernels(Opm::Benchmark::Table& table, const std::string& label, States& s,
+                const std::size_t numFaces, const int numRepetitions)
+{
+    // Time per call and per face.
+    const auto report = [&table, numFaces](const std::string& what, const double seconds)
+    {
+        table.row(what, { seconds, 1.0e9*seconds/numFaces });
+    };
+
+    constexpr double g = 9.80665;
+    const std::size_t numElems = s.flux.size();
+
+    // Two-point flux with upwinded Corey mobility.
+    report(label + " TPFA flux", Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        for (std::size_t face = 0; face < numElems; ++face) {
+            const auto dp = s.p1[face] - s.p0[face] - s.rho[face]*(g*s.dz[face]);
+            const auto mob = s.sat[face]*s.sat[face] / s.mu[face];
+            s.flux[face] = mob*dp*s.trans[face];
+        }
+    }));
+
+    // Pressure-dependent rock and fluid properties.
+    report(label + " exp/log", Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        for (std::size_t face = 0; face < numElems; ++face) {
+            const auto dp = (s.p0[face] - 200.0e5)*4.5e-10;
+            const auto b = Opm::exp(dp) * (1.0 + Opm::log(s.rho[face]/800.0));
+            s.flux[face] = b*s.rho[face];
+        }
+    }));
+
+    // Power-law relative permeability and viscosity ratio.
+    report(label + " pow/division", Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        for (std::size_t face = 0; face < numElems; ++face) {
+            const auto kr = Opm::pow(s.sat[face], 2.5);
+            s.flux[face] = kr / (s.mu[face]*Opm::pow(s.rho[face]/800.0, s.sat[face]));
+        }
+    }));
+}
+
+template <class Evaluation>
+void runBenchmark(Opm::Benchmark::Table& table, const std::string& label,
+                  const std::size_t numFaces, const int numRepetitions)
+{
+    FaceStates<Evaluation> s(numFaces);
+    runKernels(table, label, s, numFaces, numRepetitions);
+}
+
+template <class Evaluation, int blockSize>
+void runBlockBenchmark(Opm::Benchmark::Table& table, const std::string& label,
+                       const std::size_t numFaces, const int numRepetitions)
+{
+    BlockFaceStates<Evaluation, blockSize> s(numFaces);
+    runKernels(table, label, s, numFaces - numFaces % blockSize, numRepetitions);
+}
+
+} // Anonymous namespace
+
+int Opm::Benchmark::denseAdSimd(const Arguments& args)
+{
+    const std::size_t numFaces = argument(args, 0, 1000000);
+    const auto numRepetitions = static_cast<int>(argument(args, 1, 10));
+
+    std::cout << "Faces: " << numFaces << ", repetitions: " << numRepetitions
+              << ", SIMD-padded evaluations: "
+#if OPM_DENSEAD_SIMD_ENABLED
+              << "yes"
+#else
+              << "no"
+#endif
+              << '\n';
+
+    Table table(std::cout, "Expression", { "Time [s]", "[ns/face]" });
+
+    runBenchmark<Opm::DenseAd::Evaluation<double, 3>>(table, "Evaluation<3>", numFaces, numRepetitions);
+    runBenchmark<Opm::DenseAd::Evaluation<double, 4>>(table, "Evaluation<4>", numFaces, numRepetitions);
+    runBenchmark<Opm::DenseAd::Evaluation<double, 6>>(table, "Evaluation<6>", numFaces, numRepetitions);
+    runBlockBenchmark<Opm::DenseAd::Evaluation<double, 3>, 4>(table, "EvaluationBlock<3,4>", numFaces, numRepetitions);
+    runBlockBenchmark<Opm::DenseAd::Evaluation<double, 3>, 8>(table, "EvaluationBlock<3,8>", numFaces, numRepetitions);
+    runBlockBenchmark<Opm::DenseAd::Evaluation<double, 6>, 4>(table, "EvaluationBlock<6,4>", numFaces, numRepetitions);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*!
+ * \file
+ *
+ * \brief Performance measurements of selected opm-common kernels.  Only
+ *        built if the CMake option OPM_ENABLE_BENCHMARKS is set.
+ *
+ * Usage: opm-benchmarks <benchmark> [benchmark arguments]
+ */
+#include "config.h"
+
+#include "Benchmark.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace {
+
+struct Entry
+{
+    std::string_view name;
+    std::string_view arguments;
+    std::string_view description;
+    int (*run)(const Opm::Benchmark::Arguments&);
+};
+
+const Entry benchmarks[] = {
+    { "pvt-batch", "[cells] [repetitions]",
+      "Per-cell vs. batched PVT multiplexer evaluation", &Opm::Benchmark::pvtBatch },
+    { "tabulation", "[evaluations] [repetitions]",
+      "Bisection vs. segment lookup in tabulated functions", &Opm::Benchmark::tabulation },
+    { "densead", "[faces] [repetitions]",
+      "Flux expressions on dense AD evaluations", &Opm::Benchmark::denseAdSimd },
+#if HAVE_DUNE_COMMON
+    { "ptflash-batch", "[cells] [repetitions]",
+      "Per-cell vs. batched PT flash", &Opm::Benchmark::ptFlashBatch },
+#endif
+    { "parser-startup", "[repetitions]",
+      "Parser construction time and memory", &Opm::Benchmark::parserStartup },
+};
+
+void usage(const char* program)
+{
+    std::cerr << "Usage: " << program << " <benchmark> [arguments]\n\nBenchmarks:\n";
+    for (const auto& benchmark : benchmarks) {
+        std::cerr << "  " << std::left << std::setw(16) << benchmark.name
+                  << std::setw(30) << benchmark.arguments
+                  << benchmark.description << '\n';
+    }
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (const auto& benchmark : benchmarks) {
+        if (benchmark.name == argv[1]) {
+            return benchmark.run({ argv + 2, argv + argc });
+        }
+    }
+
+    usage(argv[0]);
+    return EXIT_FAILURE;
+}
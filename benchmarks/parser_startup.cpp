@@ -0,0 +1,143 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*!
+ * \file
+ *
+ * \brief Measure the time and memory needed to construct a Parser, with
+ *        built-in keywords constructed on first use and with all built-in
+ *        keywords constructed up front.
+ *
+ * Usage: opm-benchmarks parser-startup [number of repetitions]
+ */
+#include "config.h"
+
+#include "Benchmark.hpp"
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Resident set size, in kB, of the current process.  Zero if unknown.
+std::size_t residentSetSize()
+{
+    std::ifstream status { "/proc/self/status" };
+
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmRSS:", 0) == 0) {
+            return std::stoul(line.substr(6));
+        }
+    }
+
+    return 0;
+}
+
+// Construct all built-in keywords of a parser, as was previously done
+// unconditionally in the Parser constructor.
+void constructAll(const Opm::Parser& parser)
+{
+    for (const auto& deck_name : parser.getAllDeckNames()) {
+        if (parser.isBaseRecognizedKeyword(deck_name)) {
+            parser.getKeyword(deck_name);
+        }
+    }
+}
+
+// Memory held by numParsers parsers.
+template <class Setup>
+std::size_t memoryOf(const int numParsers, Setup&& setup)
+{
+    const auto before = residentSetSize();
+
+    auto parsers = std::vector<std::unique_ptr<Opm::Parser>>{};
+    for (int i = 0; i < numParsers; ++i) {
+        parsers.push_back(std::make_unique<Opm::Parser>());
+        setup(*parsers.back());
+    }
+
+    const auto after = residentSetSize();
+
+    return (after > before) ? (after - before) / numParsers : 0;
+}
+
+const char* smallDeck = R"(
+RUNSPEC
+DIMENS
+ 10 10 3 /
+OIL
+WATER
+GAS
+TABDIMS
+/
+GRID
+DX
+ 300*100 /
+DY
+ 300*100 /
+DZ
+ 300*10 /
+TOPS
+ 100*2000 /
+PORO
+ 300*0.25 /
+)";
+
+} // Anonymous namespace
+
+int Opm::Benchmark::parserStartup(const Arguments& args)
+{
+    const auto numRepetitions = static_cast<int>(argument(args, 0, 20));
+    const int numParsers = 5;
+
+    // Construct one parser first, so that one time initialisation is not
+    // attributed to either case.
+    constructAll(Opm::Parser{});
+
+    std::cout << "Repetitions: " << numRepetitions << '\n';
+
+    Table table(std::cout, "Case", { "Time [s]", "RSS [kB]" });
+
+    const auto report = [&table](const std::string& what, const double seconds, const std::size_t rss)
+    {
+        table.row(what, { seconds, static_cast<double>(rss) });
+    };
+
+    report("Parser() on first use",
+           timeIt(numRepetitions, []() { Opm::Parser parser; }),
+           memoryOf(numParsers, [](const Opm::Parser&) {}));
+
+    report("Parser() + small deck",
+           timeIt(numRepetitions, []() { Opm::Parser{}.parseString(smallDeck); }),
+           memoryOf(numParsers, [](const Opm::Parser& p) { p.parseString(smallDeck); }));
+
+    report("Parser() all keywords",
+           timeIt(numRepetitions, []() { constructAll(Opm::Parser{}); }),
+           memoryOf(numParsers, [](const Opm::Parser& p) { constructAll(p); }));
+
+    return EXIT_SUCCESS;
+}
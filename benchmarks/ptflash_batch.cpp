@@ -0,0 +1,181 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Compare per-cell and batched PT flash calculations of a
+ *        three-component system, starting both from the Wilson K-values and
+ *        from the solution of the previous time step.
+ *
+ * Usage: opm-benchmarks ptflash-batch [number of cells] [number of repetitions]
+ */
+#include "config.h"
+
+#include "Benchmark.hpp"
+
+#include <opm/material/constraintsolvers/PTFlash.hpp>
+#include <opm/material/constraintsolvers/PTFlashBatch.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/fluidstates/CompositionalFluidState.hpp>
+#include <opm/material/fluidsystems/ThreeComponentFluidSystem.hh>
+
+#include <opm/input/eclipse/EclipseState/Compositional/CompositionalConfig.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+using FluidSystem = Opm::ThreeComponentFluidSystem<double>;
+constexpr int numComponents = FluidSystem::numComponents;
+using Evaluation = Opm::DenseAd::Evaluation<double, numComponents + 1>;
+using FluidState = Opm::CompositionalFluidState<Evaluation, FluidSystem>;
+using Flash = Opm::PTFlash<double, FluidSystem, true>;
+using FlashBatch = Opm::PTFlashBatch<double, FluidSystem, true>;
+
+// Mostly two-phase cells, with every fourth cell at a pressure at which it
+// is mostly single-phase.
+std::vector<FluidState> cellStates(const std::size_t numCells)
+{
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> lowPressure{8.0e5, 12.0e5};
+    std::uniform_real_distribution<double> highPressure{100.0e5, 200.0e5};
+    std::uniform_real_distribution<double> temperature{295.0, 305.0};
+    std::uniform_real_distribution<double> factor{0.9, 1.1};
+
+    std::vector<FluidState> states(numCells);
+    for (std::size_t cell = 0; cell < numCells; ++cell) {
+        const double z0 = 0.5*factor(gen);
+        const double z1 = 0.3*factor(gen);
+        const double z2 = 0.2*factor(gen);
+        const double sum = z0 + z1 + z2;
+
+        const auto p = Evaluation::createVariable(cell % 4 == 0 ? highPressure(gen) : lowPressure(gen), 0);
+        auto& fs = states[cell];
+        fs.setPressure(FluidSystem::oilPhaseIdx, p);
+        fs.setPressure(FluidSystem::gasPhaseIdx, p);
+        fs.setTemperature(Evaluation::createVariable(temperature(gen), 1));
+        fs.setMoleFraction(0, Evaluation::createVariable(z0/sum, 2));
+        fs.setMoleFraction(1, Evaluation::createVariable(z1/sum, 3));
+        fs.setMoleFraction(2, 1.0 - fs.moleFraction(0) - fs.moleFraction(1));
+    }
+
+    return states;
+}
+
+// Initial guess of a cold start.
+void resetInitialGuess(std::vector<FluidState>& states)
+{
+    for (auto& fs : states) {
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fs.setKvalue(compIdx, fs.wilsonK_(compIdx));
+        }
+        fs.setLvalue(1.0);
+    }
+}
+
+// Next time step, in which the pressure of every cell has changed slightly.
+void nextTimeStep(std::vector<FluidState>& states)
+{
+    for (auto& fs : states) {
+        const auto p = fs.pressure(FluidSystem::oilPhaseIdx)*1.01;
+        fs.setPressure(FluidSystem::oilPhaseIdx, p);
+        fs.setPressure(FluidSystem::gasPhaseIdx, p);
+    }
+}
+
+void runBenchmark(Opm::Benchmark::Table& table, const std::string& method,
+                  const std::size_t numCells, const int numRepetitions)
+{
+    constexpr double tolerance = 1.0e-8;
+    constexpr auto eos = Opm::CompositionalConfig::EOSType::PR;
+
+    auto initial = cellStates(numCells);
+    resetInitialGuess(initial);
+
+    std::vector<FluidState> states;
+    const auto coldCell = Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        states = initial;
+        for (auto& fs : states) {
+            Flash::solve(fs, method, tolerance, eos);
+        }
+    });
+
+    FlashBatch::Workspace workspace;
+    const auto coldBatch = Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        states = initial;
+        workspace.reset();
+        FlashBatch::solve(std::span{states}, workspace, method, tolerance, eos);
+    });
+    table.comparison(method + ", cold", coldCell, coldBatch);
+
+    // The per-cell flash starts from the K-values and the liquid fraction of
+    // the previous time step stored in the fluid states, the batched flash
+    // from those stored in the workspace.
+    auto solved = initial;
+    for (auto& fs : solved) {
+        Flash::solve(fs, method, tolerance, eos);
+    }
+    nextTimeStep(solved);
+
+    const auto warmCell = Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        states = solved;
+        for (auto& fs : states) {
+            Flash::solve(fs, method, tolerance, eos);
+        }
+    });
+
+    states = initial;
+    workspace.reset();
+    FlashBatch::solve(std::span{states}, workspace, method, tolerance, eos);
+    const FlashBatch::Workspace previous = workspace;
+    const auto warmBatch = Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        states = solved;
+        workspace = previous;
+        FlashBatch::solve(std::span{states}, workspace, method, tolerance, eos);
+    });
+    table.comparison(method + ", warm", warmCell, warmBatch);
+}
+
+} // Anonymous namespace
+
+int Opm::Benchmark::ptFlashBatch(const Arguments& args)
+{
+    const std::size_t numCells = argument(args, 0, 10000);
+    const auto numRepetitions = static_cast<int>(argument(args, 1, 10));
+
+    std::cout << "Cells: " << numCells << ", repetitions: " << numRepetitions << '\n';
+
+    Table table(std::cout, "Flash", { "Per-cell [s]", "Batch [s]", "Speed-up" });
+
+    for (const std::string method : { "ssi", "ssi+newton" }) {
+        runBenchmark(table, method, numCells, numRepetitions);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,244 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Compare per-cell and batched evaluation of black-oil PVT
+ *        relations through the PVT multiplexers.
+ *
+ * Usage: opm-benchmarks pvt-batch [number of cells] [number of repetitions]
+ */
+#include "config.h"
+
+#include "Benchmark.hpp"
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+// Two PVT regions of live oil, wet gas and water, with PVTO tables of
+// typical size.
+std::string pvtDeck()
+{
+    std::ostringstream deck;
+
+    deck << R"(RUNSPEC
+DIMENS
+ 1 1 1 /
+TABDIMS
+ 1 2 /
+OIL
+GAS
+WATER
+DISGAS
+VAPOIL
+METRIC
+GRID
+DX
+ 1 /
+DY
+ 1 /
+DZ
+ 1 /
+TOPS
+ 1000 /
+PORO
+ 0.2 /
+PROPS
+DENSITY
+ 850 1030 0.9 /
+ 860 1030 0.9 /
+PVTW
+ 200 1.02 4.5e-5 0.4 0 /
+ 210 1.03 4.6e-5 0.5 0 /
+PVTG
+ 50   0.0004  0.025   0.015
+      0.0     0.0249  0.0149 /
+ 150  0.0010  0.0087  0.018
+      0.0     0.0086  0.0179 /
+ 300  0.0030  0.0046  0.024
+      0.0     0.0045  0.0239 /
+/
+ 50   0.0005  0.026   0.016
+      0.0     0.0259  0.0159 /
+ 150  0.0011  0.0088  0.019
+      0.0     0.0087  0.0189 /
+ 300  0.0031  0.0047  0.025
+      0.0     0.0046  0.0249 /
+/
+PVTO
+)";
+
+    for (int region = 0; region < 2; ++region) {
+        for (int i = 0; i < 20; ++i) {
+            const double Rs = 10.0 + 10.0*i;
+            const double pb = 20.0 + 15.0*i + region;
+            const double Bo = 1.05 + 0.005*i;
+            const double mu = 2.0 - 0.05*i;
+
+            deck << ' ' << Rs << ' ' << pb << ' ' << Bo << ' ' << mu << '\n';
+            for (int j = 1; j <= 4; ++j) {
+                deck << "   " << pb + 50.0*j << ' '
+                     << Bo*(1.0 - 0.002*j) << ' '
+                     << mu*(1.0 + 0.02*j) << '\n';
+            }
+            deck << " /\n";
+        }
+        deck << "/\n";
+    }
+
+    deck << "SCHEDULE\nEND\n";
+
+    return deck.str();
+}
+
+template <class Evaluation>
+struct CellStates
+{
+    explicit CellStates(const std::size_t numCells)
+        : regionIdx(numCells), temperature(numCells), pressure(numCells)
+        , Rs(numCells), Rv(numCells), zero(numCells, Evaluation{0.0})
+        , invB(numCells), mu(numCells)
+    {
+        std::mt19937 gen{42};
+        std::uniform_real_distribution<double> p{50.0e5, 350.0e5};
+        std::uniform_real_distribution<double> rs{0.0, 150.0};
+        std::uniform_real_distribution<double> rv{0.0, 5.0e-4};
+
+        for (std::size_t cell = 0; cell < numCells; ++cell) {
+            // Contiguous blocks of cells per region, as in typical models.
+            regionIdx[cell] = (2*cell < numCells) ? 0 : 1;
+            temperature[cell] = Evaluation{273.15 + 80.0};
+            pressure[cell] = Evaluation{p(gen)};
+            Rs[cell] = Evaluation{rs(gen)};
+            Rv[cell] = Evaluation{rv(gen)};
+        }
+
+        if constexpr (! std::is_same_v<Evaluation, double>) {
+            for (std::size_t cell = 0; cell < numCells; ++cell) {
+                pressure[cell].setDerivative(0, 1.0);
+                Rs[cell].setDerivative(1, 1.0);
+            }
+        }
+    }
+
+    std::vector<unsigned> regionIdx;
+    std::vector<Evaluation> temperature, pressure, Rs, Rv, zero;
+    std::vector<Evaluation> invB, mu;
+};
+
+template <class Evaluation, class OilPvt, class GasPvt, class WaterPvt>
+void runBenchmark(Opm::Benchmark::Table& table, const std::string& label,
+                  const OilPvt& oilPvt, const GasPvt& gasPvt, const WaterPvt& waterPvt,
+                  const std::size_t numCells, const int numRepetitions)
+{
+    CellStates<Evaluation> s(numCells);
+
+    const auto oilCell = Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        for (std::size_t cell = 0; cell < numCells; ++cell) {
+            const auto r = s.regionIdx[cell];
+            s.invB[cell] = oilPvt.inverseFormationVolumeFactor(r, s.temperature[cell], s.pressure[cell], s.Rs[cell]);
+            s.mu[cell] = oilPvt.viscosity(r, s.temperature[cell], s.pressure[cell], s.Rs[cell]);
+        }
+    });
+    const auto oilBatch = Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        oilPvt.template inverseFormationVolumeFactorAndViscosity<Evaluation>
+            (s.regionIdx, s.temperature, s.pressure, s.Rs, s.invB, s.mu);
+    });
+    table.comparison(label + " oil (PVTO)", oilCell, oilBatch);
+
+    const auto gasCell = Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        for (std::size_t cell = 0; cell < numCells; ++cell) {
+            const auto r = s.regionIdx[cell];
+            s.invB[cell] = gasPvt.inverseFormationVolumeFactor(r, s.temperature[cell], s.pressure[cell], s.Rv[cell], s.zero[cell]);
+            s.mu[cell] = gasPvt.viscosity(r, s.temperature[cell], s.pressure[cell], s.Rv[cell], s.zero[cell]);
+        }
+    });
+    const auto gasBatch = Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        gasPvt.template inverseFormationVolumeFactorAndViscosity<Evaluation>
+            (s.regionIdx, s.temperature, s.pressure, s.Rv, s.zero, s.invB, s.mu);
+    });
+    table.comparison(label + " gas (PVTG)", gasCell, gasBatch);
+
+    const auto watCell = Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        for (std::size_t cell = 0; cell < numCells; ++cell) {
+            const auto r = s.regionIdx[cell];
+            s.invB[cell] = waterPvt.inverseFormationVolumeFactor(r, s.temperature[cell], s.pressure[cell], s.zero[cell], s.zero[cell]);
+            s.mu[cell] = waterPvt.viscosity(r, s.temperature[cell], s.pressure[cell], s.zero[cell], s.zero[cell]);
+        }
+    });
+    const auto watBatch = Opm::Benchmark::timeIt(numRepetitions, [&]() {
+        waterPvt.template inverseFormationVolumeFactorAndViscosity<Evaluation>
+            (s.regionIdx, s.temperature, s.pressure, s.zero, s.zero, s.invB, s.mu);
+    });
+    table.comparison(label + " water (PVTW)", watCell, watBatch);
+}
+
+} // Anonymous namespace
+
+int Opm::Benchmark::pvtBatch(const Arguments& args)
+{
+    const std::size_t numCells = argument(args, 0, 1000000);
+    const auto numRepetitions = static_cast<int>(argument(args, 1, 10));
+
+    const auto deck = Opm::Parser{}.parseString(pvtDeck());
+    const auto eclState = Opm::EclipseState { deck };
+    const auto schedule = Opm::Schedule { deck, eclState, std::make_shared<Opm::Python>() };
+
+    Opm::OilPvtMultiplexer<double> oilPvt;
+    Opm::GasPvtMultiplexer<double> gasPvt;
+    Opm::WaterPvtMultiplexer<double> waterPvt;
+
+    oilPvt.initFromState(eclState, schedule);
+    gasPvt.initFromState(eclState, schedule);
+    waterPvt.initFromState(eclState, schedule);
+
+    std::cout << "Cells: " << numCells << ", repetitions: " << numRepetitions << '\n';
+
+    Table table(std::cout, "Evaluation", { "Per-cell [s]", "Batch [s]", "Speed-up" });
+
+    runBenchmark<double>(table, "double", oilPvt, gasPvt, waterPvt, numCells, numRepetitions);
+    runBenchmark<Opm::DenseAd::Evaluation<double, 3>>(table, "Evaluation<3>", oilPvt, gasPvt, waterPvt,
+                                                       numCells, numRepetitions);
+
+    return EXIT_SUCCESS;
+}
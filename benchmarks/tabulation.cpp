@@ -0,0 +1,174 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Compare bisection and constant time segment lookup in tabulated
+ *        functions of typical SWOF and PVTO table sizes.
+ *
+ * Usage: opm-benchmarks tabulation [number of evaluations] [number of repetitions]
+ */
+#include "config.h"
+
+#include "Benchmark.hpp"
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/common/UniformXTabulated2DFunction.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Water relative permeability column of a SWOF table with a refined region
+// near the critical saturation.
+Opm::Tabulated1DFunction<double> swofKrw(const std::size_t numRows)
+{
+    std::vector<double> sw(numRows), krw(numRows);
+    for (std::size_t i = 0; i < numRows; ++i) {
+        const double s = static_cast<double>(i) / (numRows - 1);
+        sw[i] = 0.2 + 0.7*s*s;
+        krw[i] = std::pow(s, 3.0);
+    }
+
+    return { sw, krw };
+}
+
+// Inverse formation volume factor of a PVTO table with undersaturated
+// branches of different lengths.
+Opm::UniformXTabulated2DFunction<double>
+pvtoInvB(const std::size_t numRs, const std::size_t numP)
+{
+    using Table = Opm::UniformXTabulated2DFunction<double>;
+
+    Table table(Table::InterpolationPolicy::Vertical);
+    for (std::size_t i = 0; i < numRs; ++i) {
+        const double Rs = 10.0*i;
+        const double pb = 20.0e5 + 15.0e5*i;
+        const double Bo = 1.05 + 0.005*i;
+
+        table.appendXPos(Rs);
+        for (std::size_t j = 0; j < numP - i % 3; ++j) {
+            table.appendSamplePoint(i, pb + 50.0e5*j*j, 1.0/(Bo*(1.0 - 0.002*j)));
+        }
+    }
+
+    return table;
+}
+
+template <class Evaluation>
+void run1D(Opm::Benchmark::Table& table, const std::string& label, const std::size_t numRows,
+           const std::size_t numEvals, const int numRepetitions)
+{
+    const auto bisection = swofKrw(numRows);
+    auto lookup = bisection;
+    lookup.buildSegmentLookup();
+
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> dist{bisection.xMin(), bisection.xMax()};
+
+    auto sw = std::vector<Evaluation>(numEvals);
+    for (auto& s : sw) {
+        s = Evaluation{dist(gen)};
+    }
+
+    auto kr = std::vector<Evaluation>(numEvals);
+    const auto evalAll = [&sw, &kr](const auto& function)
+    {
+        for (std::size_t k = 0; k < sw.size(); ++k) {
+            kr[k] = function.eval(sw[k], /*extrapolate=*/true);
+        }
+    };
+
+    table.comparison(label + " SWOF " + std::to_string(numRows) + " rows",
+                     Opm::Benchmark::timeIt(numRepetitions, [&]() { evalAll(bisection); }),
+                     Opm::Benchmark::timeIt(numRepetitions, [&]() { evalAll(lookup); }));
+}
+
+template <class Evaluation>
+void run2D(Opm::Benchmark::Table& table, const std::string& label,
+           const std::size_t numRs, const std::size_t numP,
+           const std::size_t numEvals, const int numRepetitions)
+{
+    const auto bisection = pvtoInvB(numRs, numP);
+    auto lookup = bisection;
+    lookup.buildSegmentLookup();
+
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> rs{bisection.xMin(), bisection.xMax()};
+    std::uniform_real_distribution<double> dp{0.0, 50.0e5*(numP - 3)*(numP - 3)};
+
+    auto Rs = std::vector<Evaluation>(numEvals);
+    auto p = std::vector<Evaluation>(numEvals);
+    for (std::size_t k = 0; k < numEvals; ++k) {
+        Rs[k] = Evaluation{rs(gen)};
+        p[k] = Evaluation{20.0e5 + 1.5e5*Opm::getValue(Rs[k]) + dp(gen)};
+    }
+
+    auto invB = std::vector<Evaluation>(numEvals);
+    const auto evalAll = [&Rs, &p, &invB](const auto& function)
+    {
+        for (std::size_t k = 0; k < Rs.size(); ++k) {
+            invB[k] = function.eval(Rs[k], p[k], /*extrapolate=*/true);
+        }
+    };
+
+    table.comparison(label + " PVTO " + std::to_string(numRs) + "x" + std::to_string(numP),
+                     Opm::Benchmark::timeIt(numRepetitions, [&]() { evalAll(bisection); }),
+                     Opm::Benchmark::timeIt(numRepetitions, [&]() { evalAll(lookup); }));
+}
+
+template <class Evaluation>
+void runAll(Opm::Benchmark::Table& table, const std::string& label,
+            const std::size_t numEvals, const int numRepetitions)
+{
+    for (const std::size_t numRows : { 20, 50, 200 }) {
+        run1D<Evaluation>(table, label, numRows, numEvals, numRepetitions);
+    }
+
+    run2D<Evaluation>(table, label, 20, 6, numEvals, numRepetitions);
+    run2D<Evaluation>(table, label, 50, 10, numEvals, numRepetitions);
+}
+
+} // Anonymous namespace
+
+int Opm::Benchmark::tabulation(const Arguments& args)
+{
+    const std::size_t numEvals = argument(args, 0, 1000000);
+    const auto numRepetitions = static_cast<int>(argument(args, 1, 10));
+
+    std::cout << "Evaluations: " << numEvals << ", repetitions: " << numRepetitions << '\n';
+
+    Table table(std::cout, "Table", { "Bisection [s]", "Lookup [s]", "Speed-up" });
+
+    runAll<double>(table, "double", numEvals, numRepetitions);
+    runAll<Opm::DenseAd::Evaluation<double, 3>>(table, "Evaluation<3>", numEvals, numRepetitions);
+
+    return EXIT_SUCCESS;
+}
@@ -90,6 +90,9 @@ specializationTemplate = \
 
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/utility/gpuDecorators.hpp>
+{% if numDerivs > 0 %}\
+#include <opm/material/densead/EvaluationSimd.hpp>
+{% endif %}\
 {% if numDerivs == 0 %}\
 
 #if HAVE_DUNE_COMMON
@@ -301,9 +304,16 @@ public:
         for (int i = dstart_(); i < dend_(); ++i)
             data_[i] = 0.0;
 {% else %}\
+#if OPM_DENSEAD_SIMD_ENABLED
+        // the padding is cleared as well, which establishes the invariant
+        // that it is zero
+        for (std::size_t i = dstart_(); i < data_.size(); ++i)
+            data_[i] = 0.0;
+#else
 {%   for i in range(1, numDerivs+1) %}\
         data_[{{i}}] = 0.0;
 {%   endfor %}\
+#endif
 {% endif %}\
     }
 
@@ -503,9 +513,14 @@ public:
         for (int i = 0; i < length_(); ++i)
             data_[i] += other.data_[i];
 {% else %}\
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::transform(data_, other.data_,
+                        [](const auto& a, const auto& b) { return a + b; });
+#else
 {%   for i in range(0, numDerivs+1) %}\
         data_[{{i}}] += other.data_[{{i}}];
 {%   endfor %}\
+#endif
 {% endif %}\
 
         return *this;
@@ -558,9 +573,14 @@ public:
         for (int i = 0; i < length_(); ++i)
             data_[i] -= other.data_[i];
 {% else %}\
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::transform(data_, other.data_,
+                        [](const auto& a, const auto& b) { return a - b; });
+#else
 {%   for i in range(0, numDerivs+1) %}\
         data_[{{i}}] -= other.data_[{{i}}];
 {%   endfor %}\
+#endif
 {% endif %}\
 
         return *this;
@@ -628,17 +648,29 @@ public:
         const ValueType u = this->value();
         const ValueType v = other.value();
 
+{% if numDerivs == 0 %}\
         // value
         data_[valuepos_()] *= v ;
 
         //  derivatives
-{% if numDerivs == 0 %}\
         for (int i = dstart_(); i < dend_(); ++i)
             data_[i] = data_[i] * v + other.data_[i] * u;
 {% else %}\
+#if OPM_DENSEAD_SIMD_ENABLED
+        // value and derivatives in one pass: u*v + v*0 for the value and
+        // u'*v + v'*u for the derivatives
+        Simd::transformDerivatives(data_, other.data_, u,
+                                   [v](const auto& a, const auto& b, const auto& c)
+                                   { return a * v + b * c; });
+#else
+        // value
+        data_[valuepos_()] *= v ;
+
+        //  derivatives
 {%   for i in range(1, numDerivs+1) %}\
         data_[{{i}}] = data_[{{i}}] * v + other.data_[{{i}}] * u;
 {%   endfor %}\
+#endif
 {% endif %}\
 
         return *this;
@@ -653,9 +685,13 @@ public:
         for (int i = 0; i < length_(); ++i)
             data_[i] *= other;
 {% else %}\
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::scale(data_, other);
+#else
 {%   for i in range(0, numDerivs+1) %}\
         data_[{{i}}] *= other;
 {%   endfor %}\
+#endif
 {% endif %}\
 
         return *this;
@@ -721,21 +757,36 @@ public:
 
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
         // u'v)/v^2.
+{% if numDerivs == 0 %}\
         ValueType& u = data_[valuepos_()];
         const ValueType& v = other.value();
-{% if numDerivs == 0 %}\
         for (int idx = dstart_(); idx < dend_(); ++idx) {
             const ValueType& uPrime = data_[idx];
             const ValueType& vPrime = other.data_[idx];
 
             data_[idx] = (v*uPrime - u*vPrime)/(v*v);
         }
+        u /= v;
 {% else %}\
+#if OPM_DENSEAD_SIMD_ENABLED
+        const ValueType u = this->value();
+        const ValueType v = other.value();
+        const ValueType vv = v*v;
+
+        // value and derivatives in one pass: (v*u - 0*v)/v^2 for the value
+        // and (v*u' - u*v')/v^2 for the derivatives
+        Simd::transformDerivatives(data_, other.data_, u,
+                                   [v, vv](const auto& a, const auto& b, const auto& c)
+                                   { return (v*a - c*b)/vv; });
+#else
+        ValueType& u = data_[valuepos_()];
+        const ValueType& v = other.value();
 {%   for i in range(1, numDerivs+1) %}\
         data_[{{i}}] = (v*data_[{{i}}] - u*other.data_[{{i}}])/(v*v);
 {%   endfor %}\
-{% endif %}\
         u /= v;
+#endif
+{% endif %}\
 
         return *this;
 {% endif %}\
@@ -751,9 +802,13 @@ public:
         for (int i = 0; i < length_(); ++i)
             data_[i] *= tmp;
 {% else %}\
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::scale(data_, tmp);
+#else
 {%   for i in range(0, numDerivs+1) %}\
         data_[{{i}}] *= tmp;
 {%   endfor %}\
+#endif
 {% endif %}\
 
         return *this;
@@ -839,9 +894,14 @@ public:
         for (int i = 0; i < length_(); ++i)
             result.data_[i] = - data_[i];
 {% else %}\
+#if OPM_DENSEAD_SIMD_ENABLED
+        result.data_ = data_;
+        Simd::transform(result.data_, [](const auto& a) { return -a; });
+#else
 {%   for i in range(0, numDerivs+1) %}\
         result.data_[{{i}}] = - data_[{{i}}];
 {%   endfor %}\
+#endif
 {% endif %}\
 
         return result;
@@ -1085,6 +1145,27 @@ public:
         data_[dstart_() + varIdx] = derVal;
     }
 
+    // set the value and multiply all derivatives by a common factor, i.e.,
+    // apply the chain rule (f(x))' = f'(x)*x' to an evaluation of x
+    template <class RhsValueType>
+    OPM_HOST_DEVICE void setValueAndScaleDerivatives(const RhsValueType& val, const ValueType& factor)
+    {
+{% if numDerivs <= 0 %}\
+        setValue(val);
+        for (int i = dstart_(); i < dend_(); ++i)
+            data_[i] *= factor;
+{% else %}\
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::scaleDerivatives(data_, ValueType(val), factor);
+#else
+        data_[valuepos_()] = val;
+{%   for i in range(1, numDerivs+1) %}\
+        data_[{{i}}] *= factor;
+{%   endfor %}\
+#endif
+{% endif %}\
+    }
+
     template<class Serializer>
     OPM_HOST_DEVICE void serializeOp(Serializer& serializer)
     {
@@ -1104,7 +1185,14 @@ private:
 {% elif numDerivs == 0 %}\
     std::array<ValueT, numDerivs + 1> data_;
 {% else %}\
+#if OPM_DENSEAD_SIMD_ENABLED
+    // value and derivatives, padded with zeros to a multiple of the SIMD
+    // width
+    alignas(Simd::alignment<ValueT>({{numDerivs + 1}}))
+    std::array<ValueT, Simd::paddedLength<ValueT>({{numDerivs + 1}})> data_;
+#else
     std::array<ValueT, {{numDerivs + 1}}> data_;
+#endif
 {% endif %}\
 };
 
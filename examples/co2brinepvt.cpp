@@ -35,9 +35,14 @@
 #include <opm/material/components/CO2.hpp>
 #include <opm/material/components/CO2Tables.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -121,20 +126,169 @@ double molalityCO2inBrine(const double p,
 
 }
 
+// Time per call [ns] of a property evaluated at all sampling points.
+template <class Property>
+double timePerCall(const std::vector<double>& T,
+                   const std::vector<double>& p,
+                   Property&& property,
+                   std::vector<double>& values)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < T.size(); ++i) {
+        values[i] = property(T[i], p[i]);
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() / T.size();
+}
+
+// Compare the tabulated properties with the correlations at random states in
+// the tabulated range.
+void reportTabulation(const std::vector<double>& salinity,
+                      const int activityModel,
+                      const int thermalmixgas,
+                      const int thermalmixliquid,
+                      const int thermalmixsalt,
+                      const double tolerance)
+{
+    Opm::BrineCo2Pvt<double> brineCo2Pvt(salinity, activityModel, thermalmixsalt, thermalmixliquid);
+    Opm::Co2GasPvt<double> co2Pvt(salinity, activityModel, thermalmixgas);
+
+    Opm::Co2BrineTabulationParams<double> params;
+    params.tolerance = tolerance;
+
+    auto tabulatedBrineCo2Pvt = brineCo2Pvt;
+    auto tabulatedCo2Pvt = co2Pvt;
+    const auto start = std::chrono::steady_clock::now();
+    tabulatedBrineCo2Pvt.enableTabulation(params);
+    tabulatedCo2Pvt.enableTabulation(params);
+    const std::chrono::duration<double> setup = std::chrono::steady_clock::now() - start;
+
+    constexpr std::size_t numPoints = 20000;
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> temperature{params.temperatureMin, params.temperatureMax};
+    std::uniform_real_distribution<double> pressure{params.pressureMin, params.pressureMax};
+    std::vector<double> T(numPoints);
+    std::vector<double> p(numPoints);
+    for (std::size_t i = 0; i < numPoints; ++i) {
+        T[i] = temperature(gen);
+        p[i] = pressure(gen);
+    }
+
+    std::cout << "Tabulation with relative tolerance " << tolerance
+              << " set up in " << std::setprecision(3) << setup.count() << " s" << std::endl;
+    std::cout << std::left << std::setw(16) << "property"
+              << std::right << std::setw(14) << "max error"
+              << std::setw(14) << "mean error"
+              << std::setw(18) << "correlation [ns]"
+              << std::setw(12) << "table [ns]"
+              << std::setw(10) << "speed-up" << std::endl;
+
+    std::vector<double> exact(numPoints);
+    std::vector<double> approx(numPoints);
+    const auto report = [&](const std::string& name, auto&& correlation, auto&& table)
+    {
+        const double tCorrelation = timePerCall(T, p, correlation, exact);
+        const double tTable = timePerCall(T, p, table, approx);
+
+        // States at which the correlation is not finite, e.g., the water
+        // vaporization factor where the gas phase is pure water vapour, are
+        // skipped.
+        double maxError = 0.0;
+        double sumError = 0.0;
+        std::size_t numFinite = 0;
+        for (std::size_t i = 0; i < numPoints; ++i) {
+            if (!std::isfinite(exact[i])) {
+                continue;
+            }
+            const double error = exact[i] == 0.0 ? std::abs(approx[i])
+                                                 : std::abs(approx[i] - exact[i]) / std::abs(exact[i]);
+            maxError = std::max(maxError, error);
+            sumError += error;
+            ++numFinite;
+        }
+
+        std::cout << std::left << std::setw(16) << name << std::right
+                  << std::scientific << std::setprecision(2)
+                  << std::setw(14) << maxError
+                  << std::setw(14) << sumError / std::max<std::size_t>(numFinite, 1)
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(18) << tCorrelation
+                  << std::setw(12) << tTable
+                  << std::setw(10) << tCorrelation / tTable << std::endl;
+    };
+
+    const auto brineRsSat = [](const auto& pvt)
+    {
+        return [&pvt](double temp, double pres)
+        { return pvt.saturatedGasDissolutionFactor(/*regionIdx=*/0, temp, pres); };
+    };
+    const auto brineInvB = [](const auto& pvt)
+    {
+        return [&pvt](double temp, double pres)
+        { return pvt.saturatedInverseFormationVolumeFactor(/*regionIdx=*/0, temp, pres); };
+    };
+    const auto brineViscosity = [](const auto& pvt)
+    {
+        return [&pvt](double temp, double pres)
+        { return pvt.saturatedViscosity(/*regionIdx=*/0, temp, pres); };
+    };
+    const auto co2Rvw = [](const auto& pvt)
+    {
+        return [&pvt](double temp, double pres)
+        { return pvt.saturatedWaterVaporizationFactor(/*regionIdx=*/0, temp, pres); };
+    };
+    const auto co2Viscosity = [](const auto& pvt)
+    {
+        return [&pvt](double temp, double pres)
+        { return pvt.saturatedViscosity(/*regionIdx=*/0, temp, pres); };
+    };
+
+    report("brine rsSat", brineRsSat(brineCo2Pvt), brineRsSat(tabulatedBrineCo2Pvt));
+    report("brine invB", brineInvB(brineCo2Pvt), brineInvB(tabulatedBrineCo2Pvt));
+    report("brine viscosity", brineViscosity(brineCo2Pvt), brineViscosity(tabulatedBrineCo2Pvt));
+    report("CO2 rvwSat", co2Rvw(co2Pvt), co2Rvw(tabulatedCo2Pvt));
+    report("CO2 viscosity", co2Viscosity(co2Pvt), co2Viscosity(tabulatedCo2Pvt));
+}
+
+// Value of an option of the form --name or --name=value, or the default value
+// if the option has no value.
+double optionValue(const std::string& arg, const double defaultValue)
+{
+    const auto pos = arg.find('=');
+    return pos == std::string::npos ? defaultValue : std::stod(arg.substr(pos + 1));
+}
+
 } // Anonymous namespace
 
 int main(int argc, char **argv)
 {
 
     bool help = false;
+    bool tabulate = false;
+    bool tabulationReport = false;
+    double tolerance = Opm::Co2BrineTabulationParams<double>{}.tolerance;
+    std::vector<std::string> args;
     for (int i = 1; i < argc; ++i) {
         std::string tmp = argv[i];
         help = help || (tmp  == "--h") || (tmp  == "--help");
+        if (tmp.rfind("--tabulation-report", 0) == 0) {
+            tabulationReport = true;
+            tolerance = optionValue(tmp, tolerance);
+        }
+        else if (tmp.rfind("--tabulate", 0) == 0) {
+            tabulate = true;
+            tolerance = optionValue(tmp, tolerance);
+        }
+        else if (tmp.rfind("--", 0) != 0) {
+            args.push_back(tmp);
+        }
     }
 
-    if (argc < 5 || help) {
+    if ((args.size() < 4 && !tabulationReport) || help) {
         std::cout << "USAGE:" << std::endl;
-        std::cout << "co2brinepvt <prop> <phase> <p> <T> <salinity> <rs> <rv> <saltmodel> <thermalmixingmodelgas> <thermalmixingmodelliquid> <thermalmixingmodelsalt>"<< std::endl;
+        std::cout << "co2brinepvt [--tabulate[=<tolerance>]] <prop> <phase> <p> <T> <salinity> <rs> <rv> <saltmodel> <thermalmixingmodelgas> <thermalmixingmodelliquid> <thermalmixingmodelsalt>"<< std::endl;
+        std::cout << "co2brinepvt --tabulation-report[=<tolerance>] <salinity> <saltmodel>" << std::endl;
         std::cout << "prop = {density, invB, B, viscosity, rsSat, internalEnergy, enthalpy, diffusionCoefficient}" << std::endl;
         std::cout << "phase = {CO2, brine}" << std::endl;
         std::cout << "p: pressure in bar" << std::endl;
@@ -149,6 +303,8 @@ int main(int argc, char **argv)
         std::cout << "thermalmixingmodelsalt(optional): 0 = pure water; 1 = model in MICHAELIDES [default];" << std::endl;
         std::cout << "OPTIONS:" << std::endl;
         std::cout << "--h/--help Print help and exit." << std::endl;
+        std::cout << "--tabulate[=<tolerance>] Evaluate the properties by interpolation in tables with the given relative tolerance (default 1e-4)." << std::endl;
+        std::cout << "--tabulation-report[=<tolerance>] Report the accuracy and speed-up of the tables at random states and exit." << std::endl;
         std::cout << "DESCRIPTION:" << std::endl;
         std::cout << "co2brinepvt computes PVT properties of a brine/co2 system " << std::endl;
         std::cout << "for a given phase (oil or brine), pressure, temperature, salinity and rs." << std::endl;
@@ -158,10 +314,7 @@ int main(int argc, char **argv)
         return EXIT_FAILURE;
     }
 
-    std::string prop = argv[1];
-    std::string phase = argv[2];
-    double p = atof(argv[3]) * 1e5;
-    double T = atof(argv[4]) + 273.15;
+    const auto numArgs = args.size();
     double molality = 0.0;
     double rs = 0.0;
     double rv = 0.0;
@@ -169,31 +322,57 @@ int main(int argc, char **argv)
     int thermalmixgas = 0;
     int thermalmixliquid = 2;
     int thermalmixsalt = 1;
-    if (argc > 5)
-        molality = atof(argv[5]);
-    if (argc > 6)
-        rs = atof(argv[6]);
-    if (argc > 7)
-        rv = atof(argv[7]);
-
-    if (argc > 8)
-        activityModel = atoi(argv[8]);
-    if (argc > 9)
-        thermalmixgas = atoi(argv[9]);
-    if (argc > 10)
-        thermalmixliquid = atoi(argv[10]);
-    if (argc > 11)
-        thermalmixsalt = atoi(argv[11]);
+    if (tabulationReport) {
+        if (numArgs > 0)
+            molality = atof(args[0].c_str());
+        if (numArgs > 1)
+            activityModel = atoi(args[1].c_str());
+    }
+    else {
+        if (numArgs > 4)
+            molality = atof(args[4].c_str());
+        if (numArgs > 5)
+            rs = atof(args[5].c_str());
+        if (numArgs > 6)
+            rv = atof(args[6].c_str());
+
+        if (numArgs > 7)
+            activityModel = atoi(args[7].c_str());
+        if (numArgs > 8)
+            thermalmixgas = atoi(args[8].c_str());
+        if (numArgs > 9)
+            thermalmixliquid = atoi(args[9].c_str());
+        if (numArgs > 10)
+            thermalmixsalt = atoi(args[10].c_str());
+    }
 
     const double MmNaCl = 58.44e-3; // molar mass of NaCl [kg/mol]
     // convert to mass fraction
     std::vector<double> salinity = {0.0};
     if (molality > 0.0)
         salinity[0] = 1 / ( 1 + 1 / (molality*MmNaCl));
+
+    if (tabulationReport) {
+        reportTabulation(salinity, activityModel, thermalmixgas, thermalmixliquid, thermalmixsalt, tolerance);
+        return 0;
+    }
+
+    std::string prop = args[0];
+    std::string phase = args[1];
+    double p = atof(args[2].c_str()) * 1e5;
+    double T = atof(args[3].c_str()) + 273.15;
+
     Opm::BrineCo2Pvt<double> brineCo2Pvt(salinity, activityModel, thermalmixsalt, thermalmixliquid);
 
     Opm::Co2GasPvt<double> co2Pvt(salinity, activityModel, thermalmixgas);
 
+    if (tabulate) {
+        Opm::Co2BrineTabulationParams<double> params;
+        params.tolerance = tolerance;
+        brineCo2Pvt.enableTabulation(params);
+        co2Pvt.enableTabulation(params);
+    }
+
     double value;
     if (prop == "density") {
         if (phase == "CO2") {
@@ -0,0 +1,227 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/common/OpmLog/AsyncLogBackend.hpp>
+
+#include <opm/common/OpmLog/LogUtil.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+// Ring buffer cell.  A cell at position 'pos' may be written by the
+// producer claiming 'pos' once its sequence number equals 'pos', and read
+// by the consumer once its sequence number equals 'pos + 1'.
+struct Opm::AsyncLogBackend::Cell
+{
+    std::atomic<std::size_t> sequence{0};
+    std::int64_t messageFlag{0};
+    std::string messageTag{};
+    std::string message{};
+};
+
+Opm::AsyncLogBackend::AsyncLogBackend(std::shared_ptr<LogBackend> backend,
+                                      const std::size_t           capacity)
+    : LogBackend { (backend != nullptr) ? backend->getMask() : 0 }
+    , m_backend  { std::move(backend) }
+{
+    if (m_backend == nullptr) {
+        throw std::invalid_argument {
+            "Asynchronous log backend must wrap an existing backend"
+        };
+    }
+
+    const auto numCells = std::bit_ceil(std::max(capacity, std::size_t{2}));
+
+    m_cells = std::make_unique<Cell[]>(numCells);
+    m_cellMask = numCells - 1;
+
+    for (auto i = 0*numCells; i < numCells; ++i) {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    m_worker = std::thread { [this]() { this->run(); } };
+}
+
+Opm::AsyncLogBackend::~AsyncLogBackend()
+{
+    m_stop.store(true, std::memory_order_release);
+    this->wakeWorker();
+
+    m_worker.join();
+}
+
+void Opm::AsyncLogBackend::addTaggedMessage(const std::int64_t messageFlag,
+                                            const std::string& messageTag,
+                                            const std::string& message)
+{
+    const auto mask = this->getMask();
+    if (((messageFlag & mask) != messageFlag) || (messageFlag <= 0)) {
+        return;
+    }
+
+    if (! this->enqueue(messageFlag, messageTag, message)) {
+        m_numDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    this->wakeWorker();
+}
+
+void Opm::AsyncLogBackend::flush()
+{
+    if (std::this_thread::get_id() == m_worker.get_id()) {
+        // Called from the wrapped backend.  Nothing sensible to wait for.
+        return;
+    }
+
+    const auto target = m_enqueuePos.load(std::memory_order_acquire);
+
+    auto consumed = m_numConsumed.load(std::memory_order_acquire);
+    while (consumed < target) {
+        this->wakeWorker();
+        m_numConsumed.wait(consumed, std::memory_order_acquire);
+        consumed = m_numConsumed.load(std::memory_order_acquire);
+    }
+}
+
+std::size_t Opm::AsyncLogBackend::numDropped() const
+{
+    return m_numDropped.load(std::memory_order_relaxed);
+}
+
+void Opm::AsyncLogBackend::addMessageUnconditionally(const std::int64_t messageFlag,
+                                                     const std::string& message)
+{
+    this->addTaggedMessage(messageFlag, "", message);
+}
+
+// ---------------------------------------------------------------------------
+// Private member functions
+// ---------------------------------------------------------------------------
+
+bool Opm::AsyncLogBackend::enqueue(const std::int64_t messageFlag,
+                                   const std::string& messageTag,
+                                   const std::string& message)
+{
+    auto pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+    Cell* cell = nullptr;
+    while (true) {
+        cell = &m_cells[pos & m_cellMask];
+
+        const auto sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+
+        if (diff == 0) {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            // Buffer full.
+            return false;
+        }
+        else {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->messageFlag = messageFlag;
+    cell->messageTag = messageTag;
+    cell->message = message;
+
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+std::size_t Opm::AsyncLogBackend::drain()
+{
+    auto numDrained = std::size_t{0};
+
+    while (true) {
+        auto& cell = m_cells[m_dequeuePos & m_cellMask];
+        if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+            break;
+        }
+
+        auto messageTag = std::move(cell.messageTag);
+        auto message = std::move(cell.message);
+        const auto messageFlag = cell.messageFlag;
+
+        // Release the cell before output, so producers are not held up by
+        // a slow backend.
+        cell.sequence.store(m_dequeuePos + m_cellMask + 1, std::memory_order_release);
+        ++m_dequeuePos;
+
+        m_backend->addTaggedMessage(messageFlag, messageTag, message);
+        ++numDrained;
+    }
+
+    const auto numDropped = m_numDropped.load(std::memory_order_relaxed);
+    if (numDropped > m_numDroppedReported) {
+        m_backend->addMessage(Log::MessageType::Warning,
+                              fmt::format("{} log message(s) dropped because "
+                                          "the asynchronous log buffer was full",
+                                          numDropped - m_numDroppedReported));
+
+        m_numDroppedReported = numDropped;
+    }
+
+    if (numDrained > 0) {
+        m_numConsumed.fetch_add(numDrained, std::memory_order_release);
+        m_numConsumed.notify_all();
+    }
+
+    return numDrained;
+}
+
+void Opm::AsyncLogBackend::wakeWorker()
+{
+    m_wakeup.fetch_add(1, std::memory_order_release);
+    m_wakeup.notify_one();
+}
+
+void Opm::AsyncLogBackend::run()
+{
+    while (true) {
+        const auto wakeup = m_wakeup.load(std::memory_order_acquire);
+
+        if (this->drain() > 0) {
+            continue;
+        }
+
+        if (m_stop.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        // Any message added after 'wakeup' was read changes m_wakeup, so
+        // none can be missed here.
+        m_wakeup.wait(wakeup, std::memory_order_acquire);
+    }
+}
@@ -0,0 +1,129 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_ASYNC_LOG_BACKEND_HPP
+#define OPM_ASYNC_LOG_BACKEND_HPP
+
+#include <opm/common/OpmLog/LogBackend.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace Opm {
+
+    /// Log backend which outputs messages on a background thread.
+    ///
+    /// Messages are placed in a bounded, lock free ring buffer and passed
+    /// on to a wrapped backend by a single background thread.  Message
+    /// limits, formatting, and output of the wrapped backend, including any
+    /// flushing of file streams, therefore happen off the caller's thread.
+    /// Adding messages is safe from any number of threads concurrently,
+    /// and never blocks.  Messages which arrive while the buffer is full
+    /// are dropped and counted, and the wrapped backend is told how many
+    /// were dropped once there is room again.
+    ///
+    /// Messages reach the wrapped backend in the order they were added
+    /// from any single thread.  All pending messages are output by flush(),
+    /// which the Logger calls when the backend is removed, and by the
+    /// destructor.
+    ///
+    /// Message limiter and formatter should be set on the wrapped backend
+    /// before it is wrapped.  Those of this object are not used.
+    class AsyncLogBackend : public LogBackend
+    {
+    public:
+        /// Constructor.
+        ///
+        /// \param[in] backend Backend to which messages are passed on.
+        /// Must not be used directly while wrapped.
+        ///
+        /// \param[in] capacity Maximum number of pending messages.  Rounded
+        /// up to the next power of two.
+        explicit AsyncLogBackend(std::shared_ptr<LogBackend> backend,
+                                 std::size_t capacity = 4096);
+
+        /// Destructor.  Outputs all pending messages.
+        ~AsyncLogBackend() override;
+
+        AsyncLogBackend(const AsyncLogBackend&) = delete;
+        AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+
+        /// Queue tagged message for output by the wrapped backend.
+        void addTaggedMessage(std::int64_t messageFlag,
+                              const std::string& messageTag,
+                              const std::string& message) override;
+
+        /// Wait until all messages added so far have been passed on to the
+        /// wrapped backend.
+        void flush() override;
+
+        /// Wrapped backend.  Call flush() before inspecting its state.
+        const std::shared_ptr<LogBackend>& backend() const
+        { return this->m_backend; }
+
+        /// Total number of messages dropped because the buffer was full.
+        std::size_t numDropped() const;
+
+    protected:
+        void addMessageUnconditionally(std::int64_t messageFlag,
+                                       const std::string& message) override;
+
+    private:
+        struct Cell;
+
+        std::shared_ptr<LogBackend> m_backend;
+        std::unique_ptr<Cell[]> m_cells;
+        std::size_t m_cellMask;
+
+        /// Producer position, shared by all threads adding messages.
+        alignas(64) std::atomic<std::size_t> m_enqueuePos{0};
+
+        /// Consumer position.  Only accessed by the background thread.
+        alignas(64) std::size_t m_dequeuePos{0};
+
+        /// Number of messages passed on to the wrapped backend.
+        std::atomic<std::size_t> m_numConsumed{0};
+
+        /// Number of messages dropped, in total and as reported to the
+        /// wrapped backend.
+        std::atomic<std::size_t> m_numDropped{0};
+        std::size_t m_numDroppedReported{0};
+
+        /// Incremented whenever the background thread has work to do.
+        std::atomic<std::uint64_t> m_wakeup{0};
+        std::atomic<bool> m_stop{false};
+
+        std::thread m_worker;
+
+        bool enqueue(std::int64_t messageFlag,
+                     const std::string& messageTag,
+                     const std::string& message);
+
+        std::size_t drain();
+        void wakeWorker();
+        void run();
+    };
+
+} // namespace Opm
+
+#endif // OPM_ASYNC_LOG_BACKEND_HPP
@@ -55,6 +55,10 @@ namespace Opm {
         }
     }
 
+    void LogBackend::flush()
+    {
+    }
+
     std::int64_t LogBackend::getMask() const
     {
         return m_mask;
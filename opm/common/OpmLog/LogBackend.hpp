@@ -52,9 +52,13 @@ namespace Opm
         void addMessage(std::int64_t messageFlag, const std::string& message);
 
         /// Add a tagged message to the backend if accepted by the message limiter.
-        void addTaggedMessage(std::int64_t messageFlag,
-                              const std::string& messageTag,
-                              const std::string& message);
+        virtual void addTaggedMessage(std::int64_t messageFlag,
+                                      const std::string& messageTag,
+                                      const std::string& message);
+
+        /// Wait until all messages added to the backend have been output.
+        /// Does nothing unless the backend outputs messages asynchronously.
+        virtual void flush();
 
         /// The message mask types are specified in the
         /// Opm::Log::MessageType namespace, in file LogUtils.hpp.
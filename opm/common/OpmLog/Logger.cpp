@@ -43,6 +43,13 @@ namespace Opm {
         addMessageType( Log::MessageType::Note , "note");
     }
 
+    Logger::~Logger() {
+        // Output pending messages of asynchronous backends, also when the
+        // global logger is destroyed at program exit.
+        for (auto& iter : m_backends)
+            iter.second->flush();
+    }
+
     void Logger::addTaggedMessage(std::int64_t messageType, const std::string& tag, const std::string& message) const {
         if ((m_enabledTypes & messageType) == 0)
             throw std::invalid_argument("Tried to issue message with unrecognized message ID");
@@ -71,16 +78,23 @@ namespace Opm {
     }
 
     void Logger::removeAllBackends() {
+        // Output pending messages of asynchronous backends which might
+        // outlive the logger.
+        for (auto& iter : m_backends)
+            iter.second->flush();
+
         m_backends.clear();
         m_globalMask = 0;
     }
 
     bool Logger::removeBackend(const std::string& name) {
-        std::size_t eraseCount = m_backends.erase( name );
-        if (eraseCount == 1)
-            return true;
-        else
+        auto pair = m_backends.find( name );
+        if (pair == m_backends.end())
             return false;
+
+        pair->second->flush();
+        m_backends.erase( pair );
+        return true;
     }
 
     void Logger::addBackend(const std::string& name , std::shared_ptr<LogBackend> backend) {
@@ -34,6 +34,7 @@ class Logger {
 
 public:
     Logger();
+    ~Logger();
     void addMessage(std::int64_t messageType , const std::string& message) const;
     void addTaggedMessage(std::int64_t messageType, const std::string& tag, const std::string& message) const;
 
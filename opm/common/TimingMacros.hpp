@@ -26,6 +26,10 @@
 // OPM_TIMEFUNCTION - time block of main part of codes which do not effect performance with name from function
 // OPM_TIMEBLOCK_LOCAL - detailed timing which may effect performance
 // OPM_TIMEFUNCTION_LOCAL - detailed timing which may effect performance with name from function
+//
+// The macros are backed by Tracy if USE_TRACY is set, otherwise by the
+// built-in profiler in opm/common/utility/Profiler.hpp if USE_OPM_PROFILER
+// is set, and expand to nothing otherwise.
 
 namespace Opm::Subsystem
 {
@@ -65,6 +69,17 @@ enum Bitfield : std::uint8_t
 #define OPM_TIMEBLOCK_LOCAL(blockname, subsys) ZoneNamedN(blockname, #blockname, DETAILED_PROFILING_SUBSYSTEMS & subsys)
 #define OPM_TIMEFUNCTION_LOCAL(subsys) ZoneNamedN(myname, __func__, DETAILED_PROFILING_SUBSYSTEMS & subsys)
 #endif
+#elif USE_OPM_PROFILER
+#include <opm/common/utility/Profiler.hpp>
+#define OPM_PROFILER_SCOPE(blockname, name, subsys) \
+    static const ::Opm::Profiler::Site opm_profiler_site_##blockname { name, static_cast<std::uint8_t>(subsys) }; \
+    const ::Opm::Profiler::Scope opm_profiler_scope_##blockname { opm_profiler_site_##blockname }
+#define OPM_TIMEBLOCK(blockname) OPM_PROFILER_SCOPE(blockname, #blockname, ::Opm::Subsystem::AnySystem)
+#define OPM_TIMEFUNCTION() OPM_PROFILER_SCOPE(myname, __func__, ::Opm::Subsystem::AnySystem)
+#if DETAILED_PROFILING
+#define OPM_TIMEBLOCK_LOCAL(blockname, subsys) OPM_PROFILER_SCOPE(blockname, #blockname, DETAILED_PROFILING_SUBSYSTEMS & subsys)
+#define OPM_TIMEFUNCTION_LOCAL(subsys) OPM_PROFILER_SCOPE(myname, __func__, DETAILED_PROFILING_SUBSYSTEMS & subsys)
+#endif
 #endif
 
 #ifndef OPM_TIMEBLOCK
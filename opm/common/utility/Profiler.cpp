@@ -0,0 +1,325 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/common/utility/Profiler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+struct Opm::Profiler::detail::Node
+{
+    const Site* site{nullptr};
+    Node* parent{nullptr};
+    std::vector<std::unique_ptr<Node>> children{};
+
+    std::uint64_t calls{0};
+    std::chrono::steady_clock::duration total{};
+};
+
+std::atomic<std::uint8_t> Opm::Profiler::detail::enabled_subsystems{0};
+
+namespace {
+
+    using Opm::Profiler::detail::Node;
+
+    struct ThreadTree
+    {
+        Node root{};
+        Node* current{&root};
+        std::size_t thread{0};
+    };
+
+    struct Registry
+    {
+        std::mutex mutex{};
+        std::vector<std::shared_ptr<ThreadTree>> trees{};
+
+        std::optional<std::pair<std::string, Opm::Profiler::Format>> exit_output{};
+        bool exit_handler_registered{false};
+    };
+
+    Registry& registry()
+    {
+        // Never destroyed, so that threads and exit handlers may still use
+        // it during static destruction.
+        static auto* reg = new Registry{};
+        return *reg;
+    }
+
+    ThreadTree& threadTree()
+    {
+        thread_local const auto tree = []()
+        {
+            auto& reg = registry();
+            std::lock_guard<std::mutex> lock { reg.mutex };
+
+            auto t = std::make_shared<ThreadTree>();
+            t->thread = reg.trees.size();
+            reg.trees.push_back(t);
+
+            return t;
+        }();
+
+        return *tree;
+    }
+
+    double seconds(const std::chrono::steady_clock::duration d)
+    {
+        return std::chrono::duration<double>(d).count();
+    }
+
+    std::string escape(std::string_view s)
+    {
+        auto out = std::string{};
+        out.reserve(s.size());
+
+        for (const auto c : s) {
+            if ((c == '"') || (c == '\\')) {
+                out.push_back('\\');
+            }
+
+            out.push_back(c);
+        }
+
+        return out;
+    }
+
+    void writeJsonNode(std::ostream& os, const Node& node, const int indent)
+    {
+        auto self = node.total;
+        for (const auto& child : node.children) {
+            self -= child->total;
+        }
+
+        os << fmt::format(R"({0:{1}}{{"name": "{2}", "subsystems": {3}, "calls": {4}, )"
+                          R"("total": {5:.9g}, "self": {6:.9g}, "children": [)",
+                          "", indent, escape(node.site->name), node.site->subsystems,
+                          node.calls, seconds(node.total), seconds(self));
+
+        for (auto i = 0*node.children.size(); i < node.children.size(); ++i) {
+            os << (i == 0 ? "\n" : ",\n");
+            writeJsonNode(os, *node.children[i], indent + 2);
+        }
+
+        if (! node.children.empty()) {
+            os << fmt::format("\n{0:{1}}", "", indent);
+        }
+
+        os << "]}";
+    }
+
+    void writeJson(std::ostream& os, const std::vector<std::shared_ptr<ThreadTree>>& trees)
+    {
+        os << "{\"threads\": [";
+
+        for (auto t = 0*trees.size(); t < trees.size(); ++t) {
+            const auto& root = trees[t]->root;
+
+            os << (t == 0 ? "\n" : ",\n")
+               << fmt::format("  {{\"thread\": {}, \"scopes\": [", trees[t]->thread);
+
+            for (auto i = 0*root.children.size(); i < root.children.size(); ++i) {
+                os << (i == 0 ? "\n" : ",\n");
+                writeJsonNode(os, *root.children[i], 4);
+            }
+
+            os << "\n  ]}";
+        }
+
+        os << "\n]}\n";
+    }
+
+    // Lay out node and its children as nested complete events, with
+    // children placed one after another from the start of their parent.
+    void writeTraceNode(std::ostream& os, const Node& node, const std::size_t thread,
+                        const double start, bool& first)
+    {
+        os << (first ? "\n" : ",\n")
+           << fmt::format(R"(  {{"name": "{}", "ph": "X", "pid": 0, "tid": {}, )"
+                          R"("ts": {:.3f}, "dur": {:.3f}, "args": {{"calls": {}}}}})",
+                          escape(node.site->name), thread, start,
+                          1.0e6 * seconds(node.total), node.calls);
+        first = false;
+
+        auto child_start = start;
+        for (const auto& child : node.children) {
+            writeTraceNode(os, *child, thread, child_start, first);
+            child_start += 1.0e6 * seconds(child->total);
+        }
+    }
+
+    void writeTrace(std::ostream& os, const std::vector<std::shared_ptr<ThreadTree>>& trees)
+    {
+        os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+
+        auto first = true;
+        for (const auto& tree : trees) {
+            auto start = 0.0;
+            for (const auto& child : tree->root.children) {
+                writeTraceNode(os, *child, tree->thread, start, first);
+                start += 1.0e6 * seconds(child->total);
+            }
+        }
+
+        os << "\n]}\n";
+    }
+
+    void writeTrees(std::ostream& os, const Opm::Profiler::Format format,
+                    const std::vector<std::shared_ptr<ThreadTree>>& trees)
+    {
+        if (format == Opm::Profiler::Format::ChromeTrace) {
+            writeTrace(os, trees);
+        }
+        else {
+            writeJson(os, trees);
+        }
+    }
+
+    void writeExitOutput()
+    {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock { reg.mutex };
+
+        if (! reg.exit_output.has_value()) {
+            return;
+        }
+
+        std::ofstream os { reg.exit_output->first };
+        if (os) {
+            writeTrees(os, reg.exit_output->second, reg.trees);
+        }
+    }
+
+    void enableFromEnvironment()
+    {
+        const char* subsystems = std::getenv("OPM_PROFILE");
+        if (subsystems == nullptr) {
+            return;
+        }
+
+        const auto mask = std::strtoul(subsystems, nullptr, 0);
+        if ((mask == 0) || (mask > 0xff)) {
+            return;
+        }
+
+        const char* filename = std::getenv("OPM_PROFILE_FILE");
+        const char* format = std::getenv("OPM_PROFILE_FORMAT");
+
+        Opm::Profiler::enable(static_cast<std::uint8_t>(mask));
+        Opm::Profiler::writeAtExit((filename != nullptr) ? filename : "opm_profile.json",
+                                   ((format != nullptr) && (std::string_view { format } == "chrome"))
+                                   ? Opm::Profiler::Format::ChromeTrace
+                                   : Opm::Profiler::Format::Json);
+    }
+
+    [[maybe_unused]] const bool enabled_from_environment = (enableFromEnvironment(), true);
+
+} // Anonymous namespace
+
+void Opm::Profiler::enable(const std::uint8_t subsystems)
+{
+    detail::enabled_subsystems.store(subsystems, std::memory_order_relaxed);
+}
+
+std::uint8_t Opm::Profiler::enabled()
+{
+    return detail::enabled_subsystems.load(std::memory_order_relaxed);
+}
+
+void Opm::Profiler::write(std::ostream& os, const Format format)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock { reg.mutex };
+
+    writeTrees(os, format, reg.trees);
+}
+
+void Opm::Profiler::writeAtExit(const std::string& filename, const Format format)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock { reg.mutex };
+
+    reg.exit_output.emplace(filename, format);
+
+    if (! reg.exit_handler_registered) {
+        std::atexit(&writeExitOutput);
+        reg.exit_handler_registered = true;
+    }
+}
+
+void Opm::Profiler::reset()
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock { reg.mutex };
+
+    for (auto& tree : reg.trees) {
+        tree->root.children.clear();
+        tree->current = &tree->root;
+    }
+}
+
+Opm::Profiler::detail::Node*
+Opm::Profiler::detail::enter(const Site& site)
+{
+    auto& tree = threadTree();
+    auto* parent = tree.current;
+
+    // Most scopes have few distinct children, and the same child tends to
+    // be entered repeatedly, so search from the most recently added one.
+    Node* node = nullptr;
+    for (auto child = parent->children.rbegin(); child != parent->children.rend(); ++child) {
+        if ((*child)->site == &site) {
+            node = child->get();
+            break;
+        }
+    }
+
+    if (node == nullptr) {
+        auto& child = parent->children.emplace_back(std::make_unique<Node>());
+        child->site = &site;
+        child->parent = parent;
+        node = child.get();
+    }
+
+    tree.current = node;
+
+    return node;
+}
+
+void Opm::Profiler::detail::leave(Node* node, const std::chrono::steady_clock::duration elapsed)
+{
+    node->calls += 1;
+    node->total += elapsed;
+
+    threadTree().current = node->parent;
+}
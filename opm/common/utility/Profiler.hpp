@@ -0,0 +1,123 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PROFILER_HPP
+#define OPM_PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace Opm::Profiler {
+
+/// Built-in hierarchical profiler.
+///
+/// Backend of the OPM_TIMEBLOCK family of macros (see TimingMacros.hpp)
+/// when the library is built with USE_OPM_PROFILER and without Tracy.
+/// Each thread aggregates the scopes it enters into a call tree, so the
+/// cost of a profiled scope is two clock readings and a short search
+/// among the children of the enclosing scope.  Profiling is off until
+/// enabled at runtime for one or more subsystems.
+///
+/// Call trees may be written while profiled threads are idle, or at
+/// program exit, either as JSON or in the Chrome trace event format.  In
+/// the latter, each scope is shown as a single event whose duration is the
+/// total time spent in that scope and whose position on the time line is
+/// arbitrary, i.e., as a flame graph.
+///
+/// Besides the functions below, profiling may be enabled through the
+/// environment: OPM_PROFILE holds the subsystems to profile, as a number,
+/// OPM_PROFILE_FILE the name of the file written at exit (default
+/// "opm_profile.json") and OPM_PROFILE_FORMAT either "json" (default) or
+/// "chrome".
+
+/// Output format of call trees.
+enum class Format { Json, ChromeTrace };
+
+/// Static description of a profiled scope.  One per use of the macros.
+struct Site
+{
+    /// Scope name.
+    const char* name{nullptr};
+
+    /// Subsystems (Opm::Subsystem::Bitfield) the scope belongs to.
+    std::uint8_t subsystems{0};
+};
+
+/// Profile scopes belonging to any of the given subsystems.  Zero disables
+/// profiling.
+void enable(std::uint8_t subsystems);
+
+/// Subsystems currently being profiled.
+std::uint8_t enabled();
+
+/// Write call trees of all threads to stream.
+void write(std::ostream& os, Format format);
+
+/// Write call trees of all threads to file at program exit.  Replaces any
+/// earlier request.
+void writeAtExit(const std::string& filename, Format format);
+
+/// Discard all call trees.  Profiled threads must be idle.
+void reset();
+
+namespace detail {
+
+    struct Node;
+
+    extern std::atomic<std::uint8_t> enabled_subsystems;
+
+    Node* enter(const Site& site);
+    void leave(Node* node, std::chrono::steady_clock::duration elapsed);
+
+} // namespace detail
+
+/// Profiled scope.  Times the lifetime of the object if its site belongs to
+/// a subsystem being profiled.
+class Scope
+{
+public:
+    explicit Scope(const Site& site)
+    {
+        if ((detail::enabled_subsystems.load(std::memory_order_relaxed) & site.subsystems) != 0) {
+            this->node_ = detail::enter(site);
+            this->start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~Scope()
+    {
+        if (this->node_ != nullptr) {
+            detail::leave(this->node_, std::chrono::steady_clock::now() - this->start_);
+        }
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    detail::Node* node_{nullptr};
+    std::chrono::steady_clock::time_point start_{};
+};
+
+} // namespace Opm::Profiler
+
+#endif // OPM_PROFILER_HPP
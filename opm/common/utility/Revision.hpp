@@ -0,0 +1,67 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_UTILITY_REVISION_HPP
+#define OPM_UTILITY_REVISION_HPP
+
+#include <cstddef>
+
+namespace Opm {
+
+/// Revision number of a container as a whole.
+///
+/// Containers which track changes to their contents record the revision
+/// at which each item last changed, and clients compare those against the
+/// revision at which they last looked.  All revision numbers are drawn from
+/// a single, process wide counter, so a number is never handed out twice,
+/// not even by different containers.
+///
+/// The revision of the container as a whole is a lower bound for the
+/// revisions of all of its items.  Copying or assigning a Revision yields
+/// a fresh number, since the contents of a copied container are new to
+/// anyone who looked at the target before.
+class Revision
+{
+public:
+    /// Fresh revision number, greater than all numbers handed out before.
+    /// Thread safe.
+    static std::size_t next();
+
+    Revision() : value_ { next() } {}
+    Revision(const Revision&) : value_ { next() } {}
+
+    Revision& operator=(const Revision&)
+    {
+        this->bump();
+        return *this;
+    }
+
+    /// Mark container as changed as a whole.
+    void bump() { this->value_ = next(); }
+
+    /// Revision of the last change to the container as a whole.
+    std::size_t value() const { return this->value_; }
+
+private:
+    std::size_t value_{};
+};
+
+} // namespace Opm
+
+#endif // OPM_UTILITY_REVISION_HPP
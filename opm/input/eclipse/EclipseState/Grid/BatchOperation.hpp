@@ -0,0 +1,220 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify it under the terms
+  of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  OPM is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along with
+  OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef BATCH_OPERATION_HPP
+#define BATCH_OPERATION_HPP
+
+#include <opm/input/eclipse/Deck/value_status.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/Box.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/TranCalculator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Opm { namespace Fieldprops { namespace batch {
+
+/// Minimum number of elements for which we split the work of a single
+/// operation between OpenMP threads.  Smaller ranges are processed
+/// serially.
+constexpr std::size_t parallel_threshold = 1 << 15;
+
+/// Half open range [begin, end) of data elements.
+struct IndexRange
+{
+    std::size_t begin{};
+    std::size_t end{};
+
+    std::size_t size() const { return this->end - this->begin; }
+};
+
+/// Detect whether or not an index list addresses a contiguous block of
+/// data elements.  This is the case for all whole-field operations and for
+/// slabs of full I/J layers, and enables the operation kernels to use
+/// direct rather than indirect addressing.
+///
+/// \param[in] index_list Cell index list, typically from Box::index_list(),
+///   Box::global_index_list(), or FieldProps::region_index().  Uses the
+///   active_index member which equals the global index in the case of
+///   global index lists.
+///
+/// \return Data range spanned by the index list, or nullopt if the index
+///   list is empty or non-contiguous.
+inline std::optional<IndexRange>
+contiguous_range(const std::vector<Box::cell_index>& index_list)
+{
+    if (index_list.empty()) {
+        return std::nullopt;
+    }
+
+    const auto begin = index_list.front().active_index;
+    const auto last  = index_list.back().active_index;
+
+    if ((last < begin) || (last - begin + 1 != index_list.size())) {
+        return std::nullopt;
+    }
+
+    const auto isContiguous =
+        std::all_of(index_list.begin(), index_list.end(),
+                    [begin, i = std::size_t{0}](const Box::cell_index& cell) mutable
+                    { return cell.active_index == begin + i++; });
+
+    if (!isContiguous) {
+        return std::nullopt;
+    }
+
+    return IndexRange { begin, last + 1 };
+}
+
+/// Single scalar operation--i.e., one record of ADD, EQUALS, MAXVALUE,
+/// MINVALUE, or MULTIPLY or their region based counterparts--in a fused
+/// sequence of operations.
+template <typename T>
+struct ScalarStep
+{
+    /// Kind of operation.
+    ScalarOperation op{};
+
+    /// Scalar operand, in SI units.
+    T value{};
+};
+
+namespace detail {
+
+    template <typename T>
+    T apply_one(const ScalarOperation op, const T x, const T value)
+    {
+        switch (op) {
+        case ScalarOperation::EQUAL: return value;
+        case ScalarOperation::MUL:   return x * value;
+        case ScalarOperation::ADD:   return x + value;
+        case ScalarOperation::MIN:   return std::max(x, value);
+        case ScalarOperation::MAX:   return std::min(x, value);
+        }
+
+        return x;
+    }
+
+    template <typename T, typename IndexOf>
+    void apply_steps(const std::vector<ScalarStep<T>>& steps,
+                     const std::size_t                 num_elements,
+                     IndexOf&&                         indexOf,
+                     std::vector<T>&                   data,
+                     std::vector<value::status>&       value_status,
+                     std::vector<std::size_t>&         num_uninit)
+    {
+        const auto num_steps = steps.size();
+        const auto n = static_cast<std::int64_t>(num_elements);
+
+#ifdef _OPENMP
+#pragma omp parallel if (num_elements >= parallel_threshold)
+#endif
+        {
+            auto local_uninit = std::vector<std::size_t>(num_steps, 0);
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (std::int64_t i = 0; i < n; ++i) {
+                const auto ix = indexOf(i);
+
+                auto x = data[ix];
+                auto st = value_status[ix];
+
+                for (std::size_t step = 0; step < num_steps; ++step) {
+                    const auto& [op, value] = steps[step];
+
+                    if (op == ScalarOperation::EQUAL) {
+                        x = value;
+                        st = value::status::deck_value;
+                    }
+                    else if (value::has_value(st)) {
+                        x = apply_one(op, x, value);
+                    }
+                    else {
+                        ++local_uninit[step];
+                    }
+                }
+
+                data[ix] = x;
+                value_status[ix] = st;
+            }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            for (std::size_t step = 0; step < num_steps; ++step) {
+                num_uninit[step] += local_uninit[step];
+            }
+        }
+    }
+
+} // namespace detail
+
+/// Apply a sequence of scalar operations to a data array in a single pass.
+///
+/// Equivalent to applying each operation in turn to all elements of the
+/// index list, but traverses the array only once.  Whole-field and
+/// contiguous slab index lists use direct addressing, enabling the
+/// compiler to vectorise the loop, and large ranges are split between
+/// OpenMP threads.
+///
+/// Operations other than EQUAL leave elements without a value untouched
+/// and count those elements instead.  The caller decides whether or not
+/// such elements constitute an error.
+///
+/// \param[in] steps Sequence of operations, in order of application.
+///
+/// \param[in,out] data Data array.
+///
+/// \param[in,out] value_status Value status of each element of \p data.
+///
+/// \param[in] index_list Elements of \p data to which to apply the
+///   operations.  Uses the active_index member of each element.
+///
+/// \return Number of elements without a value for each operation in \p
+///   steps.  Always zero for EQUAL operations.
+template <typename T>
+std::vector<std::size_t>
+apply_scalar(const std::vector<ScalarStep<T>>&   steps,
+             std::vector<T>&                     data,
+             std::vector<value::status>&         value_status,
+             const std::vector<Box::cell_index>& index_list)
+{
+    auto num_uninit = std::vector<std::size_t>(steps.size(), 0);
+
+    if (const auto range = contiguous_range(index_list); range.has_value()) {
+        detail::apply_steps(steps, range->size(),
+                            [begin = range->begin](const std::int64_t i)
+                            { return begin + static_cast<std::size_t>(i); },
+                            data, value_status, num_uninit);
+    }
+    else {
+        detail::apply_steps(steps, index_list.size(),
+                            [&index_list](const std::int64_t i)
+                            { return index_list[i].active_index; },
+                            data, value_status, num_uninit);
+    }
+
+    return num_uninit;
+}
+
+}}} // namespace Opm::Fieldprops::batch
+
+#endif // BATCH_OPERATION_HPP
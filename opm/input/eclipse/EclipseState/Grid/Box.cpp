@@ -25,6 +25,8 @@
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
 #include <opm/input/eclipse/Deck/DeckRecord.hpp>
 
+#include <array>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
@@ -75,6 +77,37 @@ namespace {
         value = item.get<int>(0) - 1;
         return false;
     }
+
+    /// Box bounds {I1, I2, J1, J2, K1, K2}, zero based, described by a
+    /// record of the BOX keyword or of a keyword with BOX-like items.
+    /// Nullopt if all bounds are defaulted, which means "keep the current
+    /// box".
+    std::optional<std::array<int, 6>>
+    record_bounds(const Opm::GridDims& gridDims, const Opm::DeckRecord& deckRecord)
+    {
+        using Kw = Opm::ParserKeywords::BOX;
+
+        auto default_count = 0;
+
+        auto bounds = std::array<int, 6> {
+            0, static_cast<int>(gridDims.getNX()) - 1,
+            0, static_cast<int>(gridDims.getNY()) - 1,
+            0, static_cast<int>(gridDims.getNZ()) - 1,
+        };
+
+        default_count += update_default(deckRecord.getItem<Kw::I1>(), bounds[0]);
+        default_count += update_default(deckRecord.getItem<Kw::I2>(), bounds[1]);
+        default_count += update_default(deckRecord.getItem<Kw::J1>(), bounds[2]);
+        default_count += update_default(deckRecord.getItem<Kw::J2>(), bounds[3]);
+        default_count += update_default(deckRecord.getItem<Kw::K1>(), bounds[4]);
+        default_count += update_default(deckRecord.getItem<Kw::K2>(), bounds[5]);
+
+        if (default_count == 6) {
+            return std::nullopt;
+        }
+
+        return bounds;
+    }
 }
 
 namespace Opm
@@ -104,28 +137,26 @@ namespace Opm
 
     void Box::update(const DeckRecord& deckRecord)
     {
-        auto default_count = 0;
-
-        int i1 = 0;
-        int i2 = this->m_globalGridDims_.getNX() - 1;
-        default_count += update_default(deckRecord.getItem<ParserKeywords::BOX::I1>(), i1);
-        default_count += update_default(deckRecord.getItem<ParserKeywords::BOX::I2>(), i2);
-
-        int j1 = 0;
-        int j2 = this->m_globalGridDims_.getNY() - 1;
-        default_count += update_default(deckRecord.getItem<ParserKeywords::BOX::J1>(), j1);
-        default_count += update_default(deckRecord.getItem<ParserKeywords::BOX::J2>(), j2);
-
-        int k1 = 0;
-        int k2 = this->m_globalGridDims_.getNZ() - 1;
-        default_count += update_default(deckRecord.getItem<ParserKeywords::BOX::K1>(), k1);
-        default_count += update_default(deckRecord.getItem<ParserKeywords::BOX::K2>(), k2);
+        const auto bounds = record_bounds(this->m_globalGridDims_, deckRecord);
 
-        if (default_count != 6) {
+        if (bounds.has_value()) {
+            const auto& [i1, i2, j1, j2, k1, k2] = *bounds;
             this->init(i1, i2, j1, j2, k1, k2);
         }
     }
 
+    bool Box::matches(const DeckRecord& deckRecord) const
+    {
+        const auto bounds = record_bounds(this->m_globalGridDims_, deckRecord);
+
+        return !bounds.has_value()
+            || (*bounds == std::array {
+                    this->I1(), this->I2(),
+                    this->J1(), this->J2(),
+                    this->K1(), this->K2()
+                });
+    }
+
     void Box::reset()
     {
         this->init(0, this->m_globalGridDims_.getNX() - 1,
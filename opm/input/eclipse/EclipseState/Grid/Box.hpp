@@ -75,6 +75,10 @@ namespace Opm
             int k1, int k2);
 
         void update(const DeckRecord& deckRecord);
+
+        /// Whether or not update(deckRecord) would leave the box unchanged.
+        /// Used to detect consecutive operations on the same cells.
+        bool matches(const DeckRecord& deckRecord) const;
         void reset();
 
         bool isGlobal() const;
@@ -47,6 +47,7 @@
 #include <opm/input/eclipse/Parser/ParserKeywords/P.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/T.hpp>
 
+#include "BatchOperation.hpp"
 #include "Operate.hpp"
 
 #include <algorithm>
@@ -407,133 +408,6 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
     }
 }
 
-template <typename T>
-void assign_scalar(std::vector<T>&                     data,
-                   std::vector<value::status>&         value_status,
-                   const T                             value,
-                   const std::vector<Box::cell_index>& index_list)
-{
-    for (const auto& cell_index : index_list) {
-        data[cell_index.active_index] = value;
-        value_status[cell_index.active_index] = value::status::deck_value;
-    }
-}
-
-template <typename T>
-void multiply_scalar(const KeywordLocation&              loc,
-                     std::string_view                    arrayName,
-                     std::vector<T>&                     data,
-                     std::vector<value::status>&         value_status,
-                     const T                             value,
-                     const std::vector<Box::cell_index>& index_list)
-{
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] *= value;
-        }
-        else {
-            ++unInit;
-        }
-    }
-
-    if (unInit > 0) {
-        reject_undefined_operation(loc, unInit,
-                                   index_list.size(),
-                                   "Multiplication", arrayName);
-    }
-}
-
-template <typename T>
-void add_scalar(const KeywordLocation&              loc,
-                std::string_view                    arrayName,
-                std::vector<T>&                     data,
-                std::vector<value::status>&         value_status,
-                const T                             value,
-                const std::vector<Box::cell_index>& index_list)
-{
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] += value;
-        }
-        else {
-            ++unInit;
-        }
-    }
-
-    if (unInit > 0) {
-        reject_undefined_operation(loc, unInit,
-                                   index_list.size(),
-                                   "Addition", arrayName);
-    }
-}
-
-template <typename T>
-void min_value(const KeywordLocation&              loc,
-               std::string_view                    arrayName,
-               std::vector<T>&                     data,
-               std::vector<value::status>&         value_status,
-               const T                             value,
-               const std::vector<Box::cell_index>& index_list)
-{
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] = std::max(data[ix], value);
-        }
-        else {
-            ++unInit;
-        }
-    }
-
-    if (unInit > 0) {
-        reject_undefined_operation(loc, unInit,
-                                   index_list.size(),
-                                   "Minimum threshold",
-                                   arrayName);
-    }
-}
-
-template <typename T>
-void max_value(const KeywordLocation&              loc,
-               std::string_view                    arrayName,
-               std::vector<T>&                     data,
-               std::vector<value::status>&         value_status,
-               const T                             value,
-               const std::vector<Box::cell_index>& index_list)
-{
-    auto unInit = 0;
-
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] = std::min(data[ix], value);
-        }
-        else {
-            ++unInit;
-        }
-    }
-
-    if (unInit > 0) {
-        reject_undefined_operation(loc, unInit,
-                                   index_list.size(),
-                                   "Maximum threshold",
-                                   arrayName);
-    }
-}
-
-
 template<typename T>
 void update_global_from_local(Fieldprops::FieldData<T>& data,
                               const std::vector<Box::cell_index>& index_list)
@@ -552,35 +426,14 @@ void update_global_from_local(Fieldprops::FieldData<T>& data,
     }
 }
 
-template <typename T>
-void apply(const Fieldprops::ScalarOperation   op,
-           const KeywordLocation&              loc,
-           std::string_view                    arrayName,
-           std::vector<T>&                     data,
-           std::vector<value::status>&         value_status,
-           const T                             scalar_value,
-           const std::vector<Box::cell_index>& index_list)
+std::string_view operation_description(const Fieldprops::ScalarOperation op)
 {
     switch (op) {
-    case Fieldprops::ScalarOperation::EQUAL:
-        assign_scalar(data, value_status, scalar_value, index_list);
-        return;
-
-    case Fieldprops::ScalarOperation::MUL:
-        multiply_scalar(loc, arrayName, data, value_status, scalar_value, index_list);
-        return;
-
-    case Fieldprops::ScalarOperation::ADD:
-        add_scalar(loc, arrayName, data, value_status, scalar_value, index_list);
-        return;
-
-    case Fieldprops::ScalarOperation::MIN:
-        min_value(loc, arrayName, data, value_status, scalar_value, index_list);
-        return;
-
-    case Fieldprops::ScalarOperation::MAX:
-        max_value(loc, arrayName, data, value_status, scalar_value, index_list);
-        return;
+    case Fieldprops::ScalarOperation::EQUAL: return "Assignment";
+    case Fieldprops::ScalarOperation::MUL:   return "Multiplication";
+    case Fieldprops::ScalarOperation::ADD:   return "Addition";
+    case Fieldprops::ScalarOperation::MIN:   return "Minimum threshold";
+    case Fieldprops::ScalarOperation::MAX:   return "Maximum threshold";
     }
 
     throw std::invalid_argument {
@@ -588,6 +441,27 @@ void apply(const Fieldprops::ScalarOperation   op,
     };
 }
 
+template <typename T>
+void apply(const std::vector<Fieldprops::batch::ScalarStep<T>>& steps,
+           const KeywordLocation&                               loc,
+           std::string_view                                     arrayName,
+           std::vector<T>&                                      data,
+           std::vector<value::status>&                          value_status,
+           const std::vector<Box::cell_index>&                  index_list)
+{
+    const auto num_uninit = Fieldprops::batch::
+        apply_scalar(steps, data, value_status, index_list);
+
+    for (auto step = 0*steps.size(); step < steps.size(); ++step) {
+        if (num_uninit[step] > 0) {
+            reject_undefined_operation(loc, num_uninit[step],
+                                       index_list.size(),
+                                       operation_description(steps[step].op),
+                                       arrayName);
+        }
+    }
+}
+
 std::string make_region_name(const std::string& deck_value)
 {
     if (deck_value == "O") { return "OPERNUM"; }
@@ -720,6 +594,8 @@ bool FieldProps::operator==(const FieldProps& other) const
         && (this->multregp == other.multregp)
         && (this->int_data == other.int_data)
         && (this->double_data == other.double_data)
+        && (this->deferred_int_data == other.deferred_int_data)
+        && (this->deferred_double_data == other.deferred_double_data)
         && (this->fipreg_shortname_translation == other.fipreg_shortname_translation)
         && (this->tran == other.tran)
         ;
@@ -754,6 +630,136 @@ bool FieldProps::rst_cmp(const FieldProps& full_arg, const FieldProps& rst_arg)
         ;
 }
 
+template <typename T>
+bool FieldProps::defer_deck_data(const Section                                section,
+                                 const Fieldprops::keywords::keyword_info<T>& kw_info,
+                                 const std::string&                           keyword_name,
+                                 const DeckKeyword&                           keyword,
+                                 const Box&                                   box)
+{
+    // Deferring is only safe for plain cell-wise data whose assignment does
+    // not affect other state.  In particular, multipliers accumulate or are
+    // stashed separately and global keywords are needed by the grid
+    // processing.  Arrays with on-demand defaults, e.g., PORV and the
+    // saturation function end-points, must not be created behind the back
+    // of init_get().
+    const auto deferrable_section =
+        (section == Section::GRID) || (section == Section::PROPS) ||
+        (section == Section::REGIONS) || (section == Section::SOLUTION);
+
+    if (!deferrable_section || kw_info.multiplier || kw_info.global || (kw_info.num_value != 1))
+    {
+        return false;
+    }
+
+    const auto name = std::is_same_v<T, double>
+        ? Fieldprops::keywords::get_keyword_from_alias(keyword_name)
+        : (Fieldprops::keywords::isFipxxx(keyword_name)
+           ? this->canonical_fipreg_name(keyword_name)
+           : keyword_name);
+
+    if ((name == ParserKeywords::PORV::keywordName) ||
+        (name == ParserKeywords::TEMPI::keywordName) ||
+        (name == ParserKeywords::ACTNUM::keywordName) ||
+        (name == "DEPTH") ||
+        (Fieldprops::keywords::PROPS::satfunc.count(name) == 1) ||
+        is_capillary_pressure(name) ||
+        Fieldprops::keywords::is_work(name) ||
+        (this->tran.find(name) != this->tran.end()))
+    {
+        return false;
+    }
+
+    // Report inconsistent data sizes while processing the input rather
+    // than on first use.
+    if constexpr (std::is_same_v<T, double>) {
+        verify_deck_data(kw_info, keyword, keyword.getRawDoubleData(), box);
+    }
+    else {
+        verify_deck_data(kw_info, keyword, keyword.getIntData(), box);
+    }
+
+    this->template deferred_deck_data<T>()[name].push_back({
+        std::make_shared<const DeckKeyword>(keyword), kw_info, section,
+        { box.I1(), box.I2(), box.J1(), box.J2(), box.K1(), box.K2() }
+    });
+
+    return true;
+}
+
+template <typename T>
+Fieldprops::FieldData<T>&
+FieldProps::apply_deferred(const std::string& keyword, Fieldprops::FieldData<T>& field_data)
+{
+    auto& deferred = this->template deferred_deck_data<T>();
+
+    auto pos = deferred.find(keyword);
+    if (pos == deferred.end()) {
+        return field_data;
+    }
+
+    const auto deferred_data = std::move(pos->second);
+    deferred.erase(pos);
+
+    // Assignment is element-wise, so assigning against the current set of
+    // active cells is equivalent to assigning when the keyword was read
+    // and compressing in any intervening reset_actnum() calls.
+    auto active_index = std::vector<std::size_t>(this->m_actnum.size(), 0);
+    for (auto g = 0*active_index.size(), ix = 0*g; g < active_index.size(); ++g) {
+        active_index[g] = ix;
+        ix += (this->m_actnum[g] != 0);
+    }
+
+    for (const auto& [keyword_ptr, kw_info, section, bounds] : deferred_data) {
+        const auto& deck_keyword = *keyword_ptr;
+        const auto box = Box {
+            GridDims { this->nx, this->ny, this->nz },
+            [this](const std::size_t global_index)
+            { return this->m_actnum[global_index] != 0; },
+            [&active_index](const std::size_t global_index)
+            { return active_index[global_index]; },
+            bounds[0], bounds[1], bounds[2], bounds[3], bounds[4], bounds[5]
+        };
+
+        if constexpr (std::is_same_v<T, double>) {
+            const auto& deck_data = deck_keyword.getSIDoubleData();
+
+            assign_deck(kw_info, deck_keyword, field_data, deck_data,
+                        deck_keyword.getValueStatus(), box);
+
+            if ((section == Section::GRID) && kw_info.top && !field_data.valid()) {
+                this->distribute_toplayer(field_data, deck_data, box);
+            }
+        }
+        else {
+            assign_deck(kw_info, deck_keyword, field_data, deck_keyword.getIntData(),
+                        deck_keyword.getValueStatus(), box);
+        }
+    }
+
+    return field_data;
+}
+
+template <>
+bool FieldProps::has<double>(const std::string& keyword_name) const
+{
+    const auto keyword = Fieldprops::keywords::get_keyword_from_alias(keyword_name);
+
+    return (this->double_data.find(keyword) != this->double_data.end())
+        || (this->deferred_double_data.find(keyword) != this->deferred_double_data.end());
+}
+
+template <>
+bool FieldProps::has<int>(const std::string& keyword) const
+{
+    const auto& kw = Fieldprops::keywords::isFipxxx(keyword)
+        ? this->canonical_fipreg_name(keyword)
+        : keyword;
+
+    return (this->int_data.find(kw) != this->int_data.end())
+        || (this->deferred_int_data.find(kw) != this->deferred_int_data.end());
+}
+
 // init_get methods have to be specialized before their instantiation in the
 // constructor below. Otherwise we get a compilation error.
 template <>
@@ -778,7 +784,7 @@ FieldProps::init_get(const std::string&                                keyword_n
         : this->double_data;
 
     if (auto iter = props.find(mult_keyword); iter != props.end()) {
-        return iter->second;
+        return this->apply_deferred(mult_keyword, iter->second);
     }
     else if (multiplier_in_edit) {
         assert(keyword != ParserKeywords::PORV::keywordName);
@@ -789,9 +795,16 @@ FieldProps::init_get(const std::string&                                keyword_n
         this->multiplier_kw_infos_.insert_or_assign(mult_keyword, kw_info);
     }
 
+    // Create property from its description at the time of deferral, if
+    // any, as would have happened had the deck data been assigned then.
+    const auto deferred = this->deferred_double_data.find(mult_keyword);
+    const auto& create_info = (deferred != this->deferred_double_data.end())
+        ? deferred->second.front().kw_info
+        : kw_info;
+
     const auto elmDescr = props
-        .try_emplace(mult_keyword, kw_info, this->active_size,
-                     kw_info.global ? this->global_size : std::size_t{0});
+        .try_emplace(mult_keyword, create_info, this->active_size,
+                     create_info.global ? this->global_size : std::size_t{0});
 
     auto& propData = elmDescr.first->second;
 
@@ -809,7 +822,7 @@ FieldProps::init_get(const std::string&                                keyword_n
         this->init_satfunc(keyword, propData);
     }
 
-    return propData;
+    return this->apply_deferred(mult_keyword, propData);
 }
 
 template <>
@@ -827,12 +840,19 @@ FieldProps::init_get(const std::string&                             keyword,
 {
     auto iter = this->int_data.find(keyword);
     if (iter != this->int_data.end()) {
-        return iter->second;
+        return this->apply_deferred(keyword, iter->second);
     }
 
-    return this->int_data
-        .try_emplace(keyword, kw_info, this->active_size,
-                     kw_info.global ? this->global_size : 0).first->second;
+    const auto deferred = this->deferred_int_data.find(keyword);
+    const auto& create_info = (deferred != this->deferred_int_data.end())
+        ? deferred->second.front().kw_info
+        : kw_info;
+
+    auto& field_data = this->int_data
+        .try_emplace(keyword, create_info, this->active_size,
+                     create_info.global ? this->global_size : 0).first->second;
+
+    return this->apply_deferred(keyword, field_data);
 }
 
 template <>
@@ -911,14 +931,13 @@ FieldProps::FieldProps(const Deck& deck,
     this->resetWorkArrays();
 
     // Update PVTNUM/SATNUM for numerical aquifer cells
-    {
-        const auto& aqcell_tabnums = grid.getAquiferCellTabnums();
+    if (const auto& aqcell_tabnums = grid.getAquiferCellTabnums(); !aqcell_tabnums.empty()) {
 
-        const bool has_pvtnum = this->int_data.count("PVTNUM") != 0;
-        const bool has_satnum = this->int_data.count("SATNUM") != 0;
+        const bool has_pvtnum = this->has<int>("PVTNUM");
+        const bool has_satnum = this->has<int>("SATNUM");
 
-        std::vector<int>* pvtnum = has_pvtnum ? &(this->int_data["PVTNUM"].data) : nullptr;
-        std::vector<int>* satnum = has_satnum ? &(this->int_data["SATNUM"].data) : nullptr;
+        std::vector<int>* pvtnum = has_pvtnum ? &(this->init_get<int>("PVTNUM").data) : nullptr;
+        std::vector<int>* satnum = has_satnum ? &(this->init_get<int>("SATNUM").data) : nullptr;
         for (const auto& [globCell, regionID] : aqcell_tabnums) {
             const auto aix = grid.activeIndex(globCell);
             if (has_pvtnum) { (*pvtnum)[aix] = std::max(regionID[0], (*pvtnum)[aix]); }
@@ -1148,24 +1167,6 @@ std::string FieldProps::region_name(const DeckItem& region_item) const
         : make_region_name(region_item.get<std::string>(0));
 }
 
-template <>
-bool FieldProps::has<double>(const std::string& keyword_name) const
-{
-    const auto keyword = Fieldprops::keywords::get_keyword_from_alias(keyword_name);
-
-    return this->double_data.find(keyword) != this->double_data.end();
-}
-
-template <>
-bool FieldProps::has<int>(const std::string& keyword) const
-{
-    const auto& kw = Fieldprops::keywords::isFipxxx(keyword)
-        ? this->canonical_fipreg_name(keyword)
-        : keyword;
-
-    return this->int_data.find(kw) != this->int_data.end();
-}
-
 void FieldProps::apply_multipliers()
 {
     // We need to manually search for PORV in the map here instead of using
@@ -1277,6 +1278,53 @@ void FieldProps::erase<double>(const std::string& keyword)
     this->double_data.erase(keyword);
 }
 
+template <>
+void FieldProps::release<int>(const std::string& keyword)
+{
+    const auto& kw = Fieldprops::keywords::isFipxxx(keyword)
+        ? this->canonical_fipreg_name(keyword)
+        : keyword;
+
+    this->int_data.erase(kw);
+    this->deferred_int_data.erase(kw);
+}
+
+template <>
+void FieldProps::release<double>(const std::string& keyword)
+{
+    const auto kw = Fieldprops::keywords::get_keyword_from_alias(keyword);
+
+    this->double_data.erase(kw);
+    this->deferred_double_data.erase(kw);
+}
+
+template <typename T>
+std::vector<const DeckKeyword*>
+FieldProps::deferred_keywords(const std::string& keyword) const
+{
+    auto keywords = std::vector<const DeckKeyword*>{};
+
+    const auto& deferred = this->template deferred_deck_data<T>();
+    if (auto pos = deferred.find(keyword); pos != deferred.end()) {
+        for (const auto& deferred_data : pos->second) {
+            keywords.push_back(deferred_data.keyword.get());
+        }
+    }
+
+    return keywords;
+}
+
+void FieldProps::materialise_deferred()
+{
+    while (!this->deferred_int_data.empty()) {
+        this->init_get<int>(this->deferred_int_data.begin()->first);
+    }
+
+    while (!this->deferred_double_data.empty()) {
+        this->init_get<double>(this->deferred_double_data.begin()->first);
+    }
+}
+
 template <>
 std::vector<int> FieldProps::extract<int>(const std::string& keyword)
 {
@@ -1329,10 +1377,15 @@ double FieldProps::getSIValue(const ScalarOperation op,
         : this->getSIValue(keyword, raw_value);
 }
 
-void FieldProps::handle_int_keyword(const Fieldprops::keywords::keyword_info<int>& kw_info,
+void FieldProps::handle_int_keyword(const Section section,
+                                    const Fieldprops::keywords::keyword_info<int>& kw_info,
                                     const DeckKeyword& keyword,
                                     const Box& box)
 {
+    if (this->defer_deck_data(section, kw_info, keyword.name(), keyword, box)) {
+        return;
+    }
+
     auto& field_data = this->init_get<int>(keyword.name());
 
     const auto& deck_data = keyword.getIntData();
@@ -1347,6 +1400,10 @@ void FieldProps::handle_double_keyword(const Section section,
                                        const std::string& keyword_name,
                                        const Box& box)
 {
+    if (this->defer_deck_data(section, kw_info, keyword_name, keyword, box)) {
+        return;
+    }
+
     // if second paramter is true then this will not be the actual keyword
     // but one prefixed with __MULT__ that will be used to construct the
     // multiplier for later application to the actual keyword.
@@ -1427,6 +1484,38 @@ void FieldProps::operate(const DeckRecord&                   record,
     const auto& from_data = global? *src_data.global_data : src_data.data;
     auto& from_status = global? *src_data.global_value_status : src_data.value_status;
 
+    if (const auto range = Fieldprops::batch::contiguous_range(index_list);
+        range.has_value())
+    {
+        // Whole-field or slab operation.  Validate the input first, then
+        // apply the operation in a single vectorised pass.
+        const auto begin = static_cast<std::ptrdiff_t>(range->begin);
+        const auto end   = static_cast<std::ptrdiff_t>(range->end);
+
+        const auto all_defined =
+            std::all_of(from_status.begin() + begin, from_status.begin() + end,
+                        [](const value::status st) { return value::has_value(st); })
+            && (!check_target ||
+                std::all_of(to_status.begin() + begin, to_status.begin() + end,
+                            [](const value::status st) { return value::has_value(st); }));
+
+        if (!all_defined) {
+            throw std::invalid_argument {
+                "Tried to use unset property value in "
+                "OPERATE/OPERATER keyword"
+            };
+        }
+
+        Operate::apply(func_name, alpha, beta, dstDim, srcDim,
+                       to_data.data() + begin, from_data.data() + begin,
+                       range->size());
+
+        std::copy(from_status.begin() + begin, from_status.begin() + end,
+                  to_status.begin() + begin);
+
+        return;
+    }
+
     for (const auto& cell_index : index_list) {
         // This is the global index if global is true and global storage is used.
         const auto ix = cell_index.active_index;
@@ -1658,9 +1747,56 @@ void FieldProps::handle_region_operation(const Section section,
 
     const auto operation = fromString(keyword.name());
 
-    for (const auto& record : keyword) {
-        const auto target_kw = Fieldprops::keywords::
+    auto targetArray = [](const DeckRecord& record)
+    {
+        return Fieldprops::keywords::
             get_keyword_from_alias(record.getItem(0).getTrimmedString(0));
+    };
+
+    auto regionValue = [](const DeckRecord& record)
+    {
+        return record.getItem("REGION_NUMBER").get<int>(0);
+    };
+
+    // Collect the operation of the current record along with those of all
+    // immediately following records which target the same array within
+    // the same region.  The whole sequence is then applied in a single
+    // pass over the region's cells.  Advances 'recordIx' to the last fused
+    // record.
+    auto fusedSteps = [this, &keyword, &targetArray, &regionValue, operation]
+        (std::size_t&       recordIx,
+         const std::string& target_kw,
+         const std::string& reg_name,
+         const int          region_value,
+         auto               scalarValue)
+    {
+        using T = decltype(scalarValue(keyword.getRecord(recordIx)));
+
+        auto steps = std::vector {
+            Fieldprops::batch::ScalarStep<T> {
+                operation, scalarValue(keyword.getRecord(recordIx))
+            }
+        };
+
+        while (recordIx + 1 < keyword.size()) {
+            const auto& next = keyword.getRecord(recordIx + 1);
+            if ((targetArray(next) != target_kw) ||
+                (regionValue(next) != region_value) ||
+                (this->region_name(next.getItem("REGION_NAME")) != reg_name))
+            {
+                break;
+            }
+
+            steps.push_back({ operation, scalarValue(next) });
+            ++recordIx;
+        }
+
+        return steps;
+    };
+
+    for (auto recordIx = 0*keyword.size(); recordIx < keyword.size(); ++recordIx) {
+        const auto& record = keyword.getRecord(recordIx);
+        const auto target_kw = targetArray(record);
 
         if (this->tran.find(target_kw) != this->tran.end()) {
             throw std::logic_error {
@@ -1669,7 +1805,7 @@ void FieldProps::handle_region_operation(const Section section,
             };
         }
 
-        const int region_value = record.getItem("REGION_NUMBER").get<int>(0);
+        const int region_value = regionValue(record);
 
         if (FieldProps::supported<double>(target_kw)) {
             auto& field_data = this->init_get<double>(target_kw);
@@ -1681,12 +1817,16 @@ void FieldProps::handle_region_operation(const Section section,
                 continue;
             }
 
-            const auto scalar_value =
-                this->getSIValue(operation, target_kw, record.getItem(1).get<double>(0));
+            const auto steps = fusedSteps(recordIx, target_kw, reg_name, region_value,
+                [this, operation, &target_kw](const DeckRecord& rec)
+            {
+                return this->getSIValue(operation, target_kw,
+                                        rec.getItem(1).get<double>(0));
+            });
 
-            apply(operation, keyword.location(), target_kw,
+            apply(steps, keyword.location(), target_kw,
                   field_data.data, field_data.value_status,
-                  scalar_value, index_list);
+                  index_list);
 
             if ((section == Section::EDIT) && (target_kw == "DEPTH")) {
                 this->depth_edited_ = true;
@@ -1724,12 +1864,15 @@ Note that this might cause problems for PINCH option 4 or 5 being ALL.)", target
                 continue;
             }
 
-            const auto scalar_value =
-                static_cast<int>(record.getItem(1).get<double>(0));
+            const auto steps = fusedSteps(recordIx, target_kw, reg_name, region_value,
+                [](const DeckRecord& rec)
+            {
+                return static_cast<int>(rec.getItem(1).get<double>(0));
+            });
 
-            apply(operation, keyword.location(), target_kw,
+            apply(steps, keyword.location(), target_kw,
                   field_data.data, field_data.value_status,
-                  scalar_value, index_list);
+                  index_list);
 
             continue;
         }
@@ -1846,9 +1989,43 @@ void FieldProps::handle_operation(const Section      section,
 
     std::unordered_map<std::string, std::string> tran_fields;
 
-    for (const auto& record : keyword) {
-        const auto target_kw = Fieldprops::keywords::
+    auto targetArray = [](const DeckRecord& record)
+    {
+        return Fieldprops::keywords::
             get_keyword_from_alias(record.getItem(0).getTrimmedString(0));
+    };
+
+    // Collect the operation of the current record along with those of all
+    // immediately following records which target the same array within
+    // the same box.  The whole sequence is then applied in a single pass
+    // over the array.  Advances 'recordIx' to the last fused record.
+    auto fusedSteps = [&keyword, &box, &targetArray, operation]
+        (std::size_t& recordIx, const std::string& target_kw, auto scalarValue)
+    {
+        using T = decltype(scalarValue(keyword.getRecord(recordIx)));
+
+        auto steps = std::vector {
+            Fieldprops::batch::ScalarStep<T> {
+                operation, scalarValue(keyword.getRecord(recordIx))
+            }
+        };
+
+        while (recordIx + 1 < keyword.size()) {
+            const auto& next = keyword.getRecord(recordIx + 1);
+            if ((targetArray(next) != target_kw) || !box.matches(next)) {
+                break;
+            }
+
+            steps.push_back({ operation, scalarValue(next) });
+            ++recordIx;
+        }
+
+        return steps;
+    };
+
+    for (auto recordIx = 0*keyword.size(); recordIx < keyword.size(); ++recordIx) {
+        const auto& record = keyword.getRecord(recordIx);
+        const auto target_kw = targetArray(record);
 
         box.update(record);
 
@@ -1884,7 +2061,7 @@ void FieldProps::handle_operation(const Section      section,
             }
             else if (mustExist && !kw_info.multiplier &&
                      !(editSect && (unique_name == ParserKeywords::PORV::keywordName)) &&
-                     (this->double_data.find(unique_name) == this->double_data.end()))
+                     !this->has<double>(unique_name))
             {
                 // Note exceptions for the MULT* arrays (i.e., MULT[XYZ] and
                 // MULT[XYZ]-).  We always support operating on defaulted
@@ -1899,32 +2076,36 @@ void FieldProps::handle_operation(const Section      section,
                 };
             }
 
-            const auto scalar_value = this->
-                getSIValue(operation, target_kw, record.getItem(1).get<double>(0));
+            const auto steps = fusedSteps(recordIx, target_kw,
+                [this, operation, &target_kw](const DeckRecord& rec)
+            {
+                return this->getSIValue(operation, target_kw,
+                                        rec.getItem(1).get<double>(0));
+            });
 
             auto& field_data = this->init_get<double>
                 (unique_name, kw_info, /* multiplier_in_edit =*/ editSect && kw_info.multiplier);
 
-            apply(operation, keyword.location(), target_kw,
+            apply(steps, keyword.location(), target_kw,
                   field_data.data, field_data.value_status,
-                  scalar_value, box.index_list());
+                  box.index_list());
 
             if (editSect && (target_kw == "DEPTH")) {
                 this->depth_edited_ = true;
             }
 
             if (field_data.global_data) {
-                apply(operation, keyword.location(), target_kw,
+                apply(steps, keyword.location(), target_kw,
                       *field_data.global_data,
                       *field_data.global_value_status,
-                      scalar_value, box.global_index_list());
+                      box.global_index_list());
             }
 
             continue;
         }
 
         if (FieldProps::supported<int>(target_kw)) {
-            if (mustExist && (this->int_data.find(target_kw) == this->int_data.end())) {
+            if (mustExist && !this->has<int>(target_kw)) {
                 throw OpmInputError {
                     fmt::format("Target array {} must already "
                                 "exist when operated upon in {}.",
@@ -1933,14 +2114,18 @@ void FieldProps::handle_operation(const Section      section,
                 };
             }
 
-            const auto scalar_value = static_cast<int>(record.getItem(1).get<double>(0));
+            const auto steps = fusedSteps(recordIx, target_kw,
+                [](const DeckRecord& rec)
+            {
+                return static_cast<int>(rec.getItem(1).get<double>(0));
+            });
 
             auto& field_data = this->init_get<int>(target_kw);
 
-            apply(operation, keyword.location(), target_kw,
+            apply(steps, keyword.location(), target_kw,
                   field_data.data,
                   field_data.value_status,
-                  scalar_value, box.index_list());
+                  box.index_list());
 
             continue;
         }
@@ -2071,9 +2256,19 @@ void FieldProps::init_tempi(Fieldprops::FieldData<double>& tempi)
         const auto& depth = this->init_get<double>("DEPTH").data;
         std::vector< double > tempi_values( this->active_size, 0 );
 
+        // One evaluator per EQLNUM region, created on first use.
+        auto evaluators = std::vector<std::optional<SimpleTable::EvaluatorHandle>>{};
         for (std::size_t active_index = 0; active_index < this->active_size; active_index++) {
-            const auto& table = rtempvd.getTable<RtempvdTable>(eqlnum[active_index] - 1);
-            tempi_values[active_index] = table.evaluate("Temperature", depth[active_index]);
+            const auto tableIdx = static_cast<std::size_t>(eqlnum[active_index] - 1);
+            if ((tableIdx >= evaluators.size()) || !evaluators[tableIdx].has_value()) {
+                // Throws for invalid region IDs.
+                const auto& table = rtempvd.getTable<RtempvdTable>(tableIdx);
+
+                evaluators.resize(std::max(evaluators.size(), tableIdx + 1));
+                evaluators[tableIdx].emplace(table.evaluator("Temperature"));
+            }
+
+            tempi_values[active_index] = (*evaluators[tableIdx])(depth[active_index]);
         }
 
         tempi.default_update(tempi_values);
@@ -2256,7 +2451,7 @@ void FieldProps::scanGRIDSection(const GRIDSection& grid_section)
         if (auto kwPos = Fieldprops::keywords::GRID::int_keywords.find(keyword.name());
             kwPos != Fieldprops::keywords::GRID::int_keywords.end())
         {
-            this->handle_int_keyword(kwPos->second, keyword, box);
+            this->handle_int_keyword(Section::GRID, kwPos->second, keyword, box);
             continue;
         }
 
@@ -2272,7 +2467,7 @@ void FieldProps::scanGRIDSectionOnlyACTNUM(const GRIDSection& grid_section)
         const std::string& name = keyword.name();
 
         if (name == "ACTNUM") {
-            this->handle_int_keyword(Fieldprops::keywords::GRID::int_keywords.at(name), keyword, box);
+            this->handle_int_keyword(Section::GRID, Fieldprops::keywords::GRID::int_keywords.at(name), keyword, box);
         }
         else if ((name == "EQUALS") || (Fieldprops::keywords::box_keywords.count(name) == 1)) {
             this->handle_keyword(Section::GRID, keyword, box);
@@ -2329,7 +2524,7 @@ void FieldProps::scanEDITSection(const EDITSection& edit_section)
         if (auto kwPos = Fieldprops::keywords::EDIT::int_keywords.find(name);
             kwPos != Fieldprops::keywords::EDIT::int_keywords.end())
         {
-            this->handle_int_keyword(kwPos->second, keyword, box);
+            this->handle_int_keyword(Section::EDIT, kwPos->second, keyword, box);
             continue;
         }
 
@@ -2378,7 +2573,7 @@ void FieldProps::scanPROPSSection(const PROPSSection& props_section)
         if (auto kwPos = Fieldprops::keywords::PROPS::int_keywords.find(name);
             kwPos != Fieldprops::keywords::PROPS::int_keywords.end())
         {
-            this->handle_int_keyword(kwPos->second, keyword, box);
+            this->handle_int_keyword(Section::PROPS, kwPos->second, keyword, box);
             continue;
         }
 
@@ -2396,14 +2591,14 @@ void FieldProps::scanREGIONSSection(const REGIONSSection& regions_section)
         if (auto kwPos = Fieldprops::keywords::REGIONS::int_keywords.find(name);
             kwPos != Fieldprops::keywords::REGIONS::int_keywords.end())
         {
-            this->handle_int_keyword(kwPos->second, keyword, box);
+            this->handle_int_keyword(Section::REGIONS, kwPos->second, keyword, box);
             continue;
         }
 
         if (Fieldprops::keywords::isFipxxx(name)) {
             auto kw_info = Fieldprops::keywords::keyword_info<int>{};
             kw_info.init(1);
-            this->handle_int_keyword(kw_info, keyword, box);
+            this->handle_int_keyword(Section::REGIONS, kw_info, keyword, box);
             continue;
         }
 
@@ -2554,6 +2749,8 @@ void FieldProps::set_active_indices(const std::vector<int>& indices)
 
 template std::vector<bool> FieldProps::defaulted<int>(const std::string& keyword);
 template std::vector<bool> FieldProps::defaulted<double>(const std::string& keyword);
+template std::vector<const DeckKeyword*> FieldProps::deferred_keywords<int>(const std::string&) const;
+template std::vector<const DeckKeyword*> FieldProps::deferred_keywords<double>(const std::string&) const;
 
 void FieldProps::resetWorkArrays()
 {
@@ -31,9 +31,11 @@
 
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/input/eclipse/Deck/DeckSection.hpp>
 #include <opm/input/eclipse/Deck/value_status.hpp>
 
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <map>
@@ -555,6 +557,43 @@ public:
     template <typename T>
     std::vector<std::string> keys() const;
 
+    /// Drop property array from internal cache.
+    ///
+    /// Intended for simulators which no longer need a property once they
+    /// have consumed it, e.g., when building their own cell-wise parameter
+    /// structures.  Also discards deck data of the property which has not
+    /// yet been materialised.  Subsequent requests for the property behave
+    /// as if the property had not been defined in the input.  References
+    /// to the property's data obtained before the call become invalid.
+    ///
+    /// \tparam T Property element type.  Typically \c double or \c int.
+    ///
+    /// \param[in] keyword Property name.
+    template <typename T>
+    void release(const std::string& keyword);
+
+    /// Materialise all properties whose deck data has not yet been
+    /// processed.
+    ///
+    /// Property keywords in the GRID, PROPS, REGIONS, and SOLUTION sections
+    /// which are plain cell-wise data--i.e., not multipliers, global, or
+    /// otherwise special cased--are not converted
+    /// to SI and assigned to the property array until the property is first
+    /// requested.  Operations which need a view of all properties, such as
+    /// keys<T>() and comparison, must call this function first.
+    void materialise_deferred();
+
+    /// Deck keywords of a property whose processing is deferred.
+    ///
+    /// Empty if the property has no deferred deck data.  Mainly intended
+    /// for testing.
+    ///
+    /// \tparam T Property element type.  Typically \c double or \c int.
+    ///
+    /// \param[in] keyword Property name.
+    template <typename T>
+    std::vector<const DeckKeyword*> deferred_keywords(const std::string& keyword) const;
+
     /// Request read-only property array from internal cache
     ///
     /// Will create property array if permitted and possible.
@@ -794,10 +833,77 @@ private:
                                const DeckKeyword& keyword,
                                const Box& box);
 
-    void handle_int_keyword(const Fieldprops::keywords::keyword_info<int>& kw_info,
+    void handle_int_keyword(Section section,
+                            const Fieldprops::keywords::keyword_info<int>& kw_info,
                             const DeckKeyword& keyword,
                             const Box& box);
 
+    /// Deck data of a property keyword whose processing is deferred until
+    /// the property is first requested.
+    template <typename T>
+    struct DeferredDeckData
+    {
+        /// Property keyword.  A copy, since we do not own the Deck.  Shared
+        /// between copies of the FieldProps object and never modified.
+        std::shared_ptr<const DeckKeyword> keyword{};
+
+        /// Property description at the time the keyword was processed.
+        Fieldprops::keywords::keyword_info<T> kw_info{};
+
+        /// Deck section in which the keyword appeared.
+        Section section{};
+
+        /// Zero-based bounds [I1, I2, J1, J2, K1, K2] of the box in effect
+        /// when the keyword was processed.
+        std::array<int, 6> bounds{};
+
+        bool operator==(const DeferredDeckData& that) const
+        {
+            return ((this->keyword == that.keyword) ||
+                    ((this->keyword != nullptr) && (that.keyword != nullptr) &&
+                     (*this->keyword == *that.keyword)))
+                && (this->kw_info == that.kw_info)
+                && (this->section == that.section)
+                && (this->bounds == that.bounds);
+        }
+    };
+
+    template <typename T>
+    using DeferredDeckMap = std::unordered_map<std::string, std::vector<DeferredDeckData<T>>>;
+
+    template <typename T>
+    DeferredDeckMap<T>& deferred_deck_data()
+    {
+        if constexpr (std::is_same_v<T, double>) {
+            return this->deferred_double_data;
+        }
+        else {
+            return this->deferred_int_data;
+        }
+    }
+
+    template <typename T>
+    const DeferredDeckMap<T>& deferred_deck_data() const
+    {
+        return const_cast<FieldProps*>(this)->template deferred_deck_data<T>();
+    }
+
+    /// Record property keyword for later processing if possible.
+    ///
+    /// \return Whether or not the keyword was deferred.  If not, the caller
+    /// must process the keyword immediately.
+    template <typename T>
+    bool defer_deck_data(Section section,
+                         const Fieldprops::keywords::keyword_info<T>& kw_info,
+                         const std::string& keyword_name,
+                         const DeckKeyword& keyword,
+                         const Box& box);
+
+    /// Assign all deferred deck data of a single property.
+    template <typename T>
+    Fieldprops::FieldData<T>&
+    apply_deferred(const std::string& keyword, Fieldprops::FieldData<T>& field_data);
+
     void init_satfunc(const std::string& keyword, Fieldprops::FieldData<double>& satfunc);
     void init_porv(Fieldprops::FieldData<double>& porv);
     void init_tempi(Fieldprops::FieldData<double>& tempi);
@@ -836,6 +942,12 @@ private:
     std::unordered_map<std::string, Fieldprops::FieldData<double>> double_data;
     std::unordered_map<std::string, std::string> fipreg_shortname_translation{};
 
+    /// Property keywords not yet assigned to int_data/double_data.
+    ///
+    /// Keyed by property name.  Elements applied in order on first request.
+    DeferredDeckMap<int> deferred_int_data{};
+    DeferredDeckMap<double> deferred_double_data{};
+
     /// Backing store for intermediate WORK<n> arrays.
     ///
     /// Cleared at end of each section.
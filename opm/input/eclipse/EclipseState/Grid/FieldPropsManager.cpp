@@ -85,11 +85,15 @@ namespace {
 namespace Opm {
 
 bool FieldPropsManager::operator==(const FieldPropsManager& other) const {
+    this->fp->materialise_deferred();
+    other.fp->materialise_deferred();
     return *this->fp == *other.fp;
 }
 
 bool FieldPropsManager::rst_cmp(const FieldPropsManager& full_arg, const FieldPropsManager& rst_arg)
 {
+    full_arg.fp->materialise_deferred();
+    rst_arg.fp->materialise_deferred();
     return FieldProps::rst_cmp(*full_arg.fp, *rst_arg.fp);
 }
 
@@ -178,6 +182,11 @@ bool FieldPropsManager::has(const std::string& keyword) const {
     return data.valid();
 }
 
+template <typename T>
+void FieldPropsManager::release(const std::string& keyword) {
+    this->fp->release<T>(keyword);
+}
+
 template <typename T>
 std::vector<bool> FieldPropsManager::defaulted(const std::string& keyword) const {
     return this->fp->defaulted<T>(keyword);
@@ -190,11 +199,13 @@ const std::string& FieldPropsManager::default_region() const {
 
 template <typename T>
 std::vector<std::string> FieldPropsManager::keys() const {
+    this->fp->materialise_deferred();
     return this->fp->keys<T>();
 }
 
 std::vector<std::string> FieldPropsManager::fip_regions() const
 {
+    this->fp->materialise_deferred();
     return this->fp->fip_regions();
 }
 
@@ -322,6 +333,9 @@ template bool FieldPropsManager::supported<double>(const std::string&);
 template bool FieldPropsManager::has<int>(const std::string&) const;
 template bool FieldPropsManager::has<double>(const std::string&) const;
 
+template void FieldPropsManager::release<int>(const std::string&);
+template void FieldPropsManager::release<double>(const std::string&);
+
 template std::vector<bool> FieldPropsManager::defaulted<int>(const std::string&) const;
 template std::vector<bool> FieldPropsManager::defaulted<double>(const std::string&) const;
 
@@ -194,6 +194,18 @@ public:
     virtual bool has_int(const std::string& keyword) const { return this->has<int>(keyword); }
     virtual bool has_double(const std::string& keyword) const { return this->has<double>(keyword); }
 
+    /*
+      Keyword data from the deck is only converted to SI units and stored
+      in the container when the keyword is first requested. Once the
+      simulator has consumed a keyword it can drop it from the container
+      with release(). Subsequent requests behave as if the keyword was not
+      present in the deck, and references previously returned from get()
+      become invalid. Observe that all copies of a FieldPropsManager share
+      the same underlying container.
+    */
+    template <typename T>
+    void release(const std::string& keyword);
+
     bool depth_edited() const;
 
     /*
@@ -17,8 +17,12 @@
 */
 #include "Operate.hpp"
 
+#include <opm/input/eclipse/Units/Dimension.hpp>
+
 #include <cmath>
+#include <cstdint>
 #include <map>
+#include <stdexcept>
 #include <string>
 
 namespace Opm {
@@ -120,6 +124,55 @@ namespace {
                                                             {"MULTP", &MULTP},
                                                             {"ABS", &ABS},
                                                             {"MULTIPLY", &MULTIPLY}};
+
+    template <func4 F>
+    void apply_kernel(const double alpha, const double beta,
+                      const Dimension& targetDim, const Dimension& sourceDim,
+                      double* target, const double* source, const std::size_t size)
+    {
+        const auto tgtFactor = targetDim.getSIScaling();
+        const auto tgtOffset = targetDim.getSIOffset();
+        const auto srcFactor = sourceDim.getSIScaling();
+        const auto srcOffset = sourceDim.getSIOffset();
+
+        if (!std::isfinite(tgtFactor) || !std::isfinite(srcFactor)) {
+            throw std::logic_error {
+                "The OPERATE keyword cannot be applied to arrays "
+                "with context dependent units"
+            };
+        }
+
+        const auto n = static_cast<std::int64_t>(size);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (size >= (std::size_t{1} << 15))
+#endif
+        for (std::int64_t i = 0; i < n; ++i) {
+            // Same sequence of operations as Dimension::convertSiToRaw()
+            // and Dimension::convertRawToSi() for bitwise identical
+            // results.
+            const auto R = (target[i] - tgtOffset) / tgtFactor;
+            const auto X = (source[i] - srcOffset) / srcFactor;
+
+            target[i] = F(R, X, alpha, beta)*tgtFactor + tgtOffset;
+        }
+    }
+
+    using kernel = decltype(&apply_kernel<&MULTA>);
+    static const std::map<std::string, kernel> kernels = {{"MULTA", &apply_kernel<&MULTA>},
+                                                          {"POLY", &apply_kernel<&POLY>},
+                                                          {"SLOG", &apply_kernel<&SLOG>},
+                                                          {"LOG10", &apply_kernel<&LOG10>},
+                                                          {"LOGE", &apply_kernel<&LOGE>},
+                                                          {"INV", &apply_kernel<&INV>},
+                                                          {"MULTX", &apply_kernel<&MULTX>},
+                                                          {"ADDX", &apply_kernel<&ADDX>},
+                                                          {"COPY", &apply_kernel<&COPY>},
+                                                          {"MAXLIM", &apply_kernel<&MAXLIM>},
+                                                          {"MINLIM", &apply_kernel<&MINLIM>},
+                                                          {"MULTP", &apply_kernel<&MULTP>},
+                                                          {"ABS", &apply_kernel<&ABS>},
+                                                          {"MULTIPLY", &apply_kernel<&MULTIPLY>}};
 }
 
 function get(const std::string& func, double alpha, double beta) {
@@ -131,5 +184,12 @@ function get(const std::string& func, double alpha, double beta) {
            };
 }
 
+void apply(const std::string& func, const double alpha, const double beta,
+           const Dimension& targetDim, const Dimension& sourceDim,
+           double* target, const double* source, const std::size_t size)
+{
+    kernels.at(func)(alpha, beta, targetDim, sourceDim, target, source, size);
+}
+
 }
 }
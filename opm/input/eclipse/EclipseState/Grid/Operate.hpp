@@ -18,9 +18,14 @@
 #ifndef OPERATE_HPP
 #define OPERATE_HPP
 
+#include <cstddef>
 #include <functional>
 #include <string>
 
+namespace Opm {
+    class Dimension;
+}
+
 namespace Opm {
 namespace Operate {
 
@@ -29,6 +34,17 @@ using function = std::function<double(double,double)>;
 
 function get(const std::string& func, double alpha, double beta);
 
+// Apply the operation 'func' to 'size' contiguous elements, i.e.,
+// target[i] = func(target[i], source[i]).  Values are converted from SI to
+// input units before evaluating the operation and the result is converted
+// back to SI.  Same result as calling get(func, alpha, beta) per element,
+// but the operation is inlined into the loop which is then vectorised and,
+// for large arrays, split between OpenMP threads.  The 'target' and
+// 'source' arrays may be the same.
+void apply(const std::string& func, double alpha, double beta,
+           const Dimension& targetDim, const Dimension& sourceDim,
+           double* target, const double* source, std::size_t size);
+
 }
 }
 #endif
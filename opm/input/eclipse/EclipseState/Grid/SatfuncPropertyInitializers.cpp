@@ -40,11 +40,14 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -1426,30 +1429,6 @@ namespace {
         }
     }
 
-    double selectValue(const Opm::TableContainer& depthTables,
-                       int tableIdx,
-                       const std::string& columnName,
-                       double cellDepth,
-                       double fallbackValue,
-                       bool useOneMinusTableValue)
-    {
-        if( tableIdx < 0 ) return fallbackValue;
-
-        const auto& table = depthTables.getTable( tableIdx );
-
-        if( tableIdx >= int( depthTables.size() ) )
-            throw std::invalid_argument("Not enough tables!");
-
-        // evaluate the table at the cell depth
-        const double value = table.evaluate( columnName, cellDepth );
-
-        // a column can be fully defaulted. In this case, eval() returns a NaN
-        // and we have to use the data from saturation tables
-        if( !std::isfinite( value ) ) return fallbackValue;
-        if( useOneMinusTableValue ) return 1 - value;
-        return value;
-    }
-
     void checkSatRegions(const std::size_t  cellIdx,
                          const int          satfunc,
                          const int          endfunc,
@@ -1465,6 +1444,90 @@ namespace {
         }
     }
 
+    std::vector<double>
+    regionApply(const std::size_t          size,
+                const std::string&         satregname,
+                const std::string&         columnName,
+                const std::vector<double>& fallbackValues,
+                const bool                 useDepthTables,
+                const Opm::TableContainer& depthTables,
+                const std::vector<double>& cell_depth,
+                const std::vector<int>&    satreg_data,
+                const std::vector<int>&    endnum_data,
+                const bool                 useOneMinusTableValue)
+    {
+        // Validate the region indices and bind the depth table evaluators
+        // of each end-point region in use.  Done serially, in cell order,
+        // in order to report the same errors as a cell-by-cell evaluation.
+        auto evaluators = std::vector<std::optional<Opm::SimpleTable::EvaluatorHandle>>{};
+
+        for (auto cellIdx = 0*size; cellIdx < size; ++cellIdx) {
+            const int satTableIdx = satreg_data[cellIdx] - 1;
+            const int endNum = endnum_data[cellIdx] - 1;
+
+            // Active cell better have {SAT,IMB,END}NUM > 0.
+            checkSatRegions(cellIdx, satTableIdx, endNum, satregname);
+
+            if (! useDepthTables) {
+                continue;
+            }
+
+            if (static_cast<std::size_t>(endNum) >= evaluators.size()) {
+                evaluators.resize(endNum + 1);
+            }
+
+            if (evaluators[endNum].has_value()) {
+                continue;
+            }
+
+            const auto& table = depthTables.getTable(endNum);
+
+            if (endNum >= int(depthTables.size())) {
+                throw std::invalid_argument("Not enough tables!");
+            }
+
+            evaluators[endNum].emplace(table.evaluator(columnName));
+        }
+
+        auto values = std::vector<double>(size, 0.0);
+        const auto n = static_cast<std::int64_t>(size);
+
+        if (! useDepthTables) {
+            // Common case.  Plain gather of per-region values.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (std::int64_t cellIdx = 0; cellIdx < n; ++cellIdx) {
+                values[cellIdx] = fallbackValues[satreg_data[cellIdx] - 1];
+            }
+
+            return values;
+        }
+
+        // Each thread gets its own copy of the evaluators since those track
+        // the most recently used table interval.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) firstprivate(evaluators)
+#endif
+        for (std::int64_t cellIdx = 0; cellIdx < n; ++cellIdx) {
+            auto& evaluator = *evaluators[endnum_data[cellIdx] - 1];
+
+            // Evaluate the table at the cell depth.  A column can be fully
+            // defaulted.  In this case, the evaluator returns a NaN and we
+            // have to use the data from saturation tables.
+            const double value = evaluator(cell_depth[cellIdx]);
+
+            if (! std::isfinite(value)) {
+                values[cellIdx] = fallbackValues[satreg_data[cellIdx] - 1];
+            }
+            else {
+                values[cellIdx] = useOneMinusTableValue ? 1 - value : value;
+            }
+        }
+
+        return values;
+    }
+
     std::vector<double>
     satnumApply(std::size_t size,
                 const std::string& columnName,
@@ -1475,31 +1538,11 @@ namespace {
                 const std::vector<int>& endnum_data,
                 bool useOneMinusTableValue)
     {
-        std::vector< double > values( size, 0 );
-
-        // Actually assign the defaults. If the ENPVD keyword was specified in the deck,
-        // this currently cannot be done because we would need the Z-coordinate of the
-        // cell and we would need to know how the simulator wants to interpolate between
-        // sampling points. Both of these are outside the scope of opm-parser, so we just
-        // assign a NaN in this case...
-        const bool useEnptvd = tableManager.useEnptvd();
-        const auto& enptvdTables = tableManager.getEnptvdTables();
-        for( std::size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
-            int satTableIdx = satnum_data[cellIdx] - 1;
-            int endNum = endnum_data[cellIdx] - 1;
-
-            // Active cell better have {SAT,END}NUM > 0.
-            checkSatRegions(cellIdx, satTableIdx, endNum, "SATNUM");
-
-            values[cellIdx] = selectValue(enptvdTables,
-                                          (useEnptvd && endNum >= 0) ? endNum : -1,
-                                          columnName,
-                                          cell_depth[cellIdx],
-                                          fallbackValues[ satTableIdx ],
-                                          useOneMinusTableValue);
-        }
-
-        return values;
+        return regionApply(size, "SATNUM", columnName, fallbackValues,
+                           tableManager.useEnptvd(),
+                           tableManager.getEnptvdTables(),
+                           cell_depth, satnum_data, endnum_data,
+                           useOneMinusTableValue);
     }
 
     std::vector<double>
@@ -1512,31 +1555,11 @@ namespace {
                 const std::vector<int>& endnum_data,
                 bool useOneMinusTableValue )
     {
-        std::vector< double > values( size, 0 );
-
-        // Actually assign the defaults. if the ENPVD keyword was specified in the deck,
-        // this currently cannot be done because we would need the Z-coordinate of the
-        // cell and we would need to know how the simulator wants to interpolate between
-        // sampling points. Both of these are outside the scope of opm-parser, so we just
-        // assign a NaN in this case...
-        const bool useImptvd = tableManager.useImptvd();
-        const Opm::TableContainer& imptvdTables = tableManager.getImptvdTables();
-        for( std::size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
-            int imbTableIdx = imbnum_data[ cellIdx ] - 1;
-            int endNum = endnum_data[ cellIdx ] - 1;
-
-            // Active cell better have {IMB,END}NUM > 0.
-            checkSatRegions(cellIdx, imbTableIdx, endNum, "IMBNUM");
-
-            values[cellIdx] = selectValue(imptvdTables,
-                                          (useImptvd && endNum >= 0) ? endNum : -1,
-                                          columnName,
-                                          cell_depth[cellIdx],
-                                          fallBackValues[imbTableIdx],
-                                          useOneMinusTableValue);
-        }
-
-        return values;
+        return regionApply(size, "IMBNUM", columnName, fallBackValues,
+                           tableManager.useImptvd(),
+                           tableManager.getImptvdTables(),
+                           cell_depth, imbnum_data, endnum_data,
+                           useOneMinusTableValue);
     }
 
     std::vector<double>
@@ -23,9 +23,13 @@
 
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -207,6 +211,138 @@ namespace Opm {
         return this->getColumn(columnName).eval(index);
     }
 
+    SimpleTable::EvaluatorHandle
+    SimpleTable::evaluator(const std::string& columnName) const
+    {
+        return { this->getColumn(0), this->getColumn(columnName) };
+    }
+
+    SimpleTable::EvaluatorHandle
+    SimpleTable::evaluator(const std::string& xColumnName,
+                           const std::string& yColumnName) const
+    {
+        return { this->getColumn(xColumnName), this->getColumn(yColumnName) };
+    }
+
+    SimpleTable::EvaluatorHandle::EvaluatorHandle(const TableColumn& xColumn,
+                                                  const TableColumn& yColumn)
+    {
+        // Raise exceptions for columns which do not support lookup here,
+        // rather than on first evaluation.
+        static_cast<void>(xColumn.lookup(0.0));
+
+        this->x_ = &*xColumn.begin();
+        this->y_ = &*yColumn.begin();
+        this->size_ = xColumn.size();
+        this->minIndex_ = std::min_element(xColumn.begin(), xColumn.end()) - xColumn.begin();
+        this->maxIndex_ = std::max_element(xColumn.begin(), xColumn.end()) - xColumn.begin();
+        this->descending_ = this->x_[0] > this->x_[this->size_ - 1];
+    }
+
+    double SimpleTable::EvaluatorHandle::operator()(const double xPos)
+    {
+        const auto [i, weight1] = this->locate(xPos);
+
+        double value = this->y_[i] * weight1;
+        if (weight1 < 1.0) {
+            value += (1 - weight1) * this->y_[i + 1];
+        }
+
+        return value;
+    }
+
+    void SimpleTable::EvaluatorHandle::operator()(std::span<const double> xPos,
+                                                  std::span<double>       yVal)
+    {
+        if (xPos.size() != yVal.size()) {
+            throw std::invalid_argument {
+                fmt::format("Table evaluation at {} positions "
+                            "cannot produce {} values",
+                            xPos.size(), yVal.size())
+            };
+        }
+
+        constexpr auto blockSize = std::size_t{64};
+
+        auto index = std::array<std::size_t, blockSize>{};
+        auto weight = std::array<double, blockSize>{};
+
+        for (auto begin = 0*xPos.size(); begin < xPos.size(); begin += blockSize) {
+            const auto n = std::min(blockSize, xPos.size() - begin);
+
+            for (auto k = 0*n; k < n; ++k) {
+                std::tie(index[k], weight[k]) = this->locate(xPos[begin + k]);
+            }
+
+            for (auto k = 0*n; k < n; ++k) {
+                double value = this->y_[index[k]] * weight[k];
+                if (weight[k] < 1.0) {
+                    value += (1 - weight[k]) * this->y_[index[k] + 1];
+                }
+
+                yVal[begin + k] = value;
+            }
+        }
+    }
+
+    std::pair<std::size_t, double>
+    SimpleTable::EvaluatorHandle::locate(const double xPos)
+    {
+        // Constant extrapolation outside the table range.
+        if (xPos >= this->x_[this->maxIndex_]) {
+            return { this->maxIndex_, 1.0 };
+        }
+
+        if (xPos <= this->x_[this->minIndex_]) {
+            return { this->minIndex_, 1.0 };
+        }
+
+        if (std::isnan(xPos)) {
+            // TableColumn::lookup() produces a NaN weight, and therefore a
+            // NaN result, in this case.
+            return { this->minIndex_, xPos };
+        }
+
+        const auto i = this->interval(xPos);
+
+        return { i, 1 - (xPos - this->x_[i]) / (this->x_[i + 1] - this->x_[i]) };
+    }
+
+    std::size_t SimpleTable::EvaluatorHandle::interval(const double xPos)
+    {
+        // Interval 'i' contains xPos if x_[i] < xPos <= x_[i + 1] for
+        // increasing columns and if x_[i] >= xPos > x_[i + 1] for decreasing
+        // columns.  This is the interval identified by the binary search in
+        // TableColumn::lookup(), also for columns with repeated values.
+        auto contains = [this, xPos](const std::size_t i)
+        {
+            return this->descending_
+                ? (this->x_[i] >= xPos) && (xPos > this->x_[i + 1])
+                : (this->x_[i] < xPos) && (xPos <= this->x_[i + 1]);
+        };
+
+        if (contains(this->hint_)) {
+            return this->hint_;
+        }
+
+        if ((this->hint_ + 2 < this->size_) && contains(this->hint_ + 1)) {
+            return ++this->hint_;
+        }
+
+        if ((this->hint_ > 0) && contains(this->hint_ - 1)) {
+            return --this->hint_;
+        }
+
+        const auto* end = this->x_ + this->size_;
+        const auto* pos = this->descending_
+            ? std::partition_point(this->x_, end, [xPos](const double x) { return x >= xPos; })
+            : std::partition_point(this->x_, end, [xPos](const double x) { return x < xPos; });
+
+        this->hint_ = static_cast<std::size_t>(pos - this->x_) - 1;
+
+        return this->hint_;
+    }
+
     void SimpleTable::assertJFuncPressure(const bool jf) const
     {
         if (jf == this->m_jfunc) {
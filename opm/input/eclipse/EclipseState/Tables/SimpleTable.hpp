@@ -26,7 +26,9 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -36,6 +38,53 @@ namespace Opm {
     class SimpleTable {
 
     public:
+        /*!
+         * \brief Repeated evaluation of one table column at varying positions.
+         *
+         * Binds the argument and result columns once instead of looking up
+         * the result column by name on every call, and starts each interval
+         * search in the interval found by the previous call.  This makes
+         * evaluation at monotone or clustered positions, e.g., cell depths
+         * of a grid column, essentially constant time.  Results are
+         * identical to those of SimpleTable::evaluate().
+         *
+         * The handle refers to the table's data and must not outlive the
+         * table.  Copies have independent search hints, so use one copy per
+         * thread.
+         */
+        class EvaluatorHandle {
+        public:
+            /// Throws the same exceptions as TableColumn::lookup() if
+            /// xColumn does not support argument lookup.
+            EvaluatorHandle(const TableColumn& xColumn, const TableColumn& yColumn);
+
+            /// Evaluate result column at a single position.
+            double operator()(double xPos);
+
+            /// Evaluate result column at a sequence of positions.
+            ///
+            /// Separates the interval search from the interpolation so that
+            /// the latter may be vectorised.  Throws std::invalid_argument
+            /// unless the sizes of xPos and yVal match.
+            void operator()(std::span<const double> xPos, std::span<double> yVal);
+
+        private:
+            const double* x_{nullptr};
+            const double* y_{nullptr};
+            std::size_t size_{0};
+            std::size_t minIndex_{0};
+            std::size_t maxIndex_{0};
+            bool descending_{false};
+            std::size_t hint_{0};
+
+            /// Interval index and weight of left end-point.  Equivalent to
+            /// TableColumn::lookup().
+            std::pair<std::size_t, double> locate(double xPos);
+
+            /// Interval index, for xPos strictly inside the column's range.
+            std::size_t interval(double xPos);
+        };
+
         SimpleTable() = default;
         SimpleTable(TableSchema, const std::string& tableName, const DeckItem& deckItem, const int tableID);
         explicit SimpleTable( TableSchema );
@@ -74,6 +123,20 @@ namespace Opm {
          */
         double evaluate(const std::string& columnName, double xPos) const;
 
+        /*!
+         * \brief Create handle for repeated evaluation of a column.
+         *
+         * Uses the first column as the X coordinate, like evaluate().
+         */
+        EvaluatorHandle evaluator(const std::string& columnName) const;
+
+        /*!
+         * \brief Create handle for repeated evaluation of a column using an
+         * arbitrary, ordered, column as the X coordinate.
+         */
+        EvaluatorHandle evaluator(const std::string& xColumnName,
+                                  const std::string& yColumnName) const;
+
         /// throws std::invalid_argument if jf != m_jfunc
         void assertJFuncPressure(const bool jf) const;
 
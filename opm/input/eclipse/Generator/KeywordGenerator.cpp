@@ -23,14 +23,20 @@
 
 #include <opm/json/JsonObject.hpp>
 
+#include <opm/input/eclipse/Parser/BuiltinKeywordIndex.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 
+#include <algorithm>
 #include <cctype>
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
 #include <map>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -210,11 +216,58 @@ void Builtin::emplace{}() const
                                             const std::string& sourcePath) const
     {
         std::filesystem::path parserInitSource(sourceFile);
+
+        // Keywords are numbered consecutively in loader order.  Keywords
+        // which match deck names by regular expression, code keywords,
+        // and keywords which share deck names with other keywords are
+        // added to the Parser up front, in order, to preserve the exact
+        // effect of adding all keywords.  All others are constructed on
+        // first use through a perfect hash index of their deck names.
+        auto deck_name_count = std::map<std::string, std::size_t>{};
+        for (const auto& [first_char, keywords] : loader) {
+            for (const auto& kw : keywords) {
+                for (const auto& deck_name : kw.deck_names()) {
+                    ++deck_name_count[deck_name];
+                }
+            }
+        }
+
+        auto num_keywords = std::size_t{0};
+        auto eager = std::vector<std::size_t>{};
+        auto index_names = std::vector<std::string>{};
+        auto index_keywords = std::vector<std::size_t>{};
+        auto letters = std::vector<std::pair<char, std::size_t>>{};
+
+        for (const auto& [first_char, keywords] : loader) {
+            letters.emplace_back(first_char, num_keywords);
+
+            for (const auto& kw : keywords) {
+                const auto shared = std::any_of(kw.deck_names().begin(), kw.deck_names().end(),
+                                                [&deck_name_count](const std::string& deck_name)
+                                                { return deck_name_count[deck_name] > 1; });
+
+                if (shared || kw.hasMatchRegex() || kw.isCodeKeyword()) {
+                    eager.push_back(num_keywords);
+                }
+                else {
+                    for (const auto& deck_name : kw.deck_names()) {
+                        index_names.push_back(deck_name);
+                        index_keywords.push_back(num_keywords);
+                    }
+                }
+
+                ++num_keywords;
+            }
+        }
+
+        const auto layout = BuiltinKeywordIndex::layout(index_names);
+
         std::stringstream newSource;
         newSource << R"(// Generated code.  Please do not edit this file directly.
 
-#include <opm/input/eclipse/Parser/Parser.hpp>
-#include <opm/input/eclipse/Parser/ParserKeywords/Builtin.hpp>
+#include <opm/input/eclipse/Parser/BuiltinKeywordIndex.hpp>
+#include <opm/input/eclipse/Parser/ParserKeyword.hpp>
+
 )";
 
         for (const auto& [first_char, keywords] : loader) {
@@ -223,10 +276,12 @@ void Builtin::emplace{}() const
 
 // Generated code.  Please do not edit this file directly.
 
-namespace Opm {{ class Parser; }}
+#include <cstddef>
+
+namespace Opm {{ class ParserKeyword; }}
 
 namespace Opm::ParserKeywords {{
-    void addDefaultKeywords{0}(Parser& p);
+    ParserKeyword makeBuiltinKeyword{0}(std::size_t i);
 }} // namespace Opm::ParserKeywords
 
 #endif // OPM_PARSER_INIT_{0}_HPP
@@ -244,20 +299,33 @@ namespace Opm::ParserKeywords {{
 
 #include <opm/input/eclipse/Parser/ParserKeywords/ParserInit{0}.hpp>
 
-#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/{0}.hpp>
 
-void Opm::ParserKeywords::addDefaultKeywords{0}([[maybe_unused]] Parser& p)
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+Opm::ParserKeyword Opm::ParserKeywords::makeBuiltinKeyword{0}(const std::size_t i)
 {{
     // Built-in '{0}' keywords.
+    switch (i) {{
 )",
                                      first_char);
 
-            for (const auto& kw : keywords) {
-                sourceStr << fmt::format("    p.addParserKeyword({}{{}});", kw.className()) << '\n';
+            for (auto i = 0*keywords.size(); i < keywords.size(); ++i) {
+                sourceStr << fmt::format("    case {}: return {}{{}};", i, keywords[i].className()) << '\n';
             }
 
-            // End of Opm::ParserKeywords::addDefaultKeywords{0}()
+            sourceStr << fmt::format(R"(    }}
+
+    throw std::invalid_argument {{
+        "Built-in '{0}' keyword " + std::to_string(i) + " does not exist"
+    }};
+)",
+                                     first_char);
+
+            // End of Opm::ParserKeywords::makeBuiltinKeyword{0}()
             sourceStr << "}\n";
 
             const auto charSourceFile = std::filesystem::path(sourcePath) / fmt::format("ParserInit{}.cpp", first_char);
@@ -268,16 +336,82 @@ void Opm::ParserKeywords::addDefaultKeywords{0}([[maybe_unused]] Parser& p)
         }
 
         newSource << R"(
-void Opm::Parser::addDefaultKeywords()
-{
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace {
+
+    struct Letter
+    {
+        std::size_t begin;
+        Opm::ParserKeyword (*make)(std::size_t i);
+    };
+
 )";
 
-        for (const auto& kw_pair : loader) {
-            newSource << fmt::format("    ParserKeywords::addDefaultKeywords{}(*this);", kw_pair.first) << '\n';
+        newSource << fmt::format("    constexpr auto num_keywords = std::size_t{{{}}};\n\n", num_keywords);
+
+        newSource << fmt::format("    constexpr std::array<Letter, {}> letters = {{{{\n", letters.size());
+        for (const auto& [first_char, begin] : letters) {
+            newSource << fmt::format("        {{ {}, &Opm::ParserKeywords::makeBuiltinKeyword{} }},\n",
+                                     begin, first_char);
+        }
+        newSource << "    }};\n\n";
+
+        newSource << fmt::format("    constexpr std::array<std::size_t, {}> eager = {{{{", eager.size());
+        for (auto i = 0*eager.size(); i < eager.size(); ++i) {
+            newSource << ((i % 12 == 0) ? "\n       " : "") << ' ' << eager[i] << ',';
+        }
+        newSource << "\n    }};\n\n";
+
+        newSource << fmt::format("    constexpr std::array<std::uint32_t, {}> seeds = {{{{", layout.seeds.size());
+        for (auto i = 0*layout.seeds.size(); i < layout.seeds.size(); ++i) {
+            newSource << ((i % 12 == 0) ? "\n       " : "") << ' ' << layout.seeds[i] << ',';
+        }
+        newSource << "\n    }};\n\n";
+
+        auto slots = std::vector<std::optional<std::size_t>>(layout.num_slots);
+        for (auto i = 0*index_names.size(); i < index_names.size(); ++i) {
+            slots[layout.slot[i]] = i;
         }
 
-        // End of Opm::Parser::addDefaultKeywords()
-        newSource << "}\n";
+        newSource << fmt::format("    constexpr std::array<Opm::BuiltinKeywordIndex::Slot, {}> slots = {{{{\n",
+                                 slots.size());
+        for (const auto& slot : slots) {
+            if (slot.has_value()) {
+                newSource << fmt::format("        {{ \"{}\", {} }},\n",
+                                         index_names[*slot], index_keywords[*slot]);
+            }
+            else {
+                newSource << "        {},\n";
+            }
+        }
+        newSource << "    }};\n";
+
+        newSource << R"(
+    Opm::ParserKeyword makeKeyword(const std::size_t keyword)
+    {
+        const auto letter = std::prev(std::upper_bound(letters.begin(), letters.end(), keyword,
+                                                       [](const std::size_t k, const Letter& l)
+                                                       { return k < l.begin; }));
+
+        return letter->make(keyword - letter->begin);
+    }
+
+} // Anonymous namespace
+
+const Opm::BuiltinKeywordIndex& Opm::ParserKeywords::builtinKeywordIndex()
+{
+    static const auto index = BuiltinKeywordIndex {
+        seeds, slots, eager, num_keywords, &makeKeyword
+    };
+
+    return index;
+}
+)";
 
         write_file(newSource, sourceFile, this->m_verbose, "init");
     }
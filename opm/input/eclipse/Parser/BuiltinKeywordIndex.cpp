@@ -0,0 +1,181 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <opm/input/eclipse/Parser/BuiltinKeywordIndex.hpp>
+
+#include <opm/input/eclipse/Parser/ParserKeyword.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+    // Seeds searched per bucket before giving up.  Far beyond what is
+    // needed with the chosen table sizes.
+    constexpr std::uint32_t max_seed = 1u << 24;
+
+} // Anonymous namespace
+
+Opm::BuiltinKeywordIndex::
+BuiltinKeywordIndex(std::span<const std::uint32_t> seeds,
+                    std::span<const Slot>          slots,
+                    std::span<const std::size_t>   eager_keywords,
+                    const std::size_t              num_keywords,
+                    Factory                        factory)
+    : seeds_         { seeds }
+    , slots_         { slots }
+    , eager_keywords_{ eager_keywords }
+    , num_keywords_  { num_keywords }
+    , factory_       { factory }
+{}
+
+std::optional<std::size_t>
+Opm::BuiltinKeywordIndex::find(std::string_view deck_name) const
+{
+    if (this->seeds_.empty() || deck_name.empty()) {
+        return std::nullopt;
+    }
+
+    const auto bucket = hash(deck_name, 0) % this->seeds_.size();
+    const auto& slot = this->slots_[hash(deck_name, this->seeds_[bucket]) % this->slots_.size()];
+
+    if (slot.deck_name != deck_name) {
+        return std::nullopt;
+    }
+
+    return slot.keyword;
+}
+
+Opm::ParserKeyword
+Opm::BuiltinKeywordIndex::create(const std::size_t keyword) const
+{
+    if (keyword >= this->num_keywords_) {
+        throw std::invalid_argument {
+            "Built-in keyword " + std::to_string(keyword) + " does not exist"
+        };
+    }
+
+    return this->factory_(keyword);
+}
+
+std::vector<std::string_view>
+Opm::BuiltinKeywordIndex::deckNames() const
+{
+    auto names = std::vector<std::string_view>{};
+
+    for (const auto& slot : this->slots_) {
+        if (! slot.deck_name.empty()) {
+            names.push_back(slot.deck_name);
+        }
+    }
+
+    return names;
+}
+
+std::uint64_t
+Opm::BuiltinKeywordIndex::hash(std::string_view name, const std::uint32_t seed)
+{
+    // FNV-1a, with the offset basis perturbed by the seed.
+    auto h = std::uint64_t{0xcbf29ce484222325} ^ (seed * std::uint64_t{0x9E3779B97F4A7C15});
+
+    for (const auto c : name) {
+        h ^= static_cast<unsigned char>(c);
+        h *= std::uint64_t{0x100000001b3};
+    }
+
+    return h ^ (h >> 32);
+}
+
+Opm::BuiltinKeywordIndex::Layout
+Opm::BuiltinKeywordIndex::layout(const std::vector<std::string>& names)
+{
+    auto layout = Layout{};
+    if (names.empty()) {
+        return layout;
+    }
+
+    const auto num_buckets = std::max(names.size() / 2, std::size_t{1});
+    layout.num_slots = std::max(names.size() + names.size() / 4, std::size_t{1});
+    layout.seeds.assign(num_buckets, 0);
+    layout.slot.assign(names.size(), 0);
+
+    auto buckets = std::vector<std::vector<std::size_t>>(num_buckets);
+    for (auto i = 0*names.size(); i < names.size(); ++i) {
+        buckets[hash(names[i], 0) % num_buckets].push_back(i);
+    }
+
+    // Place the largest buckets first, while there is most room.
+    auto order = std::vector<std::size_t>(num_buckets);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [&buckets](const std::size_t b1, const std::size_t b2)
+                     { return buckets[b1].size() > buckets[b2].size(); });
+
+    auto used = std::vector<bool>(layout.num_slots, false);
+    auto candidate = std::vector<std::size_t>{};
+
+    for (const auto b : order) {
+        const auto& bucket = buckets[b];
+        if (bucket.empty()) {
+            break;
+        }
+
+        auto seed = std::uint32_t{1};
+        for (; seed < max_seed; ++seed) {
+            candidate.clear();
+
+            const auto fits = std::all_of(bucket.begin(), bucket.end(),
+                [&](const std::size_t i)
+            {
+                const auto s = hash(names[i], seed) % layout.num_slots;
+                if (used[s] || (std::find(candidate.begin(), candidate.end(), s) != candidate.end())) {
+                    return false;
+                }
+
+                candidate.push_back(s);
+                return true;
+            });
+
+            if (fits) {
+                break;
+            }
+        }
+
+        if (seed == max_seed) {
+            throw std::runtime_error {
+                "Unable to form perfect hash of built-in keyword names"
+            };
+        }
+
+        layout.seeds[b] = seed;
+        for (auto i = 0*bucket.size(); i < bucket.size(); ++i) {
+            used[candidate[i]] = true;
+            layout.slot[bucket[i]] = candidate[i];
+        }
+    }
+
+    return layout;
+}
@@ -0,0 +1,117 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BUILTIN_KEYWORD_INDEX_HPP
+#define BUILTIN_KEYWORD_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Opm {
+
+    class ParserKeyword;
+
+    /// Perfect hash index of the deck names of the built-in keywords.
+    ///
+    /// The index is formed by the keyword generator at build time and lets
+    /// the Parser construct each built-in ParserKeyword the first time it
+    /// is needed rather than all of them up front.  Keywords are identified
+    /// by their position in the generator's keyword list.
+    ///
+    /// Deck names are located by hash-and-displace: a deck name is hashed
+    /// into a bucket, and the bucket's seed is used to hash the name into a
+    /// slot which holds no other deck name.  A lookup is therefore two
+    /// hashes and a single string comparison.
+    class BuiltinKeywordIndex
+    {
+    public:
+        /// Deck name and keyword of a single slot.  Unused slots have an
+        /// empty deck name.
+        struct Slot
+        {
+            std::string_view deck_name{};
+            std::size_t keyword{};
+        };
+
+        /// Construct keyword from its position in the keyword list.
+        using Factory = ParserKeyword (*)(std::size_t keyword);
+
+        /// Bucket seeds, and the slot of each name, for a set of names.
+        struct Layout
+        {
+            std::vector<std::uint32_t> seeds{};
+            std::size_t num_slots{};
+            std::vector<std::size_t> slot{};
+        };
+
+        BuiltinKeywordIndex(std::span<const std::uint32_t> seeds,
+                            std::span<const Slot>          slots,
+                            std::span<const std::size_t>   eager_keywords,
+                            std::size_t                    num_keywords,
+                            Factory                        factory);
+
+        /// Keyword of a deck name.  Nullopt if the deck name does not
+        /// belong to any keyword in the index.
+        std::optional<std::size_t> find(std::string_view deck_name) const;
+
+        /// Construct keyword.
+        ParserKeyword create(std::size_t keyword) const;
+
+        /// Keywords which must be added to the Parser up front, in order,
+        /// e.g., because they match deck names by regular expression or
+        /// are code keywords.  Their deck names are not in the index.
+        std::span<const std::size_t> eagerKeywords() const
+        { return this->eager_keywords_; }
+
+        /// Deck names in the index, in unspecified order.
+        std::vector<std::string_view> deckNames() const;
+
+        /// Number of keywords in the keyword list.
+        std::size_t numKeywords() const { return this->num_keywords_; }
+
+        /// Hash function of the index.
+        static std::uint64_t hash(std::string_view name, std::uint32_t seed);
+
+        /// Form the index layout of a set of distinct names.  Used by the
+        /// keyword generator.
+        static Layout layout(const std::vector<std::string>& names);
+
+    private:
+        std::span<const std::uint32_t> seeds_{};
+        std::span<const Slot> slots_{};
+        std::span<const std::size_t> eager_keywords_{};
+        std::size_t num_keywords_{};
+        Factory factory_{nullptr};
+    };
+
+namespace ParserKeywords {
+
+    /// Index of all built-in keywords.  Defined in generated code.
+    const BuiltinKeywordIndex& builtinKeywordIndex();
+
+} // namespace ParserKeywords
+
+} // namespace Opm
+
+#endif // BUILTIN_KEYWORD_INDEX_HPP
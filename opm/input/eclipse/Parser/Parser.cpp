@@ -21,8 +21,10 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
+#include <opm/common/TimingMacros.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
+#include <opm/input/eclipse/Parser/BuiltinKeywordIndex.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserItem.hpp>
@@ -58,12 +60,15 @@
 #include "raw/StarToken.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstddef>
 #include <cstdio>
 #include <filesystem>
 #include <iostream>
 #include <iterator>
+#include <list>
+#include <mutex>
 #include <optional>
 #include <regex>
 #include <stack>
@@ -1595,6 +1600,51 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
                  str::find_terminator( str.begin(), str.end(), str::find_comment() ) };
     }
 
+    /// Built-in keywords which have been constructed on first use.
+    ///
+    /// Lookups may happen concurrently on a const Parser, so construction
+    /// is serialised while looking up an existing keyword is lock free.
+    class Parser::BuiltinKeywords
+    {
+    public:
+        explicit BuiltinKeywords(const BuiltinKeywordIndex& index)
+            : index_    { index }
+            , keywords_ ( index.numKeywords() )
+        {}
+
+        const BuiltinKeywordIndex& index() const { return this->index_; }
+
+        const ParserKeyword* find(std::string_view deck_name)
+        {
+            const auto keyword = this->index_.find(deck_name);
+            if (! keyword.has_value()) {
+                return nullptr;
+            }
+
+            auto& slot = this->keywords_[*keyword];
+            if (const auto* ptr = slot.load(std::memory_order_acquire); ptr != nullptr) {
+                return ptr;
+            }
+
+            std::lock_guard<std::mutex> lock { this->mutex_ };
+
+            if (const auto* ptr = slot.load(std::memory_order_relaxed); ptr != nullptr) {
+                return ptr;
+            }
+
+            const auto* ptr = &this->storage_.emplace_back(this->index_.create(*keyword));
+            slot.store(ptr, std::memory_order_release);
+
+            return ptr;
+        }
+
+    private:
+        const BuiltinKeywordIndex& index_;
+        std::vector<std::atomic<const ParserKeyword*>> keywords_{};
+        std::list<ParserKeyword> storage_{};
+        std::mutex mutex_{};
+    };
+
     Parser::Parser(const bool addDefault)
         : Parser { std::make_shared<Python>(), addDefault }
     {}
@@ -1602,15 +1652,29 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
     Parser::Parser(std::shared_ptr<Python> python, const bool addDefault)
         : m_python { std::move(python) }
     {
-        // The addDefaultKeywords() method is implemented in a source file
-        // ${PROJECT_BINARY_DIR}/ParserInit.cpp which is generated by the
-        // build system.
-
         if (addDefault) {
             this->addDefaultKeywords();
         }
     }
 
+    void Parser::addDefaultKeywords()
+    {
+        // The index of built-in keywords is implemented in a source file
+        // ${PROJECT_BINARY_DIR}/ParserInit.cpp which is generated by the
+        // build system.  Keywords which match deck names by regular
+        // expression, code keywords, and keywords which share deck names
+        // are added immediately.  All others are constructed when first
+        // looked up by deck name.
+
+        const auto& index = ParserKeywords::builtinKeywordIndex();
+
+        for (const auto keyword : index.eagerKeywords()) {
+            this->addParserKeyword(index.create(keyword));
+        }
+
+        this->builtin_keywords = std::make_shared<BuiltinKeywords>(index);
+    }
+
     /*
      About INCLUDE: Observe that the ECLIPSE parser is slightly unlogical
      when it comes to nested includes; the path to an included file is always
@@ -1668,6 +1732,8 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
                            ErrorGuard& errors,
                            const std::vector<Ecl::SectionType>& sections) const
     {
+        OPM_TIMEFUNCTION();
+
         auto ignore_sections = std::set<Ecl::SectionType> {};
 
         if (! sections.empty()) {
@@ -1764,7 +1830,15 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
     }
 
     std::size_t Parser::size() const {
-        return m_deckParserKeywords.size();
+        auto num_names = m_deckParserKeywords.size();
+
+        if (this->builtin_keywords != nullptr) {
+            for (const auto& deck_name : this->builtin_keywords->index().deckNames()) {
+                num_names += ! m_deckParserKeywords.contains(deck_name);
+            }
+        }
+
+        return num_names;
     }
 
     const ParserKeyword* Parser::matchingKeyword(const std::string_view& name) const
@@ -1785,14 +1859,34 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
             return false;
         }
 
-        return (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+        return (this->isBaseRecognizedKeyword(name))
             || (this->matchingKeyword(name) != nullptr);
     }
 
     bool Parser::isBaseRecognizedKeyword(std::string_view name) const
     {
-        return ParserKeyword::validDeckName(name)
-            && (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end());
+        if (! ParserKeyword::validDeckName(name)) {
+            return false;
+        }
+
+        return (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+            || ((this->builtin_keywords != nullptr) &&
+                this->builtin_keywords->index().find(name).has_value());
+    }
+
+    const ParserKeyword* Parser::deckNameKeyword(std::string_view name) const
+    {
+        // Explicitly added keywords take precedence over built-in keywords
+        // not yet constructed, since the former were added later.
+        if (auto candidate = m_deckParserKeywords.find(name);
+            candidate != m_deckParserKeywords.end())
+        {
+            return candidate->second;
+        }
+
+        return (this->builtin_keywords != nullptr)
+            ? this->builtin_keywords->find(name)
+            : nullptr;
     }
 
 void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
@@ -1835,8 +1929,10 @@ void Parser::addParserKeyword(const Json::JsonObject& jsonKeyword) {
 }
 
 bool Parser::hasKeyword( const std::string& name ) const {
-    return this->m_deckParserKeywords.find( std::string_view( name ) )
-        != this->m_deckParserKeywords.end();
+    return (this->m_deckParserKeywords.find( std::string_view( name ) )
+            != this->m_deckParserKeywords.end())
+        || ((this->builtin_keywords != nullptr) &&
+            this->builtin_keywords->index().find( name ).has_value());
 }
 
 const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
@@ -1844,9 +1940,9 @@ const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
 }
 
 const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view& name ) const {
-    auto candidate = m_deckParserKeywords.find( name );
+    const auto* candidate = deckNameKeyword( name );
 
-    if( candidate != m_deckParserKeywords.end() ) return *candidate->second;
+    if( candidate != nullptr ) return *candidate;
 
     const auto* wildCardKeyword = matchingKeyword( name );
 
@@ -1861,6 +1957,12 @@ std::vector<std::string> Parser::getAllDeckNames () const {
     for (auto iterator = m_deckParserKeywords.begin(); iterator != m_deckParserKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
+    if (this->builtin_keywords != nullptr) {
+        for (const auto& deck_name : this->builtin_keywords->index().deckNames()) {
+            if (! m_deckParserKeywords.contains(deck_name))
+                keywords.push_back(std::string(deck_name));
+        }
+    }
     for (auto iterator = m_wildCardKeywords.begin(); iterator != m_wildCardKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
@@ -29,6 +29,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -191,9 +192,15 @@ namespace Opm {
 
         std::vector<std::pair<std::string,std::string>> code_keywords{};
 
+        // built-in keywords which are constructed on first use.  Shared
+        // between copies of the parser.
+        class BuiltinKeywords;
+        std::shared_ptr<BuiltinKeywords> builtin_keywords{};
+
         bool hasWildCardKeyword(const std::string& keyword) const;
 
         const ParserKeyword* matchingKeyword(const std::string_view& keyword) const;
+        const ParserKeyword* deckNameKeyword(std::string_view deckKeywordName) const;
         void addDefaultKeywords();
     };
 
@@ -352,26 +352,6 @@ Opm::Action::ASTNode::evalWellExpression(const Context& context) const
     return well_values;
 }
 
-namespace {
-    std::string normalisePattern(const std::string& patt)
-    {
-        if (patt.front() == '\\') {
-            // Trim leading '\' character since the 'patt' might be
-            // something like
-            //
-            //    '\*P*'
-            //
-            // which denotes all wells (typically) whose names contain at
-            // least one 'P' anywhere in the name.  Without the leading
-            // backslash, the pattern would match all well lists whose names
-            // begin with 'P'.
-            return patt.substr(1);
-        }
-
-        return patt;
-    }
-} // Anonymous namespace
-
 std::vector<std::string>
 Opm::Action::ASTNode::getWellList(const Context& context) const
 {
@@ -385,7 +365,7 @@ Opm::Action::ASTNode::getWellList(const Context& context) const
     wnames.reserve(wells.size());
 
     std::ranges::copy_if(wells, std::back_inserter(wnames),
-                         [wpatt = normalisePattern(this->arg_list.front())]
+                         [wpatt = this->wellPattern()]
                          (const auto& well) { return shmatch(wpatt, well); });
 
     return wnames;
@@ -403,3 +383,22 @@ bool Opm::Action::ASTNode::argListIsWellList() const
 
     return (well_arg.size() > 1) && (well_arg.front() == '*');
 }
+
+std::string Opm::Action::ASTNode::wellPattern() const
+{
+    const auto& patt = this->arg_list.front();
+
+    if (patt.front() == '\\') {
+        // Trim leading '\' character since the 'patt' might be something
+        // like
+        //
+        //    '\*P*'
+        //
+        // which denotes all wells (typically) whose names contain at least
+        // one 'P' anywhere in the name.  Without the leading backslash, the
+        // pattern would match all well lists whose names begin with 'P'.
+        return patt.substr(1);
+    }
+
+    return patt;
+}
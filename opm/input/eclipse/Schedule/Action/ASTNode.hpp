@@ -165,6 +165,8 @@ public:
     }
 
 private:
+    friend class CompiledCondition;
+
     // Note: data member order here is dictated by initialisation list in
     // four-argument constructor.
 
@@ -278,6 +280,10 @@ private:
     /// arg_list.front() \endcode) is the name of a well list or a well list
     /// template (pattern).
     bool argListIsWellList() const;
+
+    /// Well name pattern at the front of the function argument list (\code
+    /// arg_list.front() \endcode), without any leading escape character.
+    std::string wellPattern() const;
 };
 
 } // namespace Opm::Action
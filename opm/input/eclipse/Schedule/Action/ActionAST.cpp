@@ -23,17 +23,22 @@
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionParser.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+#include <opm/input/eclipse/Schedule/Action/CompiledCondition.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 Opm::Action::AST::AST() = default;
 
 Opm::Action::AST::AST(const std::vector<std::string>& tokens)
     : condition { Parser::parseCondition(tokens) }
-{}
+{
+    this->compile();
+}
 
 Opm::Action::AST::~AST() = default;
 
@@ -42,10 +47,15 @@ Opm::Action::AST::AST(const AST& rhs)
     if (rhs.condition != nullptr) {
         this->condition = std::make_unique<ASTNode>(*rhs.condition);
     }
+
+    if (rhs.compiled != nullptr) {
+        this->compiled = std::make_unique<CompiledCondition>(*rhs.compiled);
+    }
 }
 
 Opm::Action::AST::AST(AST&& rhs)
     : condition { std::move(rhs.condition) }
+    , compiled  { std::move(rhs.compiled) }
 {}
 
 Opm::Action::AST&
@@ -58,6 +68,13 @@ Opm::Action::AST::operator=(const AST& rhs)
         else {
             this->condition = std::make_unique<ASTNode>(*rhs.condition);
         }
+
+        if (rhs.compiled == nullptr) {
+            this->compiled.reset();
+        }
+        else {
+            this->compiled = std::make_unique<CompiledCondition>(*rhs.compiled);
+        }
     }
 
     return *this;
@@ -68,6 +85,7 @@ Opm::Action::AST::operator=(AST&& rhs)
 {
     if (this != &rhs) {
         this->condition = std::move(rhs.condition);
+        this->compiled = std::move(rhs.compiled);
     }
 
     return *this;
@@ -77,6 +95,7 @@ Opm::Action::AST Opm::Action::AST::serializationTestObject()
 {
     AST result;
     result.condition = std::make_unique<ASTNode>(ASTNode::serializationTestObject());
+    result.compile();
 
     return result;
 }
@@ -88,6 +107,12 @@ Opm::Action::AST::eval(const Action::Context& context) const
         return Result { false };
     }
 
+    if (this->compiled != nullptr) {
+        if (auto result = this->compiled->eval(context); result.has_value()) {
+            return *std::move(result);
+        }
+    }
+
     return this->condition->eval(context);
 }
 
@@ -107,3 +132,22 @@ void Opm::Action::AST::required_summary(std::unordered_set<std::string>& require
 
     this->condition->required_summary(required_summary);
 }
+
+// ===========================================================================
+// Private member functions
+// ===========================================================================
+
+void Opm::Action::AST::compile()
+{
+    this->compiled.reset();
+
+    if ((this->condition == nullptr) || this->condition->empty()) {
+        return;
+    }
+
+    if (auto compiled_condition = CompiledCondition::compile(*this->condition);
+        compiled_condition.has_value())
+    {
+        this->compiled = std::make_unique<CompiledCondition>(*std::move(compiled_condition));
+    }
+}
@@ -31,6 +31,7 @@ namespace Opm::Action {
 
 class Context;
 class ASTNode;
+class CompiledCondition;
 
 } // namespace Opm::Action
 
@@ -41,6 +42,9 @@ namespace Opm::Action {
 /// There is no additional context such as current summary vector values or
 /// a set of active wells.  This must be supplied through an Action::Context
 /// instace when invoking the eval() member function.
+///
+/// The condition is compiled (see CompiledCondition) when the object is
+/// formed, and eval() uses the compiled form whenever possible.
 
 class AST
 {
@@ -119,6 +123,10 @@ public:
     void serializeOp(Serializer& serializer)
     {
         serializer(condition);
+
+        if (! serializer.isSerializing()) {
+            this->compile();
+        }
     }
 
     /// Export all summary vectors needed to evaluate the expression tree.
@@ -132,6 +140,13 @@ public:
 private:
     /// Internalised condition object in expression tree form.
     std::unique_ptr<ASTNode> condition{};
+
+    /// Compiled form of the condition.  Null if the condition could not
+    /// be compiled.
+    std::unique_ptr<CompiledCondition> compiled{};
+
+    /// Form compiled condition from expression tree.
+    void compile();
 };
 
 } // namespace Opm::Action
@@ -25,6 +25,7 @@
 
 #include <fmt/format.h>
 
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <string>
@@ -82,3 +83,8 @@ Opm::Action::Context::wells(const std::string& key) const
 {
     return this->summaryState_.get().wells(key);
 }
+
+std::size_t Opm::Action::Context::well_set_revision() const
+{
+    return this->summaryState_.get().well_set_revision();
+}
@@ -20,6 +20,7 @@
 #ifndef ActionContext_HPP
 #define ActionContext_HPP
 
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <string>
@@ -95,6 +96,13 @@ public:
     /// \return All wells for which the named summary function is defined.
     std::vector<std::string> wells(const std::string& func) const;
 
+    /// Revision number of the last change to the set of wells for which
+    /// any well-level summary function is defined.
+    ///
+    /// Results of wells() remain valid for as long as this number does not
+    /// change.
+    std::size_t well_set_revision() const;
+
     /// Get read-only access to run's well lists.
     ///
     /// Convenience method.
@@ -0,0 +1,449 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/Action/CompiledCondition.hpp>
+
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
+
+#include <opm/common/utility/shmatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+namespace {
+
+constexpr auto bits_per_word = std::size_t{64};
+
+bool isComparisonOperator(const Opm::Action::TokenType op)
+{
+    return (op == Opm::Action::TokenType::op_gt)
+        || (op == Opm::Action::TokenType::op_ge)
+        || (op == Opm::Action::TokenType::op_lt)
+        || (op == Opm::Action::TokenType::op_le)
+        || (op == Opm::Action::TokenType::op_eq)
+        || (op == Opm::Action::TokenType::op_ne)
+        ;
+}
+
+template <typename Predicate>
+void compareAll(const std::vector<double>&  values,
+                Predicate&&                 holds,
+                std::vector<unsigned char>& hits)
+{
+    const auto n = values.size();
+    for (auto i = 0*n; i < n; ++i) {
+        hits[i] = holds(values[i]);
+    }
+}
+
+/// Evaluate comparison for a sequence of values in a single pass.
+///
+/// Same semantics as scalarComparisonHolds() in ActionValue.cpp.
+void compareAll(const std::vector<double>&   values,
+                const Opm::Action::TokenType op,
+                const double                 rhs,
+                std::vector<unsigned char>&  hits)
+{
+    hits.resize(values.size());
+
+    switch (op) {
+    case Opm::Action::TokenType::op_gt:
+        compareAll(values, [rhs](const double v) { return v >  rhs; }, hits);
+        break;
+
+    case Opm::Action::TokenType::op_ge:
+        compareAll(values, [rhs](const double v) { return v >= rhs; }, hits);
+        break;
+
+    case Opm::Action::TokenType::op_lt:
+        compareAll(values, [rhs](const double v) { return v <  rhs; }, hits);
+        break;
+
+    case Opm::Action::TokenType::op_le:
+        compareAll(values, [rhs](const double v) { return v <= rhs; }, hits);
+        break;
+
+    case Opm::Action::TokenType::op_eq:
+        compareAll(values, [rhs](const double v) { return v == rhs; }, hits);
+        break;
+
+    case Opm::Action::TokenType::op_ne:
+        compareAll(values, [rhs](const double v) { return v != rhs; }, hits);
+        break;
+
+    default:
+        // Operator checked at compile time.
+        hits.assign(values.size(), 0);
+        break;
+    }
+}
+
+void setBit(std::vector<std::uint64_t>& bits, const std::size_t i)
+{
+    bits[i / bits_per_word] |= std::uint64_t{1} << (i % bits_per_word);
+}
+
+bool hasBit(const std::vector<std::uint64_t>& bits, const std::size_t i)
+{
+    return ((bits[i / bits_per_word] >> (i % bits_per_word)) & 1) != 0;
+}
+
+} // Anonymous namespace
+
+std::optional<Opm::Action::CompiledCondition>
+Opm::Action::CompiledCondition::compile(const ASTNode& condition)
+{
+    auto compiled = CompiledCondition{};
+
+    if (! compiled.compile_node(condition)) {
+        return std::nullopt;
+    }
+
+    return compiled;
+}
+
+std::optional<Opm::Action::Result>
+Opm::Action::CompiledCondition::eval(const Context& context)
+{
+    try {
+        for (auto& operand : this->operands_) {
+            this->expand(operand, context);
+        }
+
+        const auto num_words =
+            (this->well_names_.size() + bits_per_word - 1) / bits_per_word;
+
+        auto depth = std::size_t{0};
+        for (const auto& instr : this->program_) {
+            if (instr.op == Op::Compare) {
+                if (depth == this->stack_.size()) {
+                    this->stack_.emplace_back();
+                }
+
+                auto& slot = this->stack_[depth++];
+                slot.bits.assign(num_words, 0);
+                this->compare(instr, context, slot);
+            }
+            else {
+                depth -= instr.num_args;
+                this->combine(instr.op, depth, instr.num_args);
+                ++depth;
+            }
+        }
+
+        const auto& top = this->stack_.front();
+
+        auto result = Result { top.result };
+        if (top.has_wells) {
+            auto wells = std::vector<std::string>{};
+            for (auto i = 0*this->well_names_.size(); i < this->well_names_.size(); ++i) {
+                if (hasBit(top.bits, i)) {
+                    wells.push_back(this->well_names_[i]);
+                }
+            }
+
+            result.wells(wells);
+        }
+
+        return result;
+    }
+    catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+// ===========================================================================
+// Private member functions
+// ===========================================================================
+
+bool Opm::Action::CompiledCondition::compile_node(const ASTNode& node)
+{
+    if (node.empty()) {
+        return false;
+    }
+
+    if ((node.type == TokenType::op_or) ||
+        (node.type == TokenType::op_and))
+    {
+        for (const auto& child : node.children) {
+            if (! this->compile_node(child)) {
+                return false;
+            }
+        }
+
+        auto& instr = this->program_.emplace_back();
+        instr.op = (node.type == TokenType::op_or) ? Op::Or : Op::And;
+        instr.num_args = node.size();
+
+        return true;
+    }
+
+    if (! isComparisonOperator(node.type) || (node.size() != 2)) {
+        return false;
+    }
+
+    const auto& lhs = node.children.front();
+    const auto& rhs = node.children.back();
+
+    auto instr = Instruction{};
+    instr.op = Op::Compare;
+    instr.cmp = node.type;
+
+    if (! this->compile_operand(lhs, instr.lhs) ||
+        ! this->compile_operand(rhs, instr.rhs))
+    {
+        return false;
+    }
+
+    // The right hand side must be a scalar.
+    auto& rhs_operand = this->operands_[instr.rhs];
+    if ((rhs_operand.kind != Operand::Kind::Number) &&
+        (rhs_operand.kind != Operand::Kind::Scalar))
+    {
+        return false;
+    }
+
+    // Numeric month values are compared to the nearest integer.  See
+    // ASTNode::evalComparison().
+    if ((lhs.func_type == FuncType::time_month) &&
+        (rhs.type == TokenType::number))
+    {
+        rhs_operand.number = std::round(rhs_operand.number);
+    }
+
+    this->program_.push_back(instr);
+
+    return true;
+}
+
+bool Opm::Action::CompiledCondition::compile_operand(const ASTNode& node,
+                                                     std::size_t&   index)
+{
+    if (! node.empty()) {
+        return false;
+    }
+
+    auto operand = Operand{};
+
+    if (node.type == TokenType::number) {
+        operand.kind = Operand::Kind::Number;
+        operand.number = node.number;
+    }
+    else if (node.arg_list.empty()) {
+        operand.kind = Operand::Kind::Scalar;
+        operand.key = node.func;
+    }
+    else if (node.argListIsPattern()) {
+        if (node.func_type != FuncType::well) {
+            return false;
+        }
+
+        operand.key = node.func;
+        if (node.argListIsWellList()) {
+            operand.kind = Operand::Kind::WellList;
+            operand.pattern = node.arg_list.front();
+        }
+        else {
+            operand.kind = Operand::Kind::WellPattern;
+            operand.pattern = node.wellPattern();
+        }
+    }
+    else {
+        operand.kind = (node.func_type == FuncType::well)
+            ? Operand::Kind::Well
+            : Operand::Kind::Scalar;
+
+        operand.key = fmt::format("{}:{}", node.func, fmt::join(node.arg_list, ":"));
+
+        if (operand.kind == Operand::Kind::Well) {
+            operand.well = this->well_index(node.arg_list.front());
+        }
+    }
+
+    index = this->operands_.size();
+    this->operands_.push_back(std::move(operand));
+
+    return true;
+}
+
+std::size_t Opm::Action::CompiledCondition::well_index(const std::string& well)
+{
+    auto [pos, inserted] = this->well_index_.try_emplace(well, this->well_names_.size());
+    if (inserted) {
+        this->well_names_.push_back(well);
+    }
+
+    return pos->second;
+}
+
+void Opm::Action::CompiledCondition::expand(Operand& operand, const Context& context)
+{
+    auto names = std::vector<std::string>{};
+
+    if (operand.kind == Operand::Kind::WellPattern) {
+        const auto revision = context.well_set_revision();
+        if (operand.revision == revision) {
+            return;
+        }
+
+        for (const auto& well : context.wells(operand.key)) {
+            if (shmatch(operand.pattern, well)) {
+                names.push_back(well);
+            }
+        }
+
+        operand.revision = revision;
+    }
+    else if (operand.kind == Operand::Kind::WellList) {
+        // Well lists may change without notice, so their contents must be
+        // retrieved at each evaluation.
+        names = context.wlist_manager().wells(operand.pattern);
+        if (operand.revision.has_value() && (names == operand.names)) {
+            return;
+        }
+
+        operand.revision = 0;
+    }
+    else {
+        return;
+    }
+
+    operand.wells.clear();
+    operand.keys.clear();
+    for (const auto& well : names) {
+        operand.wells.push_back(this->well_index(well));
+        operand.keys.push_back(fmt::format("{}:{}", operand.key, well));
+    }
+
+    operand.names = std::move(names);
+}
+
+void Opm::Action::CompiledCondition::compare(const Instruction& instr,
+                                             const Context&     context,
+                                             Slot&              slot)
+{
+    const auto& rhs_operand = this->operands_[instr.rhs];
+    const auto rhs = (rhs_operand.kind == Operand::Kind::Number)
+        ? rhs_operand.number
+        : context.get(rhs_operand.key);
+
+    const auto& lhs = this->operands_[instr.lhs];
+
+    switch (lhs.kind) {
+    case Operand::Kind::Number:
+    case Operand::Kind::Scalar:
+        this->values_.assign(1, (lhs.kind == Operand::Kind::Number)
+                             ? lhs.number : context.get(lhs.key));
+        compareAll(this->values_, instr.cmp, rhs, this->hits_);
+
+        slot.result = this->hits_.front() != 0;
+        slot.has_wells = false;
+        break;
+
+    case Operand::Kind::Well:
+        this->values_.assign(1, context.get(lhs.key));
+        compareAll(this->values_, instr.cmp, rhs, this->hits_);
+
+        slot.result = this->hits_.front() != 0;
+        slot.has_wells = true;
+        if (slot.result) {
+            setBit(slot.bits, lhs.well);
+        }
+        break;
+
+    case Operand::Kind::WellPattern:
+    case Operand::Kind::WellList:
+        this->values_.resize(lhs.keys.size());
+        for (auto i = 0*lhs.keys.size(); i < lhs.keys.size(); ++i) {
+            this->values_[i] = context.get(lhs.keys[i]);
+        }
+
+        compareAll(this->values_, instr.cmp, rhs, this->hits_);
+
+        slot.result = false;
+        slot.has_wells = true;
+        for (auto i = 0*lhs.wells.size(); i < lhs.wells.size(); ++i) {
+            if (this->hits_[i] != 0) {
+                setBit(slot.bits, lhs.wells[i]);
+                slot.result = true;
+            }
+        }
+        break;
+    }
+}
+
+void Opm::Action::CompiledCondition::combine(const Op          op,
+                                             const std::size_t first,
+                                             const std::size_t num_args)
+{
+    // Same rules as Result::makeSetUnion() and Result::makeSetIntersection()
+    // applied to an initial result of 'true' for 'AND' and 'false' for 'OR'.
+    auto& acc = this->accumulator_;
+    acc.result = (op == Op::And);
+    acc.has_wells = false;
+    acc.bits.assign(this->stack_[first].bits.size(), 0);
+
+    for (auto k = first; k < first + num_args; ++k) {
+        const auto& arg = this->stack_[k];
+
+        acc.result = (op == Op::And)
+            ? (acc.result && arg.result)
+            : (acc.result || arg.result);
+
+        if (! acc.result) {
+            std::fill(acc.bits.begin(), acc.bits.end(), std::uint64_t{0});
+            continue;
+        }
+
+        if (! arg.has_wells) {
+            continue;
+        }
+
+        if ((op == Op::Or) || ! acc.has_wells) {
+            // Union, or intersection with an empty set of matching
+            // entities, which takes the other set.
+            for (auto w = 0*acc.bits.size(); w < acc.bits.size(); ++w) {
+                acc.bits[w] |= arg.bits[w];
+            }
+        }
+        else {
+            for (auto w = 0*acc.bits.size(); w < acc.bits.size(); ++w) {
+                acc.bits[w] &= arg.bits[w];
+            }
+        }
+
+        acc.has_wells = true;
+    }
+
+    std::swap(this->stack_[first], acc);
+}
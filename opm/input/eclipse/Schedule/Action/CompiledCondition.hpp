@@ -0,0 +1,154 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ACTION_COMPILED_CONDITION_HPP
+#define ACTION_COMPILED_CONDITION_HPP
+
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm::Action {
+
+class ASTNode;
+class Context;
+
+} // namespace Opm::Action
+
+namespace Opm::Action {
+
+/// ACTIONX condition flattened into a sequence of comparisons and logical
+/// operations.
+///
+/// Summary vector keys are formed once, at compile time, and well name
+/// patterns are expanded only when the set of wells in the summary state
+/// changes (see Context::well_set_revision()).  Evaluating a well condition
+/// then amounts to looking up the values of the pre-expanded wells and
+/// comparing them to the right hand side in a single pass.  Sets of
+/// matching wells are represented as bitsets over the wells seen by the
+/// condition, which turns the 'AND' and 'OR' operations into word-wise
+/// bit operations.
+///
+/// The compiled form reproduces the results of ASTNode::eval() exactly,
+/// including the special handling of conditions which do not produce a
+/// set of wells.  Conditions which ASTNode::eval() would reject are not
+/// compiled, and eval() returns nullopt whenever the evaluation fails at
+/// runtime, e.g., due to a missing summary vector.  The caller is expected
+/// to use ASTNode::eval() in that case.
+class CompiledCondition
+{
+public:
+    /// Compile condition.
+    ///
+    /// \param[in] condition Root node of ACTIONX condition expression.
+    ///
+    /// \return Compiled condition.  Nullopt if \p condition cannot be
+    /// compiled.
+    static std::optional<CompiledCondition> compile(const ASTNode& condition);
+
+    /// Evaluate condition at current dynamic state.
+    ///
+    /// \param[in] context Current summary vectors and wells.
+    ///
+    /// \return Same result as ASTNode::eval().  Nullopt if the evaluation
+    /// failed.
+    std::optional<Result> eval(const Context& context);
+
+private:
+    /// Leaf node of a comparison.
+    struct Operand
+    {
+        enum class Kind : unsigned char {
+            Number,       // Constant
+            Scalar,       // Field, group, or other non-well vector
+            Well,         // Well vector for a single named well
+            WellPattern,  // Well vector for all wells matching a pattern
+            WellList,     // Well vector for all wells of a well list
+        };
+
+        Kind kind{Kind::Number};
+        double number{};
+
+        /// Combined summary key for Scalar and Well, function name for
+        /// WellPattern and WellList.
+        std::string key{};
+
+        /// Well name pattern or well list name.
+        std::string pattern{};
+
+        /// Well index of Well.
+        std::size_t well{};
+
+        /// Expansion of WellPattern and WellList.  Well indices, combined
+        /// summary keys, and well set revision of the expansion.
+        std::vector<std::size_t> wells{};
+        std::vector<std::string> keys{};
+        std::vector<std::string> names{};
+        std::optional<std::size_t> revision{};
+    };
+
+    enum class Op : unsigned char { Compare, And, Or };
+
+    struct Instruction
+    {
+        Op op{Op::Compare};
+        TokenType cmp{TokenType::error};
+        std::size_t lhs{};
+        std::size_t rhs{};
+        std::size_t num_args{};
+    };
+
+    /// Intermediate result.  Bits are cleared unless has_wells is set.
+    struct Slot
+    {
+        bool result{false};
+        bool has_wells{false};
+        std::vector<std::uint64_t> bits{};
+    };
+
+    std::vector<Instruction> program_{};
+    std::vector<Operand> operands_{};
+
+    /// Names of all wells seen by the condition, and their indices.
+    std::vector<std::string> well_names_{};
+    std::unordered_map<std::string, std::size_t> well_index_{};
+
+    std::vector<Slot> stack_{};
+    Slot accumulator_{};
+    std::vector<double> values_{};
+    std::vector<unsigned char> hits_{};
+
+    bool compile_node(const ASTNode& node);
+    bool compile_operand(const ASTNode& node, std::size_t& index);
+    std::size_t well_index(const std::string& well);
+
+    void expand(Operand& operand, const Context& context);
+    void compare(const Instruction& instr, const Context& context, Slot& slot);
+    void combine(Op op, std::size_t first, std::size_t num_args);
+};
+
+} // namespace Opm::Action
+
+#endif // ACTION_COMPILED_CONDITION_HPP
@@ -25,6 +25,7 @@
 
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/TimingMacros.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 #include <opm/common/utility/String.hpp>
 #include <opm/common/utility/numeric/cmp.hpp>
@@ -159,6 +160,8 @@ namespace Opm {
         , completed_cells(ecl_grid.getNX(), ecl_grid.getNY(), ecl_grid.getNZ())
         , m_lowActionParsingStrictness(lowActionParsingStrictness)
     {
+        OPM_TIMEFUNCTION();
+
         this->restart_output.resize(this->m_sched_deck.size());
         this->restart_output.clearRemainingEvents(0);
         this->simUpdateFromPython = std::make_shared<SimulatorUpdate>();
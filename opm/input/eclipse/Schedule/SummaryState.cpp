@@ -20,6 +20,7 @@
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 
 
+#include <opm/common/utility/Revision.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
@@ -269,11 +270,20 @@ namespace Opm
 
     void SummaryState::set(const std::string& key, double value)
     {
-        this->values.insert_or_assign(key, value);
+        auto [pos, inserted] = this->values.try_emplace(key, value);
+        if (inserted || (pos->second != value)) {
+            pos->second = value;
+            this->touch(key);
+        }
     }
 
     bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+        if (this->values.erase(key) == 0) {
+            return false;
+        }
+
+        this->touch(key);
+        return true;
     }
 
     bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
@@ -284,6 +294,8 @@ namespace Opm
 
         erase_var(this->well_values, this->m_wells, var, well);
         this->well_names.reset();
+        this->touch(var);
+        this->well_set_revision_ = Revision::next();
         return true;
     }
 
@@ -295,6 +307,7 @@ namespace Opm
 
         erase_var(this->group_values, this->m_groups, var, group);
         this->group_names.reset();
+        this->touch(var);
         return true;
     }
 
@@ -386,7 +399,9 @@ namespace Opm
 
     void SummaryState::update(const std::string& key, double value)
     {
-        auto& val_ref = this->values[key];
+        auto [pos, inserted] = this->values.try_emplace(key);
+        auto& val_ref = pos->second;
+        const auto prev = val_ref;
 
         if (is_total(key)) {
             val_ref += value;
@@ -394,6 +409,10 @@ namespace Opm
         else {
             val_ref = value;
         }
+
+        if (inserted || (val_ref != prev)) {
+            this->touch(key);
+        }
     }
 
     void SummaryState::update_well_var(const std::string& well,
@@ -401,7 +420,9 @@ namespace Opm
                                        const double       value)
     {
         auto& val_ref  = this->values[fmt::format("{}:{}", var, well)];
-        auto& wval_ref = this->well_values[var][well];
+        auto [wpos, inserted] = this->well_values[var].try_emplace(well);
+        auto& wval_ref = wpos->second;
+        const auto prev = wval_ref;
 
         if (is_total(var)) {
             val_ref  += value;
@@ -411,6 +432,14 @@ namespace Opm
             val_ref = wval_ref = value;
         }
 
+        if (inserted || (wval_ref != prev)) {
+            this->touch(var);
+        }
+
+        if (inserted) {
+            this->well_set_revision_ = Revision::next();
+        }
+
         if (this->m_wells.count(well) == 0) {
             this->m_wells.insert(well);
             this->well_names.reset();
@@ -430,7 +459,9 @@ namespace Opm
                                         const double       value)
     {
         auto& val_ref  = this->values[fmt::format("{}:{}", var, group)];
-        auto& gval_ref = this->group_values[var][group];
+        auto [gpos, inserted] = this->group_values[var].try_emplace(group);
+        auto& gval_ref = gpos->second;
+        const auto prev = gval_ref;
 
         if (type == SummaryConfigNode::Type::Total) {
             val_ref  += value;
@@ -440,6 +471,10 @@ namespace Opm
             val_ref = gval_ref = value;
         }
 
+        if (inserted || (gval_ref != prev)) {
+            this->touch(var);
+        }
+
         if (this->m_groups.count(group) == 0) {
             this->m_groups.insert(group);
             this->group_names.reset();
@@ -498,7 +533,9 @@ namespace Opm
         this->conn_key_buffer_.clear();
         fmt::format_to(std::back_inserter(this->conn_key_buffer_), "{}:{}:{}", var, well, global_index);
         auto& val_ref  = this->values[this->conn_key_buffer_];
-        auto& cval_ref = this->conn_values[var][well][global_index];
+        auto [cpos, inserted] = this->conn_values[var][well].try_emplace(global_index);
+        auto& cval_ref = cpos->second;
+        const auto prev = cval_ref;
 
         if (type == SummaryConfigNode::Type::Total) {
             val_ref  += value;
@@ -507,6 +544,10 @@ namespace Opm
         else {
             val_ref = cval_ref = value;
         }
+
+        if (inserted || (cval_ref != prev)) {
+            this->touch(var);
+        }
     }
 
     void SummaryState::update_segment_var(const std::string& well,
@@ -515,7 +556,9 @@ namespace Opm
                                           const double       value)
     {
         auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, segment)];
-        auto& sval_ref = this->segment_values[var][well][segment];
+        auto [spos, inserted] = this->segment_values[var][well].try_emplace(segment);
+        auto& sval_ref = spos->second;
+        const auto prev = sval_ref;
 
         if (is_total(var)) {
             val_ref  += value;
@@ -524,6 +567,10 @@ namespace Opm
         else {
             val_ref = sval_ref = value;
         }
+
+        if (inserted || (sval_ref != prev)) {
+            this->touch(var);
+        }
     }
 
     void SummaryState::update_region_var(const std::string& regSet,
@@ -534,7 +581,10 @@ namespace Opm
         const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
 
         auto& val_ref  = this->values[region_key(regKw, regSet, region)];
-        auto& rval_ref = this->region_values[regKw][normalise_region_set_name(regSet)][region];
+        auto& rvalues  = this->region_values[regKw][normalise_region_set_name(regSet)];
+        auto [rpos, inserted] = rvalues.try_emplace(region);
+        auto& rval_ref = rpos->second;
+        const auto prev = rval_ref;
 
         if (is_total(regKw)) {
             val_ref  += value;
@@ -543,6 +593,13 @@ namespace Opm
         else {
             val_ref = rval_ref = value;
         }
+
+        if (inserted || (rval_ref != prev)) {
+            this->touch(regKw);
+            if (regKw != var) {
+                this->touch(var);
+            }
+        }
     }
 
     double SummaryState::get(const std::string& key) const
@@ -793,6 +850,27 @@ namespace Opm
             : wellPos->second;
     }
 
+    bool SummaryState::get_well_vars(const std::string&              var,
+                                     const std::vector<std::string>& wells,
+                                     std::vector<double>&            var_values,
+                                     std::vector<unsigned char>&     defined) const
+    {
+        auto varPos = this->well_values.find(var);
+        if (varPos == this->well_values.end()) {
+            return false;
+        }
+
+        var_values.resize(wells.size());
+        defined.resize(wells.size());
+        for (std::size_t i = 0; i < wells.size(); ++i) {
+            auto wellPos = varPos->second.find(wells[i]);
+            defined[i] = wellPos != varPos->second.end();
+            var_values[i] = defined[i] ? wellPos->second : this->udq_undefined;
+        }
+
+        return true;
+    }
+
     double SummaryState::get_group_var(const std::string& group,
                                        const std::string& var,
                                        const double       default_value) const
@@ -863,6 +941,17 @@ namespace Opm
         return *this->well_names;
     }
 
+    std::size_t SummaryState::revision(const std::string& var) const
+    {
+        auto [pos, inserted] = this->var_revision_.try_emplace(var);
+        if (inserted) {
+            // Changes to 'var' have not been tracked so far.
+            pos->second = Revision::next();
+        }
+
+        return std::max(pos->second, this->revision_.value());
+    }
+
     std::vector<std::string> SummaryState::wells(const std::string& var) const
     {
         return var2_list(this->well_values, var);
@@ -907,6 +996,8 @@ namespace Opm
         for (const auto& [var, vals] : buffer.segment_values) {
             this->segment_values.insert_or_assign(var, vals);
         }
+
+        this->revision_.bump();
     }
 
     SummaryState::const_iterator SummaryState::begin() const
@@ -947,6 +1038,18 @@ namespace Opm
             ;
     }
 
+    void SummaryState::touch(const std::string& var)
+    {
+        if (this->var_revision_.empty()) {
+            return;
+        }
+
+        auto pos = this->var_revision_.find(var);
+        if (pos != this->var_revision_.end()) {
+            pos->second = Revision::next();
+        }
+    }
+
     SummaryState SummaryState::serializationTestObject()
     {
         auto st = SummaryState{TimeService::from_time_t(101), 1.234};
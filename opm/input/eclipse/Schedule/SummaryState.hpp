@@ -20,9 +20,11 @@
 #ifndef SUMMARY_STATE_H
 #define SUMMARY_STATE_H
 
+#include <opm/common/utility/Revision.hpp>
 #include <opm/common/utility/TimeService.hpp>
 #include <opm/io/eclipse/SummaryNode.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <ctime>
 #include <iosfwd>
@@ -124,6 +126,15 @@ public:
     double get_segment_var(const std::string& well, const std::string& var, std::size_t segment) const;
     double get_region_var(const std::string& regSet, const std::string& var, std::size_t region) const;
     double get_well_var(const std::string& well, const std::string& var, double) const;
+
+    // Values of the well level variable 'var' for all wells in 'wells', in
+    // the same order, with one lookup of 'var'.  Wells without a value are
+    // flagged as undefined.  Returns false, leaving 'var_values' and 'defined'
+    // untouched, if 'var' is not a well level variable.
+    bool get_well_vars(const std::string& var,
+                       const std::vector<std::string>& wells,
+                       std::vector<double>& var_values,
+                       std::vector<unsigned char>& defined) const;
     double get_group_var(const std::string& group, const std::string& var, double) const;
     double get_conn_var(const std::string& conn, const std::string& var, std::size_t global_index, double) const;
     double get_segment_var(const std::string& well, const std::string& var, std::size_t segment, double) const;
@@ -132,6 +143,31 @@ public:
 
     bool is_undefined_value(const double val) const { return val == udq_undefined; }
 
+    // Revision number (see Opm::Revision) of the last change to any value
+    // of the variable 'var', e.g., 'FOPR' or 'WOPR'.  Changes are tracked
+    // per variable, not per well, group, or other entity.  Variables set
+    // through the general update() and set() functions are tracked by
+    // their full key.
+    //
+    // Changes to a variable are only tracked once its revision has been
+    // requested, so the first request for a variable returns a fresh
+    // revision number.  This keeps updates cheap in runs without clients
+    // such as UDQs.  Not thread safe.
+    std::size_t revision(const std::string& var) const;
+
+    // Revision number of the last change to the object as a whole, e.g.,
+    // through assignment or deserialisation.  Distinct objects have
+    // distinct revisions.
+    std::size_t revision() const { return this->revision_.value(); }
+
+    // Revision number of the last change to the set of wells for which
+    // any well level variable is defined, i.e., to the result of
+    // wells(var) for some 'var'.  Unaffected by changes to the values.
+    std::size_t well_set_revision() const
+    {
+        return std::max(this->well_set_revision_, this->revision_.value());
+    }
+
     const std::vector<std::string>& wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     const std::vector<std::string>& groups() const;
@@ -159,6 +195,10 @@ public:
         serializer(conn_values);
         serializer(segment_values);
         serializer(this->region_values);
+
+        if (!serializer.isSerializing()) {
+            this->revision_.bump();
+        }
     }
 
     static SummaryState serializationTestObject();
@@ -193,6 +233,14 @@ private:
 
     // Reusable buffer for formatting connection keys in update_conn_var to avoid allocation.
     mutable std::string conn_key_buffer_;
+
+    // Revision of the last change to each variable whose revision has
+    // been requested, and of the last change to the object as a whole.
+    mutable std::unordered_map<std::string, std::size_t> var_revision_{};
+    Revision revision_{};
+    std::size_t well_set_revision_{0};
+
+    void touch(const std::string& var);
 };
 
 std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
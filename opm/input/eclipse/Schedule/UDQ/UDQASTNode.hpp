@@ -71,6 +71,10 @@ public:
 
     UDQASTNode* get_left() const;
     UDQASTNode* get_right() const;
+    UDQTokenType get_type() const { return this->type; }
+    const std::variant<std::string, double>& get_value() const { return this->value; }
+    double get_sign() const { return this->sign; }
+    const std::vector<std::string>& get_selector() const { return this->selector; }
     bool operator==(const UDQASTNode& data) const;
     void required_summary(std::unordered_set<std::string>& summary_keys) const;
 
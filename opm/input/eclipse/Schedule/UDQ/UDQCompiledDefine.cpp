@@ -0,0 +1,672 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQCompiledDefine.hpp>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace {
+
+void assign(const double value, double& target, unsigned char& defined)
+{
+    // Mirrors UDQScalar::assign(): Non-finite values are undefined.
+    target = value;
+    defined = std::isfinite(value);
+}
+
+void assign(const std::optional<double>& value,
+            std::vector<double>&         target,
+            std::vector<unsigned char>&  defined)
+{
+    target.resize(1);
+    defined.resize(1);
+
+    if (value.has_value()) {
+        assign(*value, target.front(), defined.front());
+    }
+    else {
+        defined.front() = 0;
+    }
+}
+
+// Elementwise combination of 'lhs' and 'rhs', stored into 'lhs'.  A scalar
+// operand is broadcast to the size of the other operand.  The function
+// 'op' returns whether or not the result is defined.
+template <typename Op>
+void elementwise(std::vector<double>&              lhs,
+                 std::vector<unsigned char>&       lhs_defined,
+                 const std::vector<double>&        rhs,
+                 const std::vector<unsigned char>& rhs_defined,
+                 const bool                        scalar_lhs,
+                 const bool                        scalar_rhs,
+                 Op&&                              op)
+{
+    const auto a0 = lhs.empty() ? 0.0 : lhs.front();
+    const bool da0 = ! lhs_defined.empty() && lhs_defined.front();
+
+    const auto n = scalar_lhs ? rhs.size() : lhs.size();
+    lhs.resize(n);
+    lhs_defined.resize(n);
+
+    for (auto i = 0*n; i < n; ++i) {
+        const auto j = scalar_rhs ? 0 : i;
+        const auto a = scalar_lhs ? a0 : lhs[i];
+        const bool da = scalar_lhs ? da0 : lhs_defined[i];
+
+        auto value = 0.0;
+        const bool defined = op(da, a, rhs_defined[j], rhs[j], value);
+        assign(value, lhs[i], lhs_defined[i]);
+        lhs_defined[i] = lhs_defined[i] && defined;
+    }
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+    std::optional<UDQCompiledDefine>
+    UDQCompiledDefine::compile(const UDQDefine& def, const double cmp_epsilon)
+    {
+        const auto var_type = def.var_type();
+        if ((def.expression() == nullptr) ||
+            ((var_type != UDQVarType::WELL_VAR) &&
+             (var_type != UDQVarType::FIELD_VAR)))
+        {
+            return std::nullopt;
+        }
+
+        auto compiled = UDQCompiledDefine{};
+        compiled.keyword_ = def.keyword();
+        compiled.var_type_ = var_type;
+        compiled.cmp_epsilon_ = cmp_epsilon;
+
+        const auto kind = compiled.compile_node(*def.expression(), 0);
+        if (! kind.has_value()) {
+            return std::nullopt;
+        }
+
+        // Same as the runtime type check in UDQDefine::eval().  Scalar
+        // results are distributed to all wells of a well level UDQ.
+        const auto valid_kind = (*kind == Kind::Scalar)
+            || ((var_type == UDQVarType::WELL_VAR) && (*kind == Kind::Wells))
+            || ((var_type == UDQVarType::FIELD_VAR) && (*kind == Kind::Field));
+
+        if (! valid_kind) {
+            return std::nullopt;
+        }
+
+        return compiled;
+    }
+
+    std::optional<UDQSet> UDQCompiledDefine::eval(const UDQContext& context)
+    {
+        try {
+            for (const auto& instr : this->program_) {
+                if (! this->execute(instr, context)) {
+                    return std::nullopt;
+                }
+            }
+        }
+        catch (const std::exception&) {
+            // Let UDQDefine::eval() report the problem.
+            return std::nullopt;
+        }
+
+        const auto& result = this->slots_.front();
+        const auto& wells = context.wells();
+
+        if (result.kind == Kind::Wells) {
+            auto res = UDQSet::wells(this->keyword_, wells);
+            for (auto i = 0*wells.size(); i < wells.size(); ++i) {
+                if (result.defined[i]) {
+                    res.assign(i, result.value[i]);
+                }
+            }
+
+            return res;
+        }
+
+        const auto value = result.defined.front()
+            ? std::optional<double>{ result.value.front() }
+            : std::nullopt;
+
+        if (this->var_type_ == UDQVarType::WELL_VAR) {
+            return value.has_value()
+                ? UDQSet::wells(this->keyword_, wells, *value)
+                : UDQSet::wells(this->keyword_, wells);
+        }
+
+        if (result.kind == Kind::Field) {
+            auto res = UDQSet { this->keyword_, UDQVarType::FIELD_VAR };
+            res.assign(value);
+            return res;
+        }
+
+        return UDQSet::scalar(this->keyword_, value);
+    }
+
+    std::optional<UDQCompiledDefine::Kind>
+    UDQCompiledDefine::compile_node(const UDQASTNode& node,
+                                    const std::size_t slot)
+    {
+        if (this->slots_.size() <= slot) {
+            this->slots_.resize(slot + 1);
+        }
+
+        auto instr = Instruction{};
+        instr.func = node.get_type();
+        instr.slot = slot;
+
+        auto kind = std::optional<Kind>{};
+
+        if (instr.func == UDQTokenType::ecl_expr) {
+            if (! std::holds_alternative<std::string>(node.get_value())) {
+                return std::nullopt;
+            }
+
+            instr.name = std::get<std::string>(node.get_value());
+            const auto& selector = node.get_selector();
+
+            switch (UDQ::targetType(instr.name)) {
+            case UDQVarType::WELL_VAR:
+                if (selector.empty()) {
+                    instr.op = Op::WellVector;
+                    kind = Kind::Wells;
+                }
+                else if (selector.front().find('*') == std::string::npos) {
+                    instr.op = Op::WellScalar;
+                    instr.well = selector.front();
+                    kind = Kind::Scalar;
+                }
+                break;
+
+            case UDQVarType::GROUP_VAR:
+            case UDQVarType::SEGMENT_VAR:
+            case UDQVarType::REGION_VAR:
+            case UDQVarType::TABLE_LOOKUP:
+                break;
+
+            case UDQVarType::FIELD_VAR:
+                instr.op = Op::Value;
+                kind = Kind::Scalar;
+                break;
+
+            default:
+                instr.op = Op::StrictValue;
+                kind = Kind::Scalar;
+                break;
+            }
+        }
+        else if (UDQ::scalarFunc(instr.func)) {
+            if ((node.get_left() != nullptr) &&
+                this->compile_node(*node.get_left(), slot).has_value())
+            {
+                instr.op = Op::ScalarFunc;
+                kind = Kind::Scalar;
+            }
+        }
+        else if (UDQ::elementalUnaryFunc(instr.func)) {
+            const auto supported = (instr.func != UDQTokenType::elemental_func_randn)
+                && (instr.func != UDQTokenType::elemental_func_randu)
+                && (instr.func != UDQTokenType::elemental_func_rrandn)
+                && (instr.func != UDQTokenType::elemental_func_rrandu)
+                && (instr.func != UDQTokenType::elemental_func_undef);
+
+            if (supported && (node.get_left() != nullptr)) {
+                instr.op = Op::UnaryFunc;
+                kind = this->compile_node(*node.get_left(), slot);
+            }
+        }
+        else if (UDQ::binaryFunc(instr.func)) {
+            if ((node.get_left() == nullptr) || (node.get_right() == nullptr)) {
+                return std::nullopt;
+            }
+
+            const auto lhs = this->compile_node(*node.get_left(), slot);
+            const auto rhs = lhs.has_value()
+                ? this->compile_node(*node.get_right(), slot + 1)
+                : std::nullopt;
+
+            if (! rhs.has_value()) {
+                return std::nullopt;
+            }
+
+            instr.op = Op::BinaryFunc;
+            if (UDQ::setFunc(instr.func)) {
+                // The union functions do not broadcast scalars.
+                if ((*lhs == Kind::Wells) == (*rhs == Kind::Wells)) {
+                    kind = lhs;
+                }
+            }
+            else {
+                kind = ((*lhs == Kind::Wells) || (*rhs == Kind::Wells))
+                    ? Kind::Wells : *lhs;
+            }
+        }
+        else if ((instr.func == UDQTokenType::number) &&
+                 std::holds_alternative<double>(node.get_value()))
+        {
+            instr.op = Op::Number;
+            instr.number = std::get<double>(node.get_value());
+
+            switch (this->var_type_) {
+            case UDQVarType::WELL_VAR:  kind = Kind::Wells;  break;
+            case UDQVarType::FIELD_VAR: kind = Kind::Field;  break;
+            case UDQVarType::SCALAR:    kind = Kind::Scalar; break;
+            default: break;
+            }
+        }
+
+        if (! kind.has_value()) {
+            return std::nullopt;
+        }
+
+        instr.kind = *kind;
+        this->program_.push_back(instr);
+
+        if (node.get_sign() != 1.0) {
+            auto scale = Instruction{};
+            scale.op = Op::Scale;
+            scale.kind = *kind;
+            scale.slot = slot;
+            scale.number = node.get_sign();
+
+            this->program_.push_back(std::move(scale));
+        }
+
+        return kind;
+    }
+
+    bool UDQCompiledDefine::execute(const Instruction& instr,
+                                    const UDQContext&  context)
+    {
+        auto& out = this->slots_[instr.slot];
+
+        switch (instr.op) {
+        case Op::Number: {
+            const auto n = (instr.kind == Kind::Wells) ? context.wells().size() : 1;
+
+            out.kind = instr.kind;
+            out.value.resize(n);
+            out.defined.resize(n);
+            for (auto i = 0*n; i < n; ++i) {
+                assign(instr.number, out.value[i], out.defined[i]);
+            }
+            return true;
+        }
+
+        case Op::WellVector:
+            out.kind = Kind::Wells;
+            context.get_well_vars(instr.name, out.value, out.defined);
+            for (auto i = 0*out.value.size(); i < out.value.size(); ++i) {
+                out.defined[i] = out.defined[i] && std::isfinite(out.value[i]);
+            }
+            return true;
+
+        case Op::WellScalar:
+            out.kind = Kind::Scalar;
+            assign(context.get_well_var(instr.well, instr.name), out.value, out.defined);
+            return true;
+
+        case Op::Value:
+            out.kind = Kind::Scalar;
+            assign(context.get(instr.name), out.value, out.defined);
+            return true;
+
+        case Op::StrictValue: {
+            const auto value = context.get(instr.name);
+            if (! value.has_value()) {
+                return false;
+            }
+
+            out.kind = Kind::Scalar;
+            assign(value, out.value, out.defined);
+            return true;
+        }
+
+        case Op::ScalarFunc:
+            return this->scalar_function(instr.func, out);
+
+        case Op::UnaryFunc:
+            return this->unary_function(instr.func, out);
+
+        case Op::BinaryFunc:
+            return this->binary_function(instr.func, instr.kind, out,
+                                         this->slots_[instr.slot + 1]);
+
+        case Op::Scale:
+            for (auto i = 0*out.value.size(); i < out.value.size(); ++i) {
+                if (out.defined[i]) {
+                    assign(out.value[i] * instr.number, out.value[i], out.defined[i]);
+                }
+            }
+            return true;
+        }
+
+        return false;
+    }
+
+    bool UDQCompiledDefine::scalar_function(const UDQTokenType func, Slot& arg)
+    {
+        // Same algorithms, and order of operations, as in UDQScalarFunction.
+        auto& values = this->scratch_;
+        values.clear();
+        for (auto i = 0*arg.value.size(); i < arg.value.size(); ++i) {
+            if (arg.defined[i]) {
+                values.push_back(arg.value[i]);
+            }
+        }
+
+        if (values.empty()) {
+            return false;
+        }
+
+        auto result = 0.0;
+        switch (func) {
+        case UDQTokenType::scalar_func_sum:
+            result = std::accumulate(values.begin(), values.end(), 0.0);
+            break;
+
+        case UDQTokenType::scalar_func_avea:
+            result = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+            break;
+
+        case UDQTokenType::scalar_func_aveg: {
+            if (std::ranges::any_of(values, [](const double x) { return x <= 0; })) {
+                return false;
+            }
+
+            const auto log_mean = std::accumulate(values.begin(), values.end(), 0.0,
+                                                  [](double x, double y) { return x + std::log(y); })
+                / values.size();
+
+            result = std::exp(log_mean);
+            break;
+        }
+
+        case UDQTokenType::scalar_func_aveh:
+            result = values.size() / std::accumulate(values.begin(), values.end(), 0.0,
+                                                     [](double x, double y) { return x + 1.0/y; });
+            break;
+
+        case UDQTokenType::scalar_func_max:
+            result = *std::ranges::max_element(values);
+            break;
+
+        case UDQTokenType::scalar_func_min:
+            result = *std::ranges::min_element(values);
+            break;
+
+        case UDQTokenType::scalar_func_norm1:
+            result = std::accumulate(values.begin(), values.end(), 0.0,
+                                     [](double x, double y) { return x + std::fabs(y); });
+            break;
+
+        case UDQTokenType::scalar_func_norm2:
+            result = std::sqrt(std::inner_product(values.begin(), values.end(),
+                                                  values.begin(), 0.0));
+            break;
+
+        case UDQTokenType::scalar_func_normi:
+            result = std::accumulate(values.begin(), values.end(), 0.0,
+                                     [](double x, double y) { return std::max(x, std::fabs(y)); });
+            break;
+
+        case UDQTokenType::scalar_func_prod:
+            result = std::accumulate(values.begin(), values.end(), 1.0, std::multiplies<double>{});
+            break;
+
+        default:
+            return false;
+        }
+
+        arg.kind = Kind::Scalar;
+        assign(std::optional<double>{ result }, arg.value, arg.defined);
+        return true;
+    }
+
+    bool UDQCompiledDefine::unary_function(const UDQTokenType func, Slot& arg)
+    {
+        const auto n = arg.value.size();
+
+        auto transform = [&arg, n](auto&& f)
+        {
+            for (auto i = 0*n; i < n; ++i) {
+                if (arg.defined[i]) {
+                    assign(f(arg.value[i]), arg.value[i], arg.defined[i]);
+                }
+            }
+        };
+
+        switch (func) {
+        case UDQTokenType::elemental_func_abs:
+            transform([](const double x) { return std::fabs(x); });
+            return true;
+
+        case UDQTokenType::elemental_func_def:
+            transform([](const double) { return 1.0; });
+            return true;
+
+        case UDQTokenType::elemental_func_exp:
+            transform([](const double x) { return std::exp(x); });
+            return true;
+
+        case UDQTokenType::elemental_func_nint:
+            transform([](const double x) { return std::nearbyint(x); });
+            return true;
+
+        case UDQTokenType::elemental_func_idv:
+            for (auto i = 0*n; i < n; ++i) {
+                arg.value[i] = arg.defined[i] ? 1.0 : 0.0;
+                arg.defined[i] = 1;
+            }
+            return true;
+
+        case UDQTokenType::elemental_func_ln:
+        case UDQTokenType::elemental_func_log:
+            for (auto i = 0*n; i < n; ++i) {
+                if (arg.defined[i] && !(arg.value[i] > 0.0)) {
+                    return false;
+                }
+            }
+
+            if (func == UDQTokenType::elemental_func_ln) {
+                transform([](const double x) { return std::log(x); });
+            }
+            else {
+                transform([](const double x) { return std::log10(x); });
+            }
+            return true;
+
+        case UDQTokenType::elemental_func_sorta:
+        case UDQTokenType::elemental_func_sortd: {
+            // Ranks of defined values, using the same sorting algorithm as
+            // UDQUnaryElementalFunction to get the same order of ties.
+            auto& ix = this->order_;
+            ix.clear();
+            for (auto i = 0*n; i < n; ++i) {
+                if (arg.defined[i]) {
+                    ix.push_back(static_cast<int>(i));
+                }
+            }
+
+            const auto& value = arg.value;
+            if (func == UDQTokenType::elemental_func_sorta) {
+                std::ranges::sort(ix, [&value](const int i1, const int i2)
+                                  { return std::less<>{}(value[i1], value[i2]); });
+            }
+            else {
+                std::ranges::sort(ix, [&value](const int i1, const int i2)
+                                  { return std::greater<>{}(value[i1], value[i2]); });
+            }
+
+            auto sort_value = 1.0;
+            for (const auto& i : ix) {
+                arg.value[i] = sort_value++;
+            }
+            return true;
+        }
+
+        default:
+            return false;
+        }
+    }
+
+    bool UDQCompiledDefine::binary_function(const UDQTokenType func,
+                                            const Kind         kind,
+                                            Slot&              lhs,
+                                            const Slot&        rhs)
+    {
+        const auto scalar_lhs = lhs.kind != Kind::Wells;
+        const auto scalar_rhs = rhs.kind != Kind::Wells;
+
+        if (! UDQ::setFunc(func) && (scalar_lhs != scalar_rhs)) {
+            // Broadcasting a scalar to all wells requires a defined value.
+            if (! (scalar_lhs ? lhs : rhs).defined.front()) {
+                return false;
+            }
+        }
+
+        lhs.kind = kind;
+
+        auto apply = [&lhs, &rhs, scalar_lhs, scalar_rhs](auto&& op)
+        {
+            elementwise(lhs.value, lhs.defined, rhs.value, rhs.defined,
+                        scalar_lhs, scalar_rhs, op);
+        };
+
+        // Comparisons are defined where the sum of the operands is.
+        auto compare = [&apply](auto&& cmp)
+        {
+            apply([&cmp](bool da, double a, bool db, double b, double& v)
+            {
+                if (! (da && db && std::isfinite(a + b))) {
+                    return false;
+                }
+
+                v = cmp(a, b);
+                return true;
+            });
+        };
+
+        // Union functions take the defined operand if only one of them is.
+        auto set_union = [&apply](auto&& f)
+        {
+            apply([&f](bool da, double a, bool db, double b, double& v)
+            {
+                v = (da && db) ? f(b, a) : (da ? a : b);
+                return da || db;
+            });
+        };
+
+        const auto eps = this->cmp_epsilon_;
+
+        switch (func) {
+        case UDQTokenType::binary_op_add:
+            apply([](bool da, double a, bool db, double b, double& v)
+                  { v = a + b; return da && db; });
+            return true;
+
+        case UDQTokenType::binary_op_sub:
+            apply([](bool da, double a, bool db, double b, double& v)
+                  { v = a - b; return da && db; });
+            return true;
+
+        case UDQTokenType::binary_op_mul:
+            apply([](bool da, double a, bool db, double b, double& v)
+                  { v = a * b; return da && db; });
+            return true;
+
+        case UDQTokenType::binary_op_div:
+            apply([](bool da, double a, bool db, double b, double& v)
+                  { v = a / b; return da && db; });
+            return true;
+
+        case UDQTokenType::binary_op_pow:
+            apply([](bool da, double a, bool db, double b, double& v)
+                  { v = std::pow(a, b); return da && db; });
+            return true;
+
+        case UDQTokenType::binary_op_uadd:
+            set_union([](double x, double y) { return x + y; });
+            return true;
+
+        case UDQTokenType::binary_op_umul:
+            set_union([](double x, double y) { return x * y; });
+            return true;
+
+        case UDQTokenType::binary_op_umin:
+            set_union([](double x, double y) { return std::min(x, y); });
+            return true;
+
+        case UDQTokenType::binary_op_umax:
+            set_union([](double x, double y) { return std::max(x, y); });
+            return true;
+
+        case UDQTokenType::binary_cmp_eq:
+            compare([eps](double x, double y)
+                    { return ! (std::abs(x - y) > eps * std::max(std::abs(x), std::abs(y))); });
+            return true;
+
+        case UDQTokenType::binary_cmp_ne:
+            compare([eps](double x, double y)
+                    { return 1 - ! (std::abs(x - y) > eps * std::max(std::abs(x), std::abs(y))); });
+            return true;
+
+        case UDQTokenType::binary_cmp_le:
+            compare([eps](double x, double y)
+                    { return (x == y) || ! (y + eps * std::max(std::abs(x), std::abs(y)) < x); });
+            return true;
+
+        case UDQTokenType::binary_cmp_ge:
+            compare([eps](double x, double y)
+                    { return (x == y) || ! (x < y - eps * std::max(std::abs(x), std::abs(y))); });
+            return true;
+
+        case UDQTokenType::binary_cmp_lt:
+            apply([](bool da, double a, bool db, double b, double& v)
+                  { v = (a - b) < 0.0; return da && db && std::isfinite(a - b); });
+            return true;
+
+        case UDQTokenType::binary_cmp_gt:
+            apply([](bool da, double a, bool db, double b, double& v)
+                  { v = (a - b) > 0.0; return da && db && std::isfinite(a - b); });
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+} // namespace Opm
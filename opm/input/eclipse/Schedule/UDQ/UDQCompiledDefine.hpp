@@ -0,0 +1,141 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_COMPILED_DEFINE_HPP
+#define UDQ_COMPILED_DEFINE_HPP
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+    class UDQASTNode;
+    class UDQContext;
+    class UDQDefine;
+
+} // namespace Opm
+
+namespace Opm {
+
+    /// Defining expression of a well or field level UDQ, flattened into a
+    /// sequence of instructions which operate on dense value arrays.
+    ///
+    /// Each instruction writes its result into a stack slot holding one
+    /// value and one definedness flag per well, or a single value for
+    /// scalars.  The slots are kept between evaluations, so repeated
+    /// evaluation does not allocate once the number of wells is stable.
+    /// Well level summary vectors are fetched once per vector rather than
+    /// once per well.
+    ///
+    /// The compiled form reproduces the results of UDQDefine::eval()
+    /// exactly.  Expressions using features which are not compiled (group,
+    /// segment, region and table lookup terms, well name patterns, random
+    /// numbers, UNDEF) are rejected by compile(), and eval() returns
+    /// nullopt whenever the defining expression would fail at runtime, in
+    /// which case the caller is expected to use UDQDefine::eval() instead.
+    class UDQCompiledDefine
+    {
+    public:
+        /// Compile defining expression.
+        ///
+        /// \param[in] def UDQ definition.
+        ///
+        /// \param[in] cmp_epsilon Relative tolerance of the comparison
+        /// operators.  Typically UDQParams::cmpEpsilon().
+        ///
+        /// \return Compiled definition.  Nullopt if \p def cannot be
+        /// compiled.
+        static std::optional<UDQCompiledDefine>
+        compile(const UDQDefine& def, double cmp_epsilon);
+
+        /// Evaluate defining expression.
+        ///
+        /// Safe to call concurrently for different objects sharing the
+        /// same context, as long as the context is not updated meanwhile.
+        ///
+        /// \param[in] context Pattern matchers and state objects.
+        ///
+        /// \return Same result as UDQDefine::eval().  Nullopt if the
+        /// evaluation failed, e.g., due to a non-positive argument of LN,
+        /// or a scalar function of an empty set.
+        std::optional<UDQSet> eval(const UDQContext& context);
+
+        /// Name of compiled UDQ.
+        const std::string& keyword() const { return this->keyword_; }
+
+    private:
+        /// Shape of an intermediate result.  Field and scalar values
+        /// differ only in their UDQ type.
+        enum class Kind : unsigned char { Scalar, Field, Wells };
+
+        enum class Op : unsigned char {
+            Number,       // Constant
+            WellVector,   // Well vector for all wells
+            WellScalar,   // Well vector for a single named well
+            Value,        // Field or other scalar vector, may be undefined
+            StrictValue,  // Scalar vector which must exist
+            ScalarFunc,   // SUM, AVEA, ...
+            UnaryFunc,    // ABS, DEF, ...
+            BinaryFunc,   // +, -, ...
+            Scale,        // Unary minus and other sign factors
+        };
+
+        struct Instruction
+        {
+            Op op{};
+            UDQTokenType func{UDQTokenType::error};
+            Kind kind{};
+            std::size_t slot{};
+            double number{};
+            std::string name{};
+            std::string well{};
+        };
+
+        struct Slot
+        {
+            Kind kind{};
+            std::vector<double> value{};
+            std::vector<unsigned char> defined{};
+        };
+
+        std::string keyword_{};
+        UDQVarType var_type_{UDQVarType::NONE};
+        double cmp_epsilon_{};
+        std::vector<Instruction> program_{};
+        std::vector<Slot> slots_{};
+        std::vector<double> scratch_{};
+        std::vector<int> order_{};
+
+        std::optional<Kind> compile_node(const UDQASTNode& node,
+                                         std::size_t       slot);
+
+        bool execute(const Instruction& instr, const UDQContext& context);
+        bool scalar_function(UDQTokenType func, Slot& arg);
+        bool unary_function(UDQTokenType func, Slot& arg);
+        bool binary_function(UDQTokenType func, Kind kind, Slot& lhs, const Slot& rhs);
+    };
+
+} // namespace Opm
+
+#endif // UDQ_COMPILED_DEFINE_HPP
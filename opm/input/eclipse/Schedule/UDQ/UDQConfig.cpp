@@ -32,6 +32,7 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEvalPlan.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQInput.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
@@ -46,6 +47,7 @@
 #include <cassert>
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -675,12 +677,24 @@ namespace Opm {
         }
     }
 
+    std::vector<UDQDefineStatistics> UDQConfig::define_statistics() const
+    {
+        if (this->eval_plan_ == nullptr) {
+            return {};
+        }
+
+        return this->eval_plan_->statistics();
+    }
+
     // ===========================================================================
     // Private member functions below separator
     // ===========================================================================
 
     void UDQConfig::add_node(const std::string& quantity, const UDQAction action)
     {
+        // Evaluation order and compiled definitions are out of date.
+        this->eval_plan_.reset();
+
         auto index_iter = this->input_index.find(quantity);
         if (this->input_index.find(quantity) == this->input_index.end()) {
             auto var_type = UDQ::varType(quantity);
@@ -759,40 +773,42 @@ namespace Opm {
                                 const UDQState&   udq_state,
                                 UDQContext&       context) const
     {
-        auto var_type_bit = [](const UDQVarType var_type)
-        {
-            return 1ul << static_cast<std::size_t>(var_type);
-        };
+        if (this->eval_plan_ == nullptr) {
+            auto var_type_bit = [](const UDQVarType var_type)
+            {
+                return 1ul << static_cast<std::size_t>(var_type);
+            };
 
-        auto select_var_type = std::size_t{0};
-        select_var_type |= var_type_bit(UDQVarType::WELL_VAR);
-        select_var_type |= var_type_bit(UDQVarType::GROUP_VAR);
-        select_var_type |= var_type_bit(UDQVarType::FIELD_VAR);
-        select_var_type |= var_type_bit(UDQVarType::SEGMENT_VAR);
+            auto select_var_type = std::size_t{0};
+            select_var_type |= var_type_bit(UDQVarType::WELL_VAR);
+            select_var_type |= var_type_bit(UDQVarType::GROUP_VAR);
+            select_var_type |= var_type_bit(UDQVarType::FIELD_VAR);
+            select_var_type |= var_type_bit(UDQVarType::SEGMENT_VAR);
 
-        for (const auto& [keyword, index] : this->input_index) {
-            if (index.action != UDQAction::DEFINE) {
-                continue;
-            }
+            auto defines = std::vector<const UDQDefine*>{};
+            for (const auto& [keyword, index] : this->input_index) {
+                if (index.action != UDQAction::DEFINE) {
+                    continue;
+                }
 
-            auto def_pos = this->m_definitions.find(keyword);
-            if (def_pos == this->m_definitions.end()) { // No such def
-                throw std::logic_error {
-                    fmt::format("Internal error: UDQ '{}' is not among "
-                                "those DEFINEd for numerical evaluation", keyword)
-                };
-            }
+                auto def_pos = this->m_definitions.find(keyword);
+                if (def_pos == this->m_definitions.end()) { // No such def
+                    throw std::logic_error {
+                        fmt::format("Internal error: UDQ '{}' is not among "
+                                    "those DEFINEd for numerical evaluation", keyword)
+                    };
+                }
 
-            const auto& def = def_pos->second;
-            if (((select_var_type & var_type_bit(def.var_type())) == 0) || // Unwanted Var Type
-                ! udq_state.define(def.status())) // UDQ def not applicable now
-            {
-                continue;
+                if ((select_var_type & var_type_bit(def_pos->second.var_type())) != 0) {
+                    defines.push_back(&def_pos->second);
+                }
             }
 
-            context.update_define(report_step, keyword, def.eval(context));
-            def.clear_next();
+            this->eval_plan_ = std::make_shared<UDQEvalPlan>
+                (defines, this->udq_params.cmpEpsilon());
         }
+
+        this->eval_plan_->eval(report_step, this->m_definitions, udq_state, context);
     }
 
     void UDQConfig::add_enumerated_assign(const std::string&              quantity,
@@ -52,7 +52,9 @@ namespace Opm {
     class Schedule;
     class SegmentMatcher;
     class SummaryState;
+    class UDQEvalPlan;
     class UDQState;
+    struct UDQDefineStatistics;
     class WellMatcher;
 
 } // namespace Opm
@@ -532,6 +534,16 @@ namespace Opm {
         /// this set.
         void required_summary(std::unordered_set<std::string>& summary_keys) const;
 
+        /// Evaluation statistics, such as the number of evaluations and
+        /// the time spent in them, of each DEFINE statement.
+        ///
+        /// Accumulated since the collection of user defined quantities
+        /// last changed.
+        ///
+        /// \return Statistics in order of appearance in the input.  Empty
+        /// if DEFINE statements have not been evaluated.
+        std::vector<UDQDefineStatistics> define_statistics() const;
+
         /// Convert between byte array and object representation.
         ///
         /// \tparam Serializer Byte array conversion protocol.
@@ -551,9 +563,11 @@ namespace Opm {
             serializer(pending_assignments_);
 
             // The UDQFunction table is constant up to udq_params, so we can
-            // just construct a new instance here.
+            // just construct a new instance here.  Likewise, the evaluation
+            // plan is rebuilt from the definitions on first use.
             if (!serializer.isSerializing()) {
                 udqft = UDQFunctionTable(udq_params);
+                eval_plan_.reset();
             }
         }
 
@@ -615,6 +629,12 @@ namespace Opm {
         ///    UDQConfig::eval_assign(step, sched, context) const
         mutable std::vector<std::string> pending_assignments_{};
 
+        /// Evaluation order and compiled form of the DEFINE statements.
+        ///
+        /// Built on first use in eval_define() and discarded whenever the
+        /// collection of UDQs changes.  Not part of the object's value.
+        mutable std::shared_ptr<UDQEvalPlan> eval_plan_{};
+
         /// Incorporate operation for new or existing UDQ
         ///
         /// Preserves order of operations in input_index.
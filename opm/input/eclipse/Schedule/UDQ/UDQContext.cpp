@@ -30,6 +30,7 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <functional>
@@ -132,6 +133,30 @@ namespace Opm {
         };
     }
 
+    void UDQContext::get_well_vars(const std::string&          var,
+                                   std::vector<double>&        var_values,
+                                   std::vector<unsigned char>& defined) const
+    {
+        // Same as get_well_var() for every well in wells(), but with a
+        // single lookup of 'var' in the underlying state objects.
+        if (this->wells().empty()) {
+            var_values.clear();
+            defined.clear();
+            return;
+        }
+
+        if (is_udq(var)) {
+            this->udq_state.get_well_vars(var, this->wells(), var_values, defined);
+            return;
+        }
+
+        if (! this->summary_state.get_well_vars(var, this->wells(), var_values, defined)) {
+            throw std::logic_error {
+                fmt::format("Summary well variable: {} not registered", var)
+            };
+        }
+    }
+
     std::optional<double>
     UDQContext::get_group_var(const std::string& group,
                               const std::string& var) const
@@ -210,6 +235,22 @@ namespace Opm {
         return it->second;
     }
 
+    std::size_t UDQContext::revision(const std::string& name) const
+    {
+        // Revision of the last change to summary vector or UDQ 'name' in
+        // either of the underlying state objects.  Values added directly
+        // to the context are constant.
+        return std::max(this->summary_state.revision(name),
+                        this->udq_state.revision(name));
+    }
+
+    std::pair<std::size_t, std::size_t> UDQContext::state_revision() const
+    {
+        // Revisions of the underlying state objects as a whole.  Distinct
+        // objects have distinct revisions.
+        return { this->summary_state.revision(), this->udq_state.revision() };
+    }
+
     const std::vector<std::string>& UDQContext::wells() const
     {
         return this->well_matcher.wells();
@@ -29,6 +29,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -68,6 +69,10 @@ namespace Opm {
         std::optional<double>
         get_well_var(const std::string& well, const std::string& var) const;
 
+        void get_well_vars(const std::string& var,
+                           std::vector<double>& var_values,
+                           std::vector<unsigned char>& defined) const;
+
         std::optional<double>
         get_group_var(const std::string& group, const std::string& var) const;
 
@@ -91,6 +96,9 @@ namespace Opm {
 
         const UDQFunctionTable& function_table() const;
 
+        std::size_t revision(const std::string& name) const;
+        std::pair<std::size_t, std::size_t> state_revision() const;
+
         const std::vector<std::string>& wells() const;
         std::vector<std::string> wells(const std::string& pattern) const;
         std::vector<std::string> nonFieldGroups() const;
@@ -85,6 +85,7 @@ public:
     UDQ::RequisiteEvaluationObjects requiredObjects() const;
 
     UDQSet eval(const UDQContext& context) const;
+    const UDQASTNode* expression() const { return this->ast.get(); }
     const std::string& keyword() const;
     const std::string& input_string() const { return this->input_string_; }
     const KeywordLocation& location() const;
@@ -0,0 +1,284 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQEvalPlan.hpp>
+
+#include <opm/common/utility/Revision.hpp>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQCompiledDefine.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+namespace {
+
+// All names in an expression, i.e., summary vectors, UDQs, well and group
+// names, and table names.  A superset of the UDQs the expression uses.
+void collect_names(const Opm::UDQASTNode&           node,
+                   std::unordered_set<std::string>& names)
+{
+    if (const auto* name = std::get_if<std::string>(&node.get_value());
+        name != nullptr)
+    {
+        names.insert(*name);
+    }
+
+    names.insert(node.get_selector().begin(), node.get_selector().end());
+
+    if (node.get_left() != nullptr) {
+        collect_names(*node.get_left(), names);
+    }
+
+    if (node.get_right() != nullptr) {
+        collect_names(*node.get_right(), names);
+    }
+}
+
+bool is_udq(const std::string& key)
+{
+    return (key.size() >= std::string::size_type{2})
+        && (key[1] == 'U');
+}
+
+bool uses_random_numbers(const Opm::UDQASTNode& node)
+{
+    switch (node.get_type()) {
+    case Opm::UDQTokenType::elemental_func_randn:
+    case Opm::UDQTokenType::elemental_func_randu:
+    case Opm::UDQTokenType::elemental_func_rrandn:
+    case Opm::UDQTokenType::elemental_func_rrandu:
+        return true;
+
+    default:
+        break;
+    }
+
+    return ((node.get_left() != nullptr) && uses_random_numbers(*node.get_left()))
+        || ((node.get_right() != nullptr) && uses_random_numbers(*node.get_right()));
+}
+
+double seconds_since(const std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double> {
+        std::chrono::steady_clock::now() - start
+    }.count();
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+    UDQEvalPlan::UDQEvalPlan(const std::vector<const UDQDefine*>& defines,
+                             const double                         cmp_epsilon)
+    {
+        const auto n = defines.size();
+
+        auto position = std::unordered_map<std::string, std::size_t>{};
+        for (auto i = 0*n; i < n; ++i) {
+            position.emplace(defines[i]->keyword(), i);
+        }
+
+        // wave[i] >= min_wave[i] for definitions referred to by earlier
+        // definitions, which must read the value from the previous
+        // evaluation.
+        auto wave = std::vector<std::size_t>(n, 0);
+        auto min_wave = std::vector<std::size_t>(n, 0);
+        auto names = std::unordered_set<std::string>{};
+
+        this->steps_.reserve(n);
+        for (auto i = 0*n; i < n; ++i) {
+            const auto& def = *defines[i];
+
+            names.clear();
+            if (def.expression() != nullptr) {
+                collect_names(*def.expression(), names);
+            }
+
+            wave[i] = min_wave[i];
+            for (const auto& name : names) {
+                const auto pos = position.find(name);
+                if ((pos == position.end()) || (pos->second == i)) {
+                    continue;
+                }
+
+                const auto j = pos->second;
+                if (j < i) {
+                    wave[i] = std::max(wave[i], wave[j] + 1);
+                }
+            }
+
+            for (const auto& name : names) {
+                const auto pos = position.find(name);
+                if ((pos != position.end()) && (pos->second > i)) {
+                    min_wave[pos->second] = std::max(min_wave[pos->second], wave[i]);
+                }
+            }
+
+            if (wave[i] >= this->waves_.size()) {
+                this->waves_.resize(wave[i] + 1);
+            }
+
+            this->waves_[wave[i]].push_back(i);
+
+            auto& step = this->steps_.emplace_back();
+            step.keyword = def.keyword();
+            step.compiled = UDQCompiledDefine::compile(def, cmp_epsilon);
+            step.statistics.keyword = def.keyword();
+
+            // Inputs are the summary vectors and the UDQs the definition
+            // reads.  A definition which reads its own previous value must
+            // always be evaluated, since its inputs change by storing the
+            // result.
+            auto inputs = std::unordered_set<std::string>{};
+            def.required_summary(inputs);
+            for (const auto& name : names) {
+                if (is_udq(name)) {
+                    inputs.insert(name);
+                }
+            }
+
+            step.always = (inputs.count(def.keyword()) > 0)
+                || ((def.expression() != nullptr) &&
+                    uses_random_numbers(*def.expression()));
+
+            inputs.insert(def.keyword());
+            step.inputs.assign(inputs.begin(), inputs.end());
+        }
+    }
+
+    void UDQEvalPlan::eval(const std::size_t                                 report_step,
+                           const std::unordered_map<std::string, UDQDefine>& definitions,
+                           const UDQState&                                   udq_state,
+                           UDQContext&                                       context)
+    {
+        const auto incremental = (this->report_step_ == report_step)
+            && (this->state_revision_ == context.state_revision())
+            && (this->wells_ == context.wells());
+
+        for (const auto& wave : this->waves_) {
+            this->active_.clear();
+            for (const auto& i : wave) {
+                auto& step = this->steps_[i];
+                const auto& def = definitions.at(step.keyword);
+                if (! udq_state.define(def.status())) {
+                    continue;
+                }
+
+                // Checked at every evaluation, since this also starts the
+                // tracking of changes to the inputs.
+                const auto changed = step.always || inputs_changed(step, context);
+                if (incremental && !changed) {
+                    // Stored value is up to date.
+                    ++step.statistics.skipped;
+                    def.clear_next();
+                    continue;
+                }
+
+                this->active_.push_back(i);
+            }
+
+            // Evaluation of a compiled definition only reads from the
+            // context and never throws.
+            const auto& ctx = context;
+            const auto num_active = static_cast<int>(this->active_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int k = 0; k < num_active; ++k) {
+                auto& step = this->steps_[this->active_[k]];
+                step.result.reset();
+
+                if (step.compiled.has_value()) {
+                    const auto start = std::chrono::steady_clock::now();
+                    step.result = step.compiled->eval(ctx);
+                    step.statistics.seconds += seconds_since(start);
+                }
+            }
+
+            // Definitions which are not compiled, or whose compiled form
+            // could not be evaluated, in order of appearance.
+            for (const auto& i : this->active_) {
+                auto& step = this->steps_[i];
+                if (! step.result.has_value()) {
+                    const auto start = std::chrono::steady_clock::now();
+                    step.result = definitions.at(step.keyword).eval(context);
+                    step.statistics.seconds += seconds_since(start);
+                }
+            }
+
+            for (const auto& i : this->active_) {
+                auto& step = this->steps_[i];
+                context.update_define(report_step, step.keyword, *step.result);
+                definitions.at(step.keyword).clear_next();
+
+                step.result.reset();
+                step.revision = Revision::next();
+                ++step.statistics.evaluations;
+            }
+        }
+
+        this->report_step_ = report_step;
+        this->state_revision_ = context.state_revision();
+        if (! incremental) {
+            this->wells_ = context.wells();
+        }
+    }
+
+    std::vector<UDQDefineStatistics> UDQEvalPlan::statistics() const
+    {
+        auto stats = std::vector<UDQDefineStatistics>{};
+        stats.reserve(this->steps_.size());
+
+        for (const auto& step : this->steps_) {
+            stats.push_back(step.statistics);
+        }
+
+        return stats;
+    }
+
+    bool UDQEvalPlan::inputs_changed(const Step& step, const UDQContext& context)
+    {
+        // Request the revisions of all inputs, rather than stopping at the
+        // first change, so that changes to each of them are tracked.
+        auto latest = std::size_t{0};
+        for (const auto& input : step.inputs) {
+            latest = std::max(latest, context.revision(input));
+        }
+
+        return latest > step.revision;
+    }
+
+    std::size_t UDQEvalPlan::num_compiled() const
+    {
+        return std::count_if(this->steps_.begin(), this->steps_.end(),
+                             [](const Step& step)
+                             { return step.compiled.has_value(); });
+    }
+
+} // namespace Opm
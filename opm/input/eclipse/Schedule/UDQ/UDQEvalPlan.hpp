@@ -0,0 +1,165 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_EVAL_PLAN_HPP
+#define UDQ_EVAL_PLAN_HPP
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQCompiledDefine.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+    class UDQContext;
+    class UDQDefine;
+    class UDQState;
+
+} // namespace Opm
+
+namespace Opm {
+
+    /// Evaluation statistics of a single UDQ definition.
+    struct UDQDefineStatistics
+    {
+        /// UDQ name.
+        std::string keyword{};
+
+        /// Number of times the defining expression was evaluated.
+        std::size_t evaluations{};
+
+        /// Number of times evaluation was skipped because none of the
+        /// inputs of the defining expression had changed.
+        std::size_t skipped{};
+
+        /// Total wall clock time, in seconds, spent evaluating the
+        /// defining expression.
+        double seconds{};
+    };
+
+    /// Evaluation order of a run's UDQ definitions.
+    ///
+    /// The definitions are grouped into waves.  A definition is placed in a
+    /// later wave than all earlier definitions it refers to, and in no
+    /// earlier wave than all earlier definitions which refer to it and thus
+    /// expect its value from the previous evaluation.  The definitions of
+    /// a wave are therefore independent of one another.  They are all
+    /// evaluated before any of their results are stored, and the compiled
+    /// ones (see UDQCompiledDefine) are evaluated in parallel when OpenMP
+    /// is available.  The end result is the same as evaluating all
+    /// definitions one by one in order of appearance.
+    ///
+    /// Evaluation is incremental.  Each definition records the summary
+    /// vectors and UDQs it reads, and is evaluated anew only if one of
+    /// them changed (see SummaryState::revision() and UDQState::revision())
+    /// since the definition's value was last stored.  Since UDQ values
+    /// only count as changed if they actually differ, unchanged values do
+    /// not propagate further down a chain of definitions.  All applicable
+    /// definitions are evaluated at the first evaluation of a report step,
+    /// when the state objects are replaced, and when the set of wells
+    /// changes.
+    class UDQEvalPlan
+    {
+    public:
+        /// Constructor.
+        ///
+        /// \param[in] defines UDQ definitions in order of appearance in
+        /// the input.
+        ///
+        /// \param[in] cmp_epsilon Relative tolerance of the comparison
+        /// operators.  Typically UDQParams::cmpEpsilon().
+        UDQEvalPlan(const std::vector<const UDQDefine*>& defines,
+                    double                               cmp_epsilon);
+
+        /// Compute new values for all applicable UDQ definitions.
+        ///
+        /// \param[in] report_step Current report step.
+        ///
+        /// \param[in] definitions Run's UDQ definitions, keyed by UDQ name.
+        /// Must hold the definitions passed to the constructor.
+        ///
+        /// \param[in] udq_state Dynamic UDQ values.  Decides which
+        /// definitions are applicable.
+        ///
+        /// \param[in,out] context Pattern matchers and state objects.
+        /// Values of evaluated UDQs will be updated.
+        void eval(std::size_t                                       report_step,
+                  const std::unordered_map<std::string, UDQDefine>& definitions,
+                  const UDQState&                                   udq_state,
+                  UDQContext&                                       context);
+
+        /// Number of definitions with a compiled form.
+        std::size_t num_compiled() const;
+
+        /// Number of waves of independent definitions.
+        std::size_t num_waves() const { return this->waves_.size(); }
+
+        /// Evaluation statistics of all definitions, in order of
+        /// appearance.
+        std::vector<UDQDefineStatistics> statistics() const;
+
+    private:
+        struct Step
+        {
+            std::string keyword{};
+            std::optional<UDQCompiledDefine> compiled{};
+            std::optional<UDQSet> result{};
+
+            /// Summary vectors and UDQs read by the defining expression,
+            /// and the UDQ itself, whose value might have been assigned
+            /// elsewhere.
+            std::vector<std::string> inputs{};
+
+            /// Whether to evaluate the definition regardless of its
+            /// inputs, e.g., because it uses random numbers.
+            bool always{false};
+
+            /// Revision number at which the value was last stored.
+            std::size_t revision{0};
+
+            UDQDefineStatistics statistics{};
+        };
+
+        /// All definitions in order of appearance.
+        std::vector<Step> steps_{};
+
+        /// Indices into steps_ of each wave, in order of appearance.
+        std::vector<std::vector<std::size_t>> waves_{};
+
+        /// Applicable definitions of the current wave whose inputs have
+        /// changed.
+        std::vector<std::size_t> active_{};
+
+        /// Report step, state objects, and wells of the previous
+        /// evaluation.
+        std::optional<std::size_t> report_step_{};
+        std::pair<std::size_t, std::size_t> state_revision_{};
+        std::vector<std::string> wells_{};
+
+        static bool inputs_changed(const Step& step, const UDQContext& context);
+    };
+
+} // namespace Opm
+
+#endif // UDQ_EVAL_PLAN_HPP
@@ -19,18 +19,22 @@
 
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 
+#include <opm/common/utility/Revision.hpp>
+
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 
 #include <opm/output/eclipse/WindowedArray.hpp>
 
 #include <opm/io/eclipse/rst/state.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -66,72 +70,87 @@ bool has_var(const S2Map<double>& values,
         && (res_iter->second.count(wgname) > 0);
 }
 
-void undefine_results(const Opm::UDQScalar& result,
+// Functions which add or remove results return whether or not the stored
+// values changed.
+
+bool undefine_results(const Opm::UDQScalar& result,
                       SMap<double>&         values)
 {
-    values.erase(result.wgname());
+    return values.erase(result.wgname()) > 0;
 }
 
-void undefine_results(const Opm::UDQScalar&       result,
+bool undefine_results(const Opm::UDQScalar&       result,
                       SKMap<std::size_t, double>& values)
 {
     auto wellPos = values.find(result.wgname());
     if (wellPos == values.end()) {
         // No results for this well.  Nothing to do.
-        return;
+        return false;
+    }
+
+    return wellPos->second.erase(result.number()) > 0;
+}
+
+bool assign_value(const double value, double& stored, const bool inserted)
+{
+    if (!inserted && (stored == value)) {
+        return false;
     }
 
-    wellPos->second.erase(result.number());
+    stored = value;
+    return true;
 }
 
-void add_defined_results(const Opm::UDQScalar& result,
+bool add_defined_results(const Opm::UDQScalar& result,
                          SMap<double>&         values)
 {
-    values.insert_or_assign(result.wgname(), result.get());
+    auto [pos, inserted] = values.try_emplace(result.wgname());
+    return assign_value(result.get(), pos->second, inserted);
 }
 
-void add_defined_results(const Opm::UDQScalar&       result,
+bool add_defined_results(const Opm::UDQScalar&       result,
                          SKMap<std::size_t, double>& values)
 {
-    auto wellPos = values.find(result.wgname());
-    if (wellPos == values.end()) {
-        values.insert_or_assign(result.wgname(), std::unordered_map<std::size_t, double>
-                                {{ result.number(), result.get() }});
-
-        return;
-    }
-
-    wellPos->second.insert_or_assign(result.number(), result.get());
+    auto [pos, inserted] = values[result.wgname()].try_emplace(result.number());
+    return assign_value(result.get(), pos->second, inserted);
 }
 
-void add_results(const std::string& udq_key,
+bool add_results(const std::string& udq_key,
                  const Opm::UDQSet& result,
                  S2Map<double>&     values)
 {
+    auto changed = false;
+
     auto& udq_values = values[udq_key];
     for (const auto& res1 : result) {
         if (! res1.defined()) {
-            undefine_results(res1, udq_values);
+            changed = undefine_results(res1, udq_values) || changed;
         }
         else {
-            add_defined_results(res1, udq_values);
+            changed = add_defined_results(res1, udq_values) || changed;
         }
     }
+
+    return changed;
 }
 
-void add_results(const std::string&           udq_key,
+bool add_results(const std::string&           udq_key,
                  const Opm::UDQSet&           result,
                  S2KMap<std::size_t, double>& values)
 {
+    auto changed = false;
+
     auto& udq_values = values[udq_key];
     for (const auto& res1 : result) {
         if (! res1.defined()) {
-            undefine_results(res1, udq_values);
+            changed = undefine_results(res1, udq_values) || changed;
         }
         else {
-            add_defined_results(res1, udq_values);
+            changed = add_defined_results(res1, udq_values) || changed;
         }
     }
+
+    return changed;
 }
 
 // Load restart values for UDQs defined at the group or well levels.
@@ -234,6 +253,8 @@ void UDQState::load_rst(const RestartIO::RstState& rst_state)
             break;
         }
     }
+
+    this->revision_.bump();
 }
 
 double UDQState::undefined_value() const
@@ -285,29 +306,44 @@ void UDQState::add(const std::string& udq_key, const UDQSet& result)
         };
     }
 
+    auto changed = false;
+
     switch (result.var_type()) {
     case UDQVarType::WELL_VAR:
-        add_results(udq_key, result, this->well_values);
+        changed = add_results(udq_key, result, this->well_values);
         break;
 
     case UDQVarType::GROUP_VAR:
-        add_results(udq_key, result, this->group_values);
+        changed = add_results(udq_key, result, this->group_values);
         break;
 
     case UDQVarType::SEGMENT_VAR:
-        add_results(udq_key, result, this->segment_values);
+        changed = add_results(udq_key, result, this->segment_values);
         break;
 
     default:
         // Scalar
         if (const auto& scalar = result[0]; scalar.defined()) {
-            this->scalar_values.insert_or_assign(udq_key, scalar.get());
+            auto [pos, inserted] = this->scalar_values.try_emplace(udq_key);
+            changed = assign_value(scalar.get(), pos->second, inserted);
         }
         else {
-            this->scalar_values.erase(udq_key);
+            changed = this->scalar_values.erase(udq_key) > 0;
         }
         break;
     }
+
+    if (changed) {
+        this->var_revision_.insert_or_assign(udq_key, Revision::next());
+    }
+}
+
+std::size_t UDQState::revision(const std::string& key) const
+{
+    auto pos = this->var_revision_.find(key);
+    return (pos == this->var_revision_.end())
+        ? this->revision_.value()
+        : std::max(pos->second, this->revision_.value());
 }
 
 void UDQState::add_define(std::size_t report_step, const std::string& udq_key, const UDQSet& result)
@@ -344,6 +380,29 @@ double UDQState::get_well_var(const std::string& well, const std::string& key) c
     return get_wg(this->well_values, well, key, this->undef_value);
 }
 
+void UDQState::get_well_vars(const std::string&              var,
+                             const std::vector<std::string>& wells,
+                             std::vector<double>&            var_values,
+                             std::vector<unsigned char>&     defined) const
+{
+    var_values.assign(wells.size(), this->undef_value);
+    defined.assign(wells.size(), 0);
+
+    auto varPos = this->well_values.find(var);
+    if (varPos == this->well_values.end()) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < wells.size(); ++i) {
+        if (auto wellPos = varPos->second.find(wells[i]);
+            wellPos != varPos->second.end())
+        {
+            var_values[i] = wellPos->second;
+            defined[i] = 1;
+        }
+    }
+}
+
 double UDQState::get_segment_var(const std::string& well,
                                  const std::string& var,
                                  const std::size_t  segment) const
@@ -22,12 +22,15 @@
 
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 
+#include <opm/common/utility/Revision.hpp>
+
 #include <opm/output/eclipse/WindowedArray.hpp>
 
 #include <cstddef>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace Opm::RestartIO {
     struct RstState;
@@ -56,6 +59,13 @@ public:
     double get_well_var(const std::string& well, const std::string& var) const;
     double get_segment_var(const std::string& well, const std::string& var, const std::size_t segment) const;
 
+    // Values of well level UDQ 'var' for all wells in 'wells', in the same
+    // order.  Wells without a value are flagged as undefined.
+    void get_well_vars(const std::string& var,
+                       const std::vector<std::string>& wells,
+                       std::vector<double>& var_values,
+                       std::vector<unsigned char>& defined) const;
+
     void exportSegmentUDQ(const std::string& var,
                           const std::string& well,
                           ExportRange&       output) const;
@@ -63,6 +73,16 @@ public:
     void add_define(std::size_t report_step, const std::string& udq_key, const UDQSet& result);
     void add_assign(const std::string& udq_key, const UDQSet& result);
     bool define(const std::pair<UDQUpdate, std::size_t>& update_status) const;
+
+    // Revision number (see Opm::Revision) of the last change to any value
+    // of UDQ 'key'.
+    std::size_t revision(const std::string& key) const;
+
+    // Revision number of the last change to the object as a whole, e.g.,
+    // through assignment or restart loading.  Distinct objects have
+    // distinct revisions.
+    std::size_t revision() const { return this->revision_.value(); }
+
     double undefined_value() const;
 
     bool operator==(const UDQState& other) const;
@@ -78,6 +98,10 @@ public:
         serializer(this->group_values);
         serializer(this->segment_values);
         serializer(this->defines);
+
+        if (!serializer.isSerializing()) {
+            this->revision_.bump();
+        }
     }
 
 private:
@@ -95,6 +119,11 @@ private:
 
     std::unordered_map<std::string, std::size_t> defines{};
 
+    // Revision of the last change to each UDQ, and of the last change to
+    // the object as a whole.
+    std::unordered_map<std::string, std::size_t> var_revision_{};
+    Revision revision_{};
+
     void add(const std::string& udq_key, const UDQSet& result);
     double get_wg_var(const std::string& well, const std::string& key, UDQVarType var_type) const;
 };
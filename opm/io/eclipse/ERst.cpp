@@ -92,6 +92,21 @@ void ERst::loadReportStepNumber(int number)
 }
 
 
+void ERst::unloadReportStepNumber(int number)
+{
+    if (!hasReportStepNumber(number)) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Trying to unload non existing report step number {}", number));
+    }
+
+    for (int i = arrIndexRange.at(number).first; i < arrIndexRange.at(number).second; i++) {
+        clearData(i);
+    }
+
+    reportLoaded[number] = false;
+}
+
+
 std::vector<EclFile::EclEntry> ERst::listOfRstArrays(int reportStepNumber)
 {
     return this->listOfRstArrays(reportStepNumber, "global");
@@ -48,6 +48,10 @@ public:
 
     void loadReportStepNumber(int number);
 
+    // Release data of all arrays in report step.  Invalidates references
+    // to those arrays.
+    void unloadReportStepNumber(int number);
+
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber)
     {
@@ -492,11 +492,9 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
     int step = 0;
     specInd = nSpecFiles - 1;
 
-    int index = 0;
     for (const auto& keyw : keywList) {
         if (!keyw.empty()) {
             keyword.push_back(keyw);
-            keyword_index[keyw] = index++;
         }
     }
 
@@ -729,14 +727,13 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
     std::vector<int> keywIndVect;
     keywIndVect.reserve(nvect);
 
-    for (auto key : vectList) {
-        if (!hasKey(key))
+    for (const auto& key : vectList) {
+        const auto ind = keywordIndex(key);
+        if (!ind.has_value())
             OPM_THROW(std::invalid_argument, "error loading key " + key );
 
-        auto it = keyword_index.find(key);
-
-        if (!vectorLoaded[it->second])
-            keywIndVect.push_back(it->second);
+        if (!vectorLoaded[*ind])
+            keywIndVect.push_back(*ind);
     }
 
     for (auto ind : keywIndVect)
@@ -837,12 +834,12 @@ std::vector<int> ESmry::makeKeywPosVector(int specInd) const
 
     const auto& kwList = keywordListSpecFile[specInd];
     for (int n = 0; n < nParamsSpecFile[specInd]; ++n) {
-        auto it = keyword_index.find(kwList[n]);
-        if ((it == keyword_index.end()) || has_index(it->second)) {
+        const auto ind = keywordIndex(kwList[n]);
+        if (!ind.has_value() || has_index(*ind)) {
             continue;
         }
 
-        keywpos[n] = it->second;
+        keywpos[n] = *ind;
     }
 
     return keywpos;
@@ -1206,7 +1203,17 @@ void ESmry::updatePathAndRootName(std::filesystem::path& dir, std::filesystem::p
 
 bool ESmry::hasKey(const std::string &key) const
 {
-    return std::ranges::find(keyword, key) != keyword.end();
+    return std::ranges::binary_search(keyword, key);
+}
+
+std::optional<std::size_t> ESmry::keywordIndex(const std::string& key) const
+{
+    const auto it = std::ranges::lower_bound(keyword, key);
+    if ((it == keyword.end()) || (*it != key)) {
+        return std::nullopt;
+    }
+
+    return std::distance(keyword.begin(), it);
 }
 
 
@@ -1379,26 +1386,44 @@ const std::string& ESmry::get_unit(const SummaryNode& node) const {
 
 const std::vector<float>& ESmry::get(const std::string& name) const
 {
-    const auto it = std::ranges::find(keyword, name);
-    if (it == keyword.end()) {
-        OPM_THROW(std::invalid_argument, "keyword " + name + " not found ");
-    }
+    return get(handle(name));
+}
 
-    int ind = std::distance(keyword.begin(), it);
+const std::vector<float>& ESmry::get(const VectorHandle handle) const
+{
+    const auto ind = handle.index;
+    if (ind >= nVect) {
+        OPM_THROW(std::invalid_argument, "invalid summary vector handle " + std::to_string(ind));
+    }
 
     if (!vectorLoaded[ind]){
-        loadData({name});
+        loadData({keyword[ind]});
         vectorLoaded[ind]=true;
     }
 
     return vectorData[ind];
 }
 
+ESmry::VectorHandle ESmry::handle(const std::string& key) const
+{
+    const auto ind = keywordIndex(key);
+    if (!ind.has_value()) {
+        OPM_THROW(std::invalid_argument, "keyword " + key + " not found ");
+    }
+
+    return { *ind };
+}
+
 std::vector<float> ESmry::get_at_rstep(const std::string& name) const
 {
     return this->rstep_vector( this->get(name) );
 }
 
+std::vector<float> ESmry::get_at_rstep(const VectorHandle handle) const
+{
+    return this->rstep_vector( this->get(handle) );
+}
+
 
 int ESmry::timestepIdxAtReportstepStart(const int reportStep) const
 {
@@ -1427,8 +1452,16 @@ std::vector<std::string> ESmry::keywordList(const std::string& pattern) const
 {
     std::vector<std::string> list;
 
-    std::ranges::copy_if(keyword, std::back_inserter(list),
-                         [&pattern](const auto& key) { return shmatch(pattern, key); });
+    // Keys are sorted, hence grouped by keyword and then by entity.  Only
+    // keys starting with the literal prefix of the pattern can match.
+    const auto prefix = pattern.substr(0, pattern.find_first_of("*?[\\"));
+
+    const auto first = std::ranges::lower_bound(keyword, prefix);
+    const auto last = std::find_if_not(first, keyword.end(),
+                                       [&prefix](const auto& key) { return key.starts_with(prefix); });
+
+    std::copy_if(first, last, std::back_inserter(list),
+                 [&pattern](const auto& key) { return shmatch(pattern, key); });
     return list;
 }
 
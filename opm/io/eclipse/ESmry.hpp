@@ -29,6 +29,7 @@
 #include <filesystem>
 #include <iosfwd>
 #include <map>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -46,16 +47,27 @@ public:
     // input is smspec (or fsmspec file)
     explicit ESmry(const std::string& filename, bool loadBaseRunData=false);
 
+    // Handle to a summary vector, for repeated access without key lookup.
+    // Valid for the lifetime of the ESmry object.
+    struct VectorHandle
+    {
+        std::size_t index;
+    };
+
     int numberOfVectors() const { return nVect; }
 
     bool hasKey(const std::string& key) const;
 
     const std::vector<float>& get(const std::string& name) const;
     const std::vector<float>& get(const SummaryNode& node) const;
+    const std::vector<float>& get(VectorHandle handle) const;
     std::vector<time_point> dates() const;
 
     std::vector<float> get_at_rstep(const std::string& name) const;
     std::vector<float> get_at_rstep(const SummaryNode& node) const;
+    std::vector<float> get_at_rstep(VectorHandle handle) const;
+
+    VectorHandle handle(const std::string& key) const;
     std::vector<time_point> dates_at_rstep() const;
 
     void loadData(const std::vector<std::string>& vectList) const;
@@ -99,8 +111,7 @@ private:
     std::vector<TimeStepEntry> timeStepList;
     std::vector<TimeStepEntry> miniStepList;
     std::vector<std::map<int, int>> arrayPos;
-    std::vector<std::string> keyword;
-    std::map<std::string, int> keyword_index;
+    std::vector<std::string> keyword;  // sorted, unique
     std::vector<int> nParamsSpecFile;
 
     std::vector<std::vector<std::string>> keywordListSpecFile;
@@ -132,6 +143,8 @@ private:
     std::string makeKeyString(const std::string& keyword, const std::string& wgname, int num,
                               const std::optional<Opm::EclIO::lgr_info> lgr_info) const;
 
+    std::optional<std::size_t> keywordIndex(const std::string& key) const;
+
     std::string unpackNumber(const SummaryNode&) const;
     std::string lookupKey(const SummaryNode&) const;
 
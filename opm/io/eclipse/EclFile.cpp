@@ -202,7 +202,9 @@ void EclFile::loadData()
         }
 
         for (std::size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
+            if (!arrayLoaded[i]) {
+                loadBinaryArray(fileH, i);
+            }
         }
 
         fileH.close();
@@ -219,7 +221,7 @@ void EclFile::loadData(const std::string& name)
 
         for (unsigned int arrIndex = 0; arrIndex < array_name.size(); arrIndex++) {
 
-            if (array_name[arrIndex] == name) {
+            if ((array_name[arrIndex] == name) && !arrayLoaded[arrIndex]) {
 
                 inFile.seekg(ifStreamPos[arrIndex]);
 
@@ -245,7 +247,7 @@ void EclFile::loadData(const std::string& name)
         }
 
         for (std::size_t i = 0; i < array_name.size(); i++) {
-            if (array_name[i] == name) {
+            if ((array_name[i] == name) && !arrayLoaded[i]) {
                 loadBinaryArray(fileH, i);
             }
         }
@@ -263,6 +265,9 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
         std::ifstream inFile(inputFilename);
 
         for (int ind : arrIndex) {
+            if (arrayLoaded[ind]) {
+                continue;
+            }
 
             inFile.seekg(ifStreamPos[ind]);
 
@@ -286,7 +291,9 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
         }
 
         for (int ind : arrIndex) {
-            loadBinaryArray(fileH, ind);
+            if (!arrayLoaded[ind]) {
+                loadBinaryArray(fileH, ind);
+            }
         }
 
         fileH.close();
@@ -296,6 +303,10 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
 
 void EclFile::loadData(int arrIndex)
 {
+    if (arrayLoaded[arrIndex]) {
+        return;
+    }
+
     if (formatted) {
 
         std::ifstream inFile(inputFilename);
@@ -633,6 +644,18 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
 }
 
 
+void EclFile::clearData(const int arrIndex)
+{
+    inte_array.erase(arrIndex);
+    real_array.erase(arrIndex);
+    doub_array.erase(arrIndex);
+    logi_array.erase(arrIndex);
+    char_array.erase(arrIndex);
+
+    arrayLoaded[arrIndex] = false;
+}
+
+
 std::size_t EclFile::size() const {
     return this->array_name.size();
 }
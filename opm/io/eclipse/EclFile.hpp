@@ -42,6 +42,8 @@ public:
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
     bool formattedInput() const { return formatted; }
 
+    // Arrays which are already loaded are not read again, so references to
+    // their data remain valid until the arrays are cleared.
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
@@ -58,6 +60,8 @@ public:
       std::fill(arrayLoaded.begin(), arrayLoaded.end(), false);
     }
 
+    void clearData(int arrIndex);               // release data of array with index arrIndex
+
     using EclEntry = std::tuple<std::string, eclArrType, std::int64_t>;
     std::vector<EclEntry> getList() const;
 
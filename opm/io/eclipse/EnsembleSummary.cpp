@@ -0,0 +1,270 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/EnsembleSummary.hpp>
+
+#include <opm/io/eclipse/ESmry.hpp>
+#include <opm/io/eclipse/ExtESmry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+// Summary data of one case, from either an SMSPEC or an ESMRY file.
+struct EnsembleSummary::Case
+{
+    std::unique_ptr<ESmry> smry;
+    std::unique_ptr<ExtESmry> ext_smry;
+
+    Case(const std::string& filename, bool loadBaseRunData)
+    {
+        if (std::filesystem::path(filename).extension() == ".ESMRY")
+            ext_smry = std::make_unique<ExtESmry>(filename, loadBaseRunData);
+        else
+            smry = std::make_unique<ESmry>(filename, loadBaseRunData);
+    }
+
+    bool hasKey(const std::string& key) const
+    {
+        return (smry != nullptr) ? smry->hasKey(key) : ext_smry->hasKey(key);
+    }
+
+    std::size_t numberOfTimeSteps() const
+    {
+        return (smry != nullptr) ? smry->numberOfTimeSteps() : ext_smry->numberOfTimeSteps();
+    }
+
+    time_point startdate() const
+    {
+        return (smry != nullptr) ? smry->startdate() : ext_smry->startdate();
+    }
+
+    std::vector<time_point> dates()
+    {
+        return (smry != nullptr) ? smry->dates() : ext_smry->dates();
+    }
+
+    const std::vector<float>& get(const std::string& key)
+    {
+        return (smry != nullptr) ? smry->get(key) : ext_smry->get(key);
+    }
+
+    // Load all vectors of keys, which the case has, in one pass over the
+    // summary files.  Returns for each key whether the case has it.
+    std::vector<bool> load(const std::vector<std::string>& keys)
+    {
+        std::vector<bool> found;
+        std::vector<std::string> present;
+
+        found.reserve(keys.size());
+
+        for (const auto& key : keys) {
+            found.push_back(hasKey(key));
+
+            if (found.back() && (std::ranges::find(present, key) == present.end()))
+                present.push_back(key);
+        }
+
+        if (!present.empty()) {
+            if (smry != nullptr)
+                smry->loadData(present);
+            else
+                ext_smry->loadData(present);
+        }
+
+        return found;
+    }
+};
+
+
+// Calls function(caseIdx) for each case, from a pool of threads.  Each
+// case is processed by exactly one thread.  The first exception thrown,
+// if any, is rethrown once all threads have finished.
+template <typename Function>
+void EnsembleSummary::forEachCase(Function&& function) const
+{
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [&]()
+    {
+        for (auto caseIdx = next++; caseIdx < m_cases.size(); caseIdx = next++) {
+            try {
+                function(caseIdx);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock { errorMutex };
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+    };
+
+    const auto numThreads = std::min(m_numThreads, m_cases.size());
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads > 0 ? numThreads - 1 : 0);
+
+    for (std::size_t i = 1; i < numThreads; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (auto& thread : threads)
+        thread.join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+EnsembleSummary::EnsembleSummary(const std::vector<std::string>& filenames,
+                                 const std::size_t numThreads,
+                                 const bool loadBaseRunData)
+    : m_filenames(filenames)
+    , m_numThreads(numThreads)
+    , m_cases(filenames.size())
+{
+    if (m_numThreads == 0)
+        m_numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    forEachCase([this, loadBaseRunData](const std::size_t caseIdx)
+    {
+        m_cases[caseIdx] = std::make_unique<Case>(m_filenames[caseIdx], loadBaseRunData);
+    });
+}
+
+EnsembleSummary::~EnsembleSummary() = default;
+
+EnsembleSummary::EnsembleSummary(EnsembleSummary&&) noexcept = default;
+EnsembleSummary& EnsembleSummary::operator=(EnsembleSummary&&) noexcept = default;
+
+std::size_t EnsembleSummary::numberOfTimeSteps(const std::size_t caseIdx) const
+{
+    return m_cases.at(caseIdx)->numberOfTimeSteps();
+}
+
+std::vector<time_point> EnsembleSummary::dates(const std::size_t caseIdx) const
+{
+    return m_cases.at(caseIdx)->dates();
+}
+
+bool EnsembleSummary::hasKey(const std::size_t caseIdx, const std::string& key) const
+{
+    return m_cases.at(caseIdx)->hasKey(key);
+}
+
+EnsembleSummary::Data EnsembleSummary::get(const std::vector<std::string>& keys) const
+{
+    Data data;
+
+    data.numCases = m_cases.size();
+    data.numVectors = keys.size();
+
+    for (const auto& smryCase : m_cases)
+        data.numTimes = std::max(data.numTimes, smryCase->numberOfTimeSteps());
+
+    data.values.assign(data.numCases * data.numTimes * data.numVectors,
+                       std::numeric_limits<float>::quiet_NaN());
+
+    forEachCase([this, &keys, &data](const std::size_t caseIdx)
+    {
+        auto& smryCase = *m_cases[caseIdx];
+        const auto found = smryCase.load(keys);
+
+        for (std::size_t v = 0; v < keys.size(); v++) {
+            if (!found[v])
+                continue;
+
+            const auto& vect = smryCase.get(keys[v]);
+
+            for (std::size_t t = 0; t < vect.size(); t++)
+                data.values[(caseIdx * data.numTimes + t) * data.numVectors + v] = vect[t];
+        }
+    });
+
+    return data;
+}
+
+EnsembleSummary::Data EnsembleSummary::get(const std::vector<std::string>& keys,
+                                           const std::vector<time_point>& dates) const
+{
+    Data data;
+
+    data.numCases = m_cases.size();
+    data.numTimes = dates.size();
+    data.numVectors = keys.size();
+
+    data.values.assign(data.numCases * data.numTimes * data.numVectors,
+                       std::numeric_limits<float>::quiet_NaN());
+
+    forEachCase([this, &keys, &dates, &data](const std::size_t caseIdx)
+    {
+        auto& smryCase = *m_cases[caseIdx];
+
+        auto caseKeys = keys;
+        caseKeys.push_back("TIME");
+
+        const auto found = smryCase.load(caseKeys);
+        if (!found.back())
+            return;
+
+        // Search the case's own dates, rather than its TIME vector, so that
+        // every date returned by dates(caseIdx) is matched exactly.
+        const auto caseDates = smryCase.dates();
+
+        for (std::size_t t = 0; t < dates.size(); t++) {
+            const auto upper = std::ranges::lower_bound(caseDates, dates[t]);
+            if ((upper == caseDates.end()) || ((upper == caseDates.begin()) && (*upper != dates[t])))
+                continue;
+
+            const auto i1 = static_cast<std::size_t>(std::distance(caseDates.begin(), upper));
+            const auto i0 = (*upper == dates[t]) ? i1 : i1 - 1;
+            const double w = (i0 == i1)
+                ? 0.0
+                : std::chrono::duration<double>(dates[t] - caseDates[i0]).count() /
+                  std::chrono::duration<double>(caseDates[i1] - caseDates[i0]).count();
+
+            for (std::size_t v = 0; v < keys.size(); v++) {
+                if (!found[v])
+                    continue;
+
+                const auto& vect = smryCase.get(keys[v]);
+
+                data.values[(caseIdx * data.numTimes + t) * data.numVectors + v] =
+                    static_cast<float>((1.0 - w) * vect[i0] + w * vect[i1]);
+            }
+        }
+    });
+
+    return data;
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,97 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ENSEMBLE_SUMMARY_HPP
+#define OPM_IO_ENSEMBLE_SUMMARY_HPP
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+class ESmry;
+class ExtESmry;
+
+// Summary data of many cases, e.g., the members of an ensemble.  Cases
+// are opened, and their summary vectors loaded, concurrently.  Each case
+// may be given by its SMSPEC (or FSMSPEC) file or by its ESMRY file.
+class EnsembleSummary
+{
+public:
+
+    // Summary vectors of all cases, as one dense array.
+    struct Data
+    {
+        std::size_t numCases{0};
+        std::size_t numTimes{0};
+        std::size_t numVectors{0};
+
+        // Values ordered by case, then time, then vector.  Vectors a case
+        // does not have, and time steps beyond the end of a case, are NaN.
+        std::vector<float> values{};
+
+        float operator()(std::size_t caseIdx, std::size_t timeIdx, std::size_t vectorIdx) const
+        {
+            return values[(caseIdx * numTimes + timeIdx) * numVectors + vectorIdx];
+        }
+    };
+
+    // numThreads = 0 uses one thread per hardware thread.
+    explicit EnsembleSummary(const std::vector<std::string>& filenames,
+                             std::size_t numThreads = 0,
+                             bool loadBaseRunData = false);
+
+    ~EnsembleSummary();
+
+    EnsembleSummary(EnsembleSummary&&) noexcept;
+    EnsembleSummary& operator=(EnsembleSummary&&) noexcept;
+
+    std::size_t numberOfCases() const { return m_filenames.size(); }
+    const std::vector<std::string>& caseFiles() const { return m_filenames; }
+
+    std::size_t numberOfTimeSteps(std::size_t caseIdx) const;
+    std::vector<time_point> dates(std::size_t caseIdx) const;
+
+    bool hasKey(std::size_t caseIdx, const std::string& key) const;
+
+    // Vectors at the time steps of each case.  numTimes is the number of
+    // time steps of the longest case.
+    Data get(const std::vector<std::string>& keys) const;
+
+    // Vectors linearly interpolated in time to common dates.  Dates
+    // outside the time span of a case are NaN for that case.
+    Data get(const std::vector<std::string>& keys, const std::vector<time_point>& dates) const;
+
+private:
+    struct Case;
+
+    std::vector<std::string> m_filenames;
+    std::size_t m_numThreads;
+    std::vector<std::unique_ptr<Case>> m_cases;
+
+    template <typename Function>
+    void forEachCase(Function&& function) const;
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ENSEMBLE_SUMMARY_HPP
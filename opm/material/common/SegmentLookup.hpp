@@ -0,0 +1,169 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::SegmentLookup
+ */
+#ifndef OPM_SEGMENT_LOOKUP_HPP
+#define OPM_SEGMENT_LOOKUP_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Constant time search for the segment of a sorted sequence of sampling
+ *        points which contains a given position.
+ *
+ * The interior range [x_1, x_{n-2}] of the sampling points is divided into
+ * bins of equal width, and each bin stores the highest sampling point which
+ * is known to lie strictly to the left of every position falling into that
+ * bin.  A lookup therefore consists of computing the bin index and, if a bin
+ * contains further sampling points, stepping past those.  The sampling
+ * points themselves are not modified, so interpolation remains exact, and
+ * the result is identical to that of a bisection search for the largest
+ * index l in [1, n-3] with x_l <= x.
+ *
+ * The object only stores the bins.  The sampling points are passed to each
+ * call through an accessor, which allows using the same class for plain
+ * arrays and for the columns of two-dimensional tables.
+ */
+template <class Scalar>
+class SegmentLookup
+{
+public:
+    /*!
+     * \brief Create the bins for a given set of sampling points.
+     *
+     * \param numSamples Number of sampling points.  Tables of fewer than four
+     *        sampling points do not need an interior search and leave the
+     *        object empty.
+     *
+     * \param xAt Accessor returning the position of a sampling point,
+     *        invoked as xAt(i).  Positions must be sorted in ascending order.
+     *
+     * \param numBins Number of bins.  Zero selects four bins per segment.
+     */
+    template <class XAt>
+    void build(const std::size_t numSamples, XAt&& xAt, std::size_t numBins = 0)
+    {
+        this->clear();
+
+        if (numSamples < 4) {
+            return;
+        }
+
+        if (numBins == 0) {
+            numBins = 4*(numSamples - 1);
+        }
+
+        const Scalar lo = xAt(1);
+        const Scalar hi = xAt(numSamples - 2);
+        if (! (lo < hi)) {
+            return;
+        }
+
+        lo_ = lo;
+        binsPerUnit_ = static_cast<Scalar>(numBins) / (hi - lo);
+        lastInterior_ = numSamples - 3;
+
+        // Only compare bin indices, rather than positions, so that a lookup
+        // uses the same rounding as the construction.
+        start_.resize(numBins);
+        std::size_t l = 1;
+        for (std::size_t bin = 0; bin < numBins; ++bin) {
+            while ((l < lastInterior_) && (binIndex_(xAt(l + 1)) < bin)) {
+                ++l;
+            }
+
+            start_[bin] = static_cast<unsigned>(l);
+        }
+    }
+
+    /*!
+     * \brief Remove all bins.
+     *
+     * Must be called whenever the sampling points change.
+     */
+    void clear()
+    {
+        start_.clear();
+    }
+
+    /*!
+     * \brief Whether or not build() has created any bins.
+     */
+    bool empty() const
+    { return start_.empty(); }
+
+    /*!
+     * \brief Return the segment index of a position in the interior range.
+     *
+     * \param x Position.  Must satisfy x_1 < x < x_{n-2}.  May be of a
+     *        different floating point type than the sampling points.
+     *
+     * \param xAt Accessor to the sampling points passed to build().
+     */
+    template <class Value, class XAt>
+    std::size_t interiorSegment(const Value x, XAt&& xAt) const
+    {
+        std::size_t segIdx = start_[binIndex_(static_cast<Scalar>(x))];
+
+        // Only needed if x is of a different precision than the sampling
+        // points and rounding moved it into the next bin.
+        while ((segIdx > 1) && (x < xAt(segIdx))) {
+            --segIdx;
+        }
+
+        while ((segIdx < lastInterior_) && !(x < xAt(segIdx + 1))) {
+            ++segIdx;
+        }
+
+        return segIdx;
+    }
+
+private:
+    std::size_t binIndex_(const Scalar x) const
+    {
+        const Scalar t = (x - lo_)*binsPerUnit_;
+        const auto numBins = start_.size();
+
+        if (! (t > 0)) {
+            return 0;
+        }
+
+        return (t < static_cast<Scalar>(numBins))
+            ? static_cast<std::size_t>(t)
+            : numBins - 1;
+    }
+
+    std::vector<unsigned> start_{};
+    Scalar lo_{};
+    Scalar binsPerUnit_{};
+    std::size_t lastInterior_{};
+};
+
+} // namespace Opm
+
+#endif
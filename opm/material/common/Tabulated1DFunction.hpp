@@ -28,6 +28,7 @@
 #define OPM_TABULATED_1D_FUNCTION_HPP
 
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/material/common/SegmentLookup.hpp>
 #include <opm/material/densead/Math.hpp>
 
 #include <algorithm>
@@ -435,6 +436,31 @@ public:
                yValues_ == data.yValues_;
     }
 
+    /*!
+     * \brief Replace the bisection in findSegmentIndex() by a constant time
+     *        lookup on an auxiliary uniform grid.
+     *
+     * This is opt-in since it needs some additional memory per table.  The
+     * sampling points are unchanged and findSegmentIndex() returns exactly
+     * the same segments as without the lookup.  Must be called again after
+     * the sampling points have been changed.
+     *
+     * \param numBins Number of cells of the auxiliary grid.  Zero selects a
+     *        default based on the number of sampling points.
+     */
+    void buildSegmentLookup(std::size_t numBins = 0)
+    {
+        segmentLookup_.build(numSamples(),
+                             [this](const std::size_t i) { return xValues_[i]; },
+                             numBins);
+    }
+
+    /*!
+     * \brief Whether or not findSegmentIndex() uses a constant time lookup.
+     */
+    bool hasSegmentLookup() const
+    { return !segmentLookup_.empty(); }
+
     template <class Evaluation>
     SegmentIndex findSegmentIndex(const Evaluation& x, bool extrapolate = false) const
     {
@@ -461,15 +487,22 @@ public:
         else if (x >= xValues_[xValues_.size() - 2])
             return SegmentIndex{xValues_.size() - 2};
         else {
-            // bisection
             std::size_t lowerIdx = 1;
-            std::size_t upperIdx = xValues_.size() - 2;
-            while (lowerIdx + 1 < upperIdx) {
-                std::size_t pivotIdx = (lowerIdx + upperIdx) / 2;
-                if (x < xValues_[pivotIdx])
-                    upperIdx = pivotIdx;
-                else
-                    lowerIdx = pivotIdx;
+            if (!segmentLookup_.empty()) {
+                lowerIdx = segmentLookup_
+                    .interiorSegment(getValue(x),
+                                     [this](const std::size_t i) { return xValues_[i]; });
+            }
+            else {
+                // bisection
+                std::size_t upperIdx = xValues_.size() - 2;
+                while (lowerIdx + 1 < upperIdx) {
+                    std::size_t pivotIdx = (lowerIdx + upperIdx) / 2;
+                    if (x < xValues_[pivotIdx])
+                        upperIdx = pivotIdx;
+                    else
+                        lowerIdx = pivotIdx;
+                }
             }
 
             if (xValues_[lowerIdx] > x || x > xValues_[lowerIdx + 1]) {
@@ -613,10 +646,12 @@ private:
     {
         xValues_.resize(nSamples);
         yValues_.resize(nSamples);
+        segmentLookup_.clear();
     }
 
     std::vector<Scalar> xValues_;
     std::vector<Scalar> yValues_;
+    SegmentLookup<Scalar> segmentLookup_;
 };
 
 } // namespace Opm
@@ -32,6 +32,7 @@
 
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/SegmentLookup.hpp>
 
 #include <cassert>
 #include <cmath>
@@ -201,6 +202,13 @@ public:
         else {
             assert(xPos_.size() >= 3);
 
+            if (!xLookup_.empty()) {
+                return static_cast<unsigned>
+                    (xLookup_.interiorSegment(getValue(x),
+                                              [this](const std::size_t k)
+                                              { return xPos_[k]; }));
+            }
+
             // bisection
             unsigned lowerIdx = 1;
             unsigned upperIdx = xPos_.size() - 2;
@@ -250,6 +258,14 @@ public:
         else {
             assert(colSamplePoints.size() >= 3);
 
+            if (!yLookup_.empty() && !yLookup_[xSampleIdx].empty()) {
+                return static_cast<unsigned>
+                    (yLookup_[xSampleIdx]
+                     .interiorSegment(getValue(y),
+                                      [&colSamplePoints](const std::size_t k)
+                                      { return std::get<1>(colSamplePoints[k]); }));
+            }
+
             // bisection
             unsigned lowerIdx = 1;
             unsigned upperIdx = colSamplePoints.size() - 2;
@@ -417,6 +433,8 @@ public:
      */
     std::size_t appendXPos(Scalar nextX)
     {
+        clearSegmentLookup_();
+
         if (xPos_.empty() || xPos_.back() < nextX) {
             xPos_.push_back(nextX);
             yPos_.push_back(std::numeric_limits<Scalar>::lowest() / 2);
@@ -442,6 +460,7 @@ public:
     std::size_t appendSamplePoint(std::size_t i, Scalar y, Scalar value)
     {
         assert(i < numX());
+        clearSegmentLookup_();
         Scalar x = iToX(i);
         if (samples_[i].empty()) {
             samples_[i].emplace_back(x, y, value);
@@ -483,7 +502,50 @@ public:
                this->interpolationGuide() == data.interpolationGuide();
     }
 
+    /*!
+     * \brief Replace the bisections in xSegmentIndex() and ySegmentIndex() by
+     *        constant time lookups on auxiliary uniform grids.
+     *
+     * This is opt-in since it needs some additional memory per table.  The
+     * sampling points are unchanged and the segment indices are exactly the
+     * same as without the lookup.  Appending sampling points removes the
+     * lookup, so this should be called once the table is complete.
+     */
+    void buildSegmentLookup()
+    {
+        xLookup_.build(xPos_.size(),
+                       [this](const std::size_t k) { return xPos_[k]; });
+
+        yLookup_.resize(samples_.size());
+        bool anyColumnLookup = false;
+        for (std::size_t i = 0; i < samples_.size(); ++i) {
+            const auto& colSamplePoints = samples_[i];
+            yLookup_[i].build(colSamplePoints.size(),
+                              [&colSamplePoints](const std::size_t k)
+                              { return std::get<1>(colSamplePoints[k]); });
+            anyColumnLookup = anyColumnLookup || !yLookup_[i].empty();
+        }
+
+        // columns of fewer than four sampling points need no search
+        if (!anyColumnLookup) {
+            yLookup_.clear();
+        }
+    }
+
+    /*!
+     * \brief Whether or not xSegmentIndex() or ySegmentIndex() use a
+     *        constant time lookup for at least one of the axes or columns.
+     */
+    bool hasSegmentLookup() const
+    { return !xLookup_.empty() || !yLookup_.empty(); }
+
 private:
+    void clearSegmentLookup_()
+    {
+        xLookup_.clear();
+        yLookup_.clear();
+    }
+
     // the vector which contains the values of the sample points
     // f(x_i, y_j). don't use this directly, use getSamplePoint(i,j)
     // instead!
@@ -494,6 +556,10 @@ private:
     // the position on the y-axis of the guide point
     std::vector<Scalar> yPos_;
     InterpolationPolicy interpolationGuide_;
+
+    // optional constant time segment search, see buildSegmentLookup()
+    SegmentLookup<Scalar> xLookup_;
+    std::vector<SegmentLookup<Scalar>> yLookup_;
 };
 } // namespace Opm
 
@@ -29,6 +29,7 @@
 #ifndef OPM_CHI_FLASH_HPP
 #define OPM_CHI_FLASH_HPP
 
+#include <opm/material/constraintsolvers/PTFlashStabilityCache.hpp>
 #include <opm/material/fluidmatrixinteractions/NullMaterial.hpp>
 #include <opm/material/fluidmatrixinteractions/MaterialTraits.hpp>
 #include <opm/material/fluidstates/CompositionalFluidState.hpp>
@@ -48,9 +49,13 @@
 #include <dune/common/fmatrix.hh>
 #include <dune/common/classname.hh>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <exception>
 #include <limits>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include <fmt/format.h>
@@ -78,6 +83,8 @@ class PTFlash
     using EOSType = CompositionalConfig::EOSType;
 
 public:
+    using StabilityCache = PTFlashStabilityCache<Scalar, numComponents>;
+
     /*!
      * \brief Calculates the fluid state from the global mole fractions of the components and the phase pressures
      *
@@ -89,39 +96,25 @@ public:
                       const EOSType& eos_type,
                       int verbosity = 0)
     {
-        using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
-        ScalarFluidState fluid_state_scalar;
-
-        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
-            fluid_state_scalar.setKvalue(compIdx, Opm::getValue(fluid_state.K(compIdx) ) );
-            fluid_state_scalar.setMoleFraction(compIdx, Opm::getValue(fluid_state.moleFraction(compIdx) ) );
-        }
-
-        fluid_state_scalar.setLvalue(Opm::getValue(fluid_state.L()));
-        // other values need to be Scalar, but I guess the fluidstate does not support it yet.
-        fluid_state_scalar.setPressure(FluidSystem::oilPhaseIdx,
-                                       Opm::getValue(fluid_state.pressure(FluidSystem::oilPhaseIdx)));
-        fluid_state_scalar.setPressure(FluidSystem::gasPhaseIdx,
-                                       Opm::getValue(fluid_state.pressure(FluidSystem::gasPhaseIdx)));
-
-        fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
-
-        const auto is_single_phase = flash_solve_scalar_(fluid_state_scalar, twoPhaseMethod, flash_tolerance, eos_type, verbosity);
-
-        // the flash solution process were performed in scalar form, after the flash calculation finishes,
-        // ensure that things in fluid_state_scalar is transformed to fluid_state
-        for (int compIdx=0; compIdx<numComponents; ++compIdx){
-                const auto x_i = fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx);
-                fluid_state.setMoleFraction(oilPhaseIdx, compIdx, x_i);
-                const auto y_i = fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx);
-                fluid_state.setMoleFraction(gasPhaseIdx, compIdx, y_i);
-        }
-
-        // we update the derivatives in fluid_state
-        updateDerivatives_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
+        return solve_(fluid_state, twoPhaseMethod, flash_tolerance, eos_type, nullptr, 0, verbosity);
+    }
 
-        return is_single_phase;
-    } //end solve
+    /*!
+     * \brief Calculates the fluid state like the method above, but skips the
+     *        phase stability test of the cell if the stability cache allows
+     *        it, and updates the cache.
+     */
+    template <class FluidState>
+    static bool solve(FluidState& fluid_state,
+                      const std::string& twoPhaseMethod,
+                      Scalar flash_tolerance,
+                      const EOSType& eos_type,
+                      StabilityCache& stability_cache,
+                      std::size_t cellIdx,
+                      int verbosity = 0)
+    {
+        return solve_(fluid_state, twoPhaseMethod, flash_tolerance, eos_type, &stability_cache, cellIdx, verbosity);
+    }
 
     /*!
      * \brief Calculates the chemical equilibrium from the component
@@ -237,6 +230,19 @@ public:
                                     const Scalar flash_tolerance,
                                     const EOSType& eos_type,
                                     const int verbosity = 0)
+    {
+        return flash_solve_scalar_(fluid_state, twoPhaseMethod, flash_tolerance, eos_type, nullptr, 0, verbosity);
+    }
+
+    // the same as above, but consults and updates the stability cache if one is given
+    template <typename FluidState>
+    static bool flash_solve_scalar_(FluidState& fluid_state,
+                                    const std::string& twoPhaseMethod,
+                                    const Scalar flash_tolerance,
+                                    const EOSType& eos_type,
+                                    StabilityCache* stability_cache,
+                                    const std::size_t cellIdx,
+                                    const int verbosity)
     {
         // Do a stability test to check if cell is is_single_phase-phase (do for all cells the first time).
         bool is_stable = false;
@@ -247,12 +253,43 @@ public:
             K_scalar[compIdx] = fluid_state.K(compIdx);
             z_scalar[compIdx] = fluid_state.moleFraction(compIdx);
         }
+        const Scalar p_scalar = fluid_state.pressure(0);
+        const Scalar T_scalar = fluid_state.temperature(0);
 
         if ( L_scalar <= 0 || L_scalar == 1 ) {
-            if (verbosity >= 1) {
-                OpmLog::debug("Perform stability test (L <= 0 or L == 1)!");
+            using Lookup = typename StabilityCache::Lookup;
+            const auto lookup = stability_cache
+                ? stability_cache->lookup(cellIdx, p_scalar, T_scalar, z_scalar)
+                : Lookup::Miss;
+
+            if (lookup == Lookup::TwoPhase) {
+                if (flash_2ph_from_cache_(z_scalar, twoPhaseMethod, *stability_cache, cellIdx,
+                                          fluid_state, flash_tolerance, eos_type, verbosity)) {
+                    return false;
+                }
+                stability_cache->recordFallback(cellIdx);
+            }
+
+            if (lookup == Lookup::SinglePhase) {
+                if (verbosity >= 1) {
+                    OpmLog::debug("Skip stability test, cell is single-phase according to the stability cache!");
+                }
+                is_stable = true;
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    fluid_state.setMoleFraction(gasPhaseIdx, compIdx, z_scalar[compIdx]);
+                    fluid_state.setMoleFraction(oilPhaseIdx, compIdx, z_scalar[compIdx]);
+                }
+            }
+            else {
+                if (verbosity >= 1) {
+                    OpmLog::debug("Perform stability test (L <= 0 or L == 1)!");
+                }
+                Scalar stability_margin = 0.0;
+                phaseStabilityTest_(is_stable, K_scalar, fluid_state, z_scalar, eos_type, stability_margin, verbosity);
+                if (stability_cache && is_stable) {
+                    stability_cache->storeSinglePhase(cellIdx, p_scalar, T_scalar, z_scalar, stability_margin);
+                }
             }
-            phaseStabilityTest_(is_stable, K_scalar, fluid_state, z_scalar, eos_type, verbosity);
         }
         if (verbosity >= 1) {
             OpmLog::debug(fmt::format("Inputs after stability test are K = [{}], L = [{}], z = [{}], P = {}, and T = {}",
@@ -268,6 +305,9 @@ public:
             // Rachford Rice equation to get initial L for composition solver
             L_scalar = solveRachfordRice_g_(K_scalar, z_scalar, verbosity);
             flash_2ph(z_scalar, twoPhaseMethod, K_scalar, L_scalar, fluid_state, flash_tolerance, eos_type, verbosity);
+            if (stability_cache) {
+                stability_cache->storeTwoPhase(cellIdx, p_scalar, T_scalar, z_scalar, K_scalar);
+            }
         } else {
             // Cell is one-phase. Use Li's phase labeling method to see if it's liquid or vapor
             L_scalar = li_single_phase_label_(fluid_state, z_scalar, verbosity);
@@ -276,6 +316,57 @@ public:
         return is_single_phase;
     }
 
+    // Two-phase flash starting from the K-values of the stability cache instead
+    // of the stability test.  Returns false, leaving the K-values and liquid
+    // fraction of the fluid state untouched, if it does not yield a non-trivial
+    // two-phase solution.
+    template <typename FluidState, class ComponentVector>
+    static bool flash_2ph_from_cache_(const ComponentVector& z_scalar,
+                                      const std::string& twoPhaseMethod,
+                                      StabilityCache& stability_cache,
+                                      const std::size_t cellIdx,
+                                      FluidState& fluid_state,
+                                      const Scalar flash_tolerance,
+                                      const EOSType& eos_type,
+                                      const int verbosity)
+    {
+        if (verbosity >= 1) {
+            OpmLog::debug("Skip stability test, start two-phase flash from the K-values of the stability cache!");
+        }
+
+        const FluidState fluid_state_initial = fluid_state;
+        const auto& K_cached = stability_cache.K(cellIdx);
+        ComponentVector K_scalar;
+        std::copy(K_cached.begin(), K_cached.end(), K_scalar.begin());
+
+        typename FluidState::ValueType L_scalar = 0.0;
+        try {
+            L_scalar = solveRachfordRice_g_(K_scalar, z_scalar, verbosity);
+            flash_2ph(z_scalar, twoPhaseMethod, K_scalar, L_scalar, fluid_state, flash_tolerance, eos_type, verbosity);
+        }
+        catch (const std::exception& e) {
+            if (verbosity >= 1) {
+                OpmLog::debug(fmt::format("Two-phase flash from cached K-values failed: {}", e.what()));
+            }
+            fluid_state = fluid_state_initial;
+            return false;
+        }
+
+        Scalar K_norm = 0.0;
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const Scalar b = std::log(K_scalar[compIdx]);
+            K_norm += b*b;
+        }
+        if (!(L_scalar > 0 && L_scalar < 1) || K_norm < 1e-5) {
+            fluid_state = fluid_state_initial;
+            return false;
+        }
+
+        stability_cache.storeTwoPhase(cellIdx, fluid_state.pressure(0), fluid_state.temperature(0), z_scalar, K_scalar);
+        fluid_state.setLvalue(L_scalar);
+        return true;
+    }
+
     template <class Vector>
     static typename Vector::field_type bisection_g_(const Vector& K, typename Vector::field_type Lmin,
                                                     typename Vector::field_type Lmax, const Vector& z, int verbosity)
@@ -381,6 +472,15 @@ public:
 
     template <class FlashFluidState, class ComponentVector>
     static void phaseStabilityTest_(bool& isStable, ComponentVector& K, FlashFluidState& fluid_state, const ComponentVector& z, const EOSType& eos_type, int verbosity)
+    {
+        Scalar stabilityMargin;
+        phaseStabilityTest_(isStable, K, fluid_state, z, eos_type, stabilityMargin, verbosity);
+    }
+
+    // the same as above, but also estimates the distance of a stable cell to the phase boundary
+    template <class FlashFluidState, class ComponentVector>
+    static void phaseStabilityTest_(bool& isStable, ComponentVector& K, FlashFluidState& fluid_state, const ComponentVector& z,
+                                    const EOSType& eos_type, Scalar& stabilityMargin, int verbosity)
     {
         // Declarations
         bool isTrivialL, isTrivialV;
@@ -405,6 +505,8 @@ public:
 
         // L-stable means success in making liquid, V-unstable means no success in making vapour
         isStable = L_stable && V_unstable;
+        stabilityMargin = std::min(StabilityCache::stabilityMargin(isTrivialV, Opm::getValue(S_v)),
+                                   StabilityCache::stabilityMargin(isTrivialL, Opm::getValue(S_l)));
         if (isStable) {
             // Single phase, i.e. phase composition is equivalent to the global composition
             // Update fluid_state with mole fraction
@@ -423,6 +525,50 @@ public:
 
 protected:
 
+    template <class FluidState>
+    static bool solve_(FluidState& fluid_state,
+                       const std::string& twoPhaseMethod,
+                       Scalar flash_tolerance,
+                       const EOSType& eos_type,
+                       StabilityCache* stability_cache,
+                       std::size_t cellIdx,
+                       int verbosity)
+    {
+        using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
+        ScalarFluidState fluid_state_scalar;
+
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluid_state_scalar.setKvalue(compIdx, Opm::getValue(fluid_state.K(compIdx) ) );
+            fluid_state_scalar.setMoleFraction(compIdx, Opm::getValue(fluid_state.moleFraction(compIdx) ) );
+        }
+
+        fluid_state_scalar.setLvalue(Opm::getValue(fluid_state.L()));
+        // other values need to be Scalar, but I guess the fluidstate does not support it yet.
+        fluid_state_scalar.setPressure(FluidSystem::oilPhaseIdx,
+                                       Opm::getValue(fluid_state.pressure(FluidSystem::oilPhaseIdx)));
+        fluid_state_scalar.setPressure(FluidSystem::gasPhaseIdx,
+                                       Opm::getValue(fluid_state.pressure(FluidSystem::gasPhaseIdx)));
+
+        fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
+
+        const auto is_single_phase = flash_solve_scalar_(fluid_state_scalar, twoPhaseMethod, flash_tolerance,
+                                                         eos_type, stability_cache, cellIdx, verbosity);
+
+        // the flash solution process were performed in scalar form, after the flash calculation finishes,
+        // ensure that things in fluid_state_scalar is transformed to fluid_state
+        for (int compIdx=0; compIdx<numComponents; ++compIdx){
+                const auto x_i = fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx);
+                fluid_state.setMoleFraction(oilPhaseIdx, compIdx, x_i);
+                const auto y_i = fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx);
+                fluid_state.setMoleFraction(gasPhaseIdx, compIdx, y_i);
+        }
+
+        // we update the derivatives in fluid_state
+        updateDerivatives_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
+
+        return is_single_phase;
+    }
+
     template <class FlashFluidState>
     static typename FlashFluidState::ValueType wilsonK_(const FlashFluidState& fluid_state, int compIdx)
     {
@@ -0,0 +1,853 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::PTFlashBatch
+ */
+#ifndef OPM_PTFLASH_BATCH_HPP
+#define OPM_PTFLASH_BATCH_HPP
+
+#include <opm/material/constraintsolvers/PTFlash.hpp>
+#include <opm/material/eos/CubicEOSParams.hpp>
+#include <opm/material/fluidstates/CompositionalFluidState.hpp>
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/Constants.hpp>
+
+#include <opm/input/eclipse/EclipseState/Compositional/CompositionalConfig.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <dune/common/fvector.hh>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace Opm {
+
+/*!
+ * \brief Flash calculation for many cells at once.
+ *
+ * Computes the same phase split as PTFlash::solve() for every fluid state of
+ * a batch, but performs the stability test and the successive substitution
+ * for all cells together: The pure-component EOS parameters are computed once
+ * per cell and flash instead of once per fugacity evaluation, the fugacity
+ * coefficients of the reference phase of the stability test are computed
+ * only once, and the cubic-root solves and fugacity evaluations run in loops
+ * over the cells of the batch, with the cell quantities stored contiguously
+ * per component so that the compiler can vectorize the loops.  All scratch
+ * memory lives in a Workspace which is reused across calls.
+ *
+ * The Workspace also remembers the K-values and the liquid fraction of every
+ * cell which was two-phase in the previous call, and the flash of such a cell
+ * starts from these instead of the values of the fluid state, which skips
+ * the stability test.  If the warm-started flash fails or yields a liquid
+ * fraction outside of (0, 1), the cell is flashed again starting from the
+ * values of the fluid state.
+ *
+ * Newton's method and the derivatives of the results are still computed for
+ * one cell after another, by the corresponding methods of PTFlash.  Like the
+ * rest of PTFlash, the batched flash assumes that there is no capillary
+ * pressure.
+ */
+template <class Scalar, class FluidSystem, bool isThermal = false>
+class PTFlashBatch : public PTFlash<Scalar, FluidSystem, isThermal>
+{
+    using Base = PTFlash<Scalar, FluidSystem, isThermal>;
+
+    static constexpr int numComponents = FluidSystem::numComponents;
+    enum { oilPhaseIdx = FluidSystem::oilPhaseIdx };
+    enum { gasPhaseIdx = FluidSystem::gasPhaseIdx };
+
+    using EOSType = CompositionalConfig::EOSType;
+    using ComponentVector = Dune::FieldVector<Scalar, numComponents>;
+    using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
+    using PureParams = CubicEOSParams<Scalar, FluidSystem, oilPhaseIdx>;
+
+    static constexpr Scalar R = Constants<Scalar>::R;
+
+    // Quantities of a subset of the cells of a batch which are processed
+    // together.  Per-component quantities are stored component by component
+    // with a stride of the number of cells of the set.
+    struct CellSet
+    {
+        std::size_t size() const
+        { return cell.size(); }
+
+        void resize(const std::size_t n)
+        {
+            cell.resize(n);
+            for (auto* a : { &zMin, &L, &S }) {
+                a->resize(n);
+            }
+            for (auto* a : { &z, &K, &sqrtA, &Bi, &x, &y, &phi0, &phi1 }) {
+                a->resize(n*numComponents);
+            }
+        }
+
+        // Keep the cells for which keep[j] is non-zero, in their order.
+        void compact(const std::vector<unsigned char>& keep)
+        {
+            const std::size_t oldSize = size();
+            std::size_t newSize = 0;
+            for (std::size_t j = 0; j < oldSize; ++j) {
+                if (keep[j]) {
+                    cell[newSize] = cell[j];
+                    zMin[newSize] = zMin[j];
+                    L[newSize] = L[j];
+                    S[newSize] = S[j];
+                    ++newSize;
+                }
+            }
+
+            // The destination of each element never lies behind its source,
+            // so the arrays can be compacted in place.
+            for (auto* a : { &z, &K, &sqrtA, &Bi, &x, &y, &phi0, &phi1 }) {
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    std::size_t jNew = 0;
+                    for (std::size_t j = 0; j < oldSize; ++j) {
+                        if (keep[j]) {
+                            (*a)[compIdx*newSize + jNew++] = (*a)[compIdx*oldSize + j];
+                        }
+                    }
+                }
+            }
+
+            resize(newSize);
+        }
+
+        std::vector<std::size_t> cell; // index of the cell in the batch
+        std::vector<Scalar> zMin, L, S;
+        std::vector<Scalar> z, K, sqrtA, Bi, x, y, phi0, phi1;
+    };
+
+public:
+    /*!
+     * \brief Memory of the batched flash which is kept between calls.
+     *
+     * A workspace must be used for batches of the same cells only, i.e., the
+     * fluid state at a given position of the batch must always belong to the
+     * same cell, since the workspace stores the state of the previous flash
+     * for warm starts.
+     */
+    class Workspace
+    {
+    public:
+        //! Forget the state of all cells, so that the next flash does not
+        //! warm-start any cell.
+        void reset()
+        { std::fill(hasState_.begin(), hasState_.end(), 0); }
+
+        //! Number of cells of the last batch
+        std::size_t numCells() const
+        { return L_.size(); }
+
+        //! Returns true iff the cell was found to be single-phase by the last
+        //! flash, i.e., the value returned by PTFlash::solve().
+        bool isSinglePhase(const std::size_t cellIdx) const
+        { return singlePhase_[cellIdx]; }
+
+    private:
+        friend class PTFlashBatch;
+
+        void resize_(const std::size_t numCells)
+        {
+            if (numCells != numCells_) {
+                numCells_ = numCells;
+                hasState_.assign(numCells, 0);
+                storedK_.resize(numCells*numComponents);
+                storedL_.resize(numCells);
+            }
+
+            for (auto* a : { &T_, &p_, &zMin_, &L_, &SV_, &SL_ }) {
+                a->resize(numCells);
+            }
+            for (auto* a : { &z_, &K_, &sqrtA_, &Bi_, &x_, &y_ }) {
+                a->resize(numCells*numComponents);
+            }
+            for (auto* a : { &singlePhase_, &warm_, &trivialV_, &trivialL_ }) {
+                a->resize(numCells);
+            }
+        }
+
+        std::size_t numCells_{0};
+
+        // Two-phase state of the previous flash
+        std::vector<unsigned char> hasState_;
+        std::vector<Scalar> storedK_, storedL_;
+
+        // Quantities of all cells of the current batch, per-component ones
+        // with a stride of the number of cells
+        std::vector<Scalar> T_, p_, zMin_, L_, SV_, SL_;
+        std::vector<Scalar> z_, K_, sqrtA_, Bi_, x_, y_;
+        std::vector<unsigned char> singlePhase_, warm_, trivialV_, trivialL_;
+
+        // Parameters of the EOS
+        Scalar m1_{}, m2_{};
+        std::array<std::array<Scalar, numComponents>, numComponents> oneMinusKij_{};
+
+        // Cells which are processed together, and scratch memory of the
+        // fugacity evaluation
+        CellSet set_;
+        std::vector<Scalar> mixture_;
+        std::vector<unsigned char> keep_;
+        std::vector<std::size_t> cells_, retry_;
+    };
+
+    /*!
+     * \brief Calculates the phase split of every fluid state of a batch.
+     *
+     * The arguments except for the workspace have the same meaning as for
+     * PTFlash::solve(), and the fluid states are updated in the same way.
+     * Whether a cell is single-phase is available from the workspace
+     * afterwards.
+     */
+    template <class FluidState>
+    static void solve(std::span<FluidState> fluid_states,
+                      Workspace& workspace,
+                      const std::string& twoPhaseMethod,
+                      Scalar flash_tolerance,
+                      const EOSType& eos_type,
+                      int verbosity = 0)
+    {
+        if (twoPhaseMethod != "newton" && twoPhaseMethod != "ssi" && twoPhaseMethod != "ssi+newton") {
+            OPM_THROW(std::logic_error,
+                      "unknown two phase flash method " + twoPhaseMethod + " is specified");
+        }
+
+        auto& ws = workspace;
+        const std::size_t numCells = fluid_states.size();
+        ws.resize_(numCells);
+        setEosParams_(ws, eos_type);
+
+        PureParams pureParams;
+        pureParams.setEOSType(eos_type);
+        for (std::size_t cell = 0; cell < numCells; ++cell) {
+            const auto& fs = fluid_states[cell];
+            const Scalar T = Opm::getValue(fs.temperature(0));
+            const Scalar p = Opm::getValue(fs.pressure(oilPhaseIdx));
+            ws.T_[cell] = T;
+            ws.p_[cell] = p;
+            // Lower bound of the compressibility factor which corresponds
+            // to the lower bound of the molar volume in CubicEOS.
+            ws.zMin_[cell] = 1e-7 * p / (R * T);
+
+            pureParams.updatePure(T, p);
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                const std::size_t idx = compIdx*numCells + cell;
+                ws.z_[idx] = Opm::getValue(fs.moleFraction(compIdx));
+                ws.sqrtA_[idx] = std::sqrt(pureParams.Ai(compIdx));
+                ws.Bi_[idx] = pureParams.Bi(compIdx);
+            }
+
+            ws.warm_[cell] = ws.hasState_[cell];
+            loadInitialGuess_(fs, ws, cell);
+        }
+
+        ws.cells_.resize(numCells);
+        for (std::size_t cell = 0; cell < numCells; ++cell) {
+            ws.cells_[cell] = cell;
+        }
+        flash_(ws, twoPhaseMethod, flash_tolerance, eos_type, verbosity);
+
+        // Flash the cells for which the warm start failed again, starting
+        // from the K-values and the liquid fraction of the fluid state.
+        const std::size_t numRetries = ws.retry_.size();
+        if (numRetries > 0) {
+            ws.cells_ = ws.retry_;
+            for (const auto cell : ws.cells_) {
+                ws.warm_[cell] = 0;
+                loadInitialGuess_(fluid_states[cell], ws, cell);
+            }
+            flash_(ws, twoPhaseMethod, flash_tolerance, eos_type, verbosity);
+        }
+
+        std::size_t numTwoPhase = 0;
+        for (std::size_t cell = 0; cell < numCells; ++cell) {
+            auto& fs = fluid_states[cell];
+            ScalarFluidState fs_scalar;
+            fs_scalar.setPressure(oilPhaseIdx, Opm::getValue(fs.pressure(oilPhaseIdx)));
+            fs_scalar.setPressure(gasPhaseIdx, Opm::getValue(fs.pressure(gasPhaseIdx)));
+            fs_scalar.setTemperature(ws.T_[cell]);
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                const std::size_t idx = compIdx*numCells + cell;
+                fs_scalar.setMoleFraction(compIdx, ws.z_[idx]);
+                fs_scalar.setMoleFraction(oilPhaseIdx, compIdx, ws.x_[idx]);
+                fs_scalar.setMoleFraction(gasPhaseIdx, compIdx, ws.y_[idx]);
+                fs_scalar.setKvalue(compIdx, ws.K_[idx]);
+            }
+            fs_scalar.setLvalue(ws.L_[cell]);
+
+            const bool is_single_phase = ws.singlePhase_[cell];
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                fs.setMoleFraction(oilPhaseIdx, compIdx, ws.x_[compIdx*numCells + cell]);
+                fs.setMoleFraction(gasPhaseIdx, compIdx, ws.y_[compIdx*numCells + cell]);
+            }
+            Base::updateDerivatives_(fs_scalar, fs, eos_type, is_single_phase);
+
+            // Remember the state of two-phase cells for the next flash.
+            const Scalar L = ws.L_[cell];
+            ws.hasState_[cell] = !is_single_phase && L > 0 && L < 1;
+            if (ws.hasState_[cell]) {
+                ++numTwoPhase;
+                ws.storedL_[cell] = L;
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    ws.storedK_[compIdx*numCells + cell] = ws.K_[compIdx*numCells + cell];
+                }
+            }
+        }
+
+        if (verbosity >= 1) {
+            OpmLog::debug(fmt::format("Batched flash of {} cells: {} two-phase, {} warm starts retried",
+                                      numCells, numTwoPhase, numRetries));
+        }
+    }
+
+protected:
+    static void setEosParams_(Workspace& ws, const EOSType& eos_type)
+    {
+        PureParams params;
+        params.setEOSType(eos_type);
+        ws.m1_ = params.m1();
+        ws.m2_ = params.m2();
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            for (int compJIdx = 0; compJIdx < numComponents; ++compJIdx) {
+                ws.oneMinusKij_[compIdx][compJIdx] = 1 - FluidSystem::interactionCoefficient(compIdx, compJIdx);
+            }
+        }
+    }
+
+    template <class FluidState>
+    static void loadInitialGuess_(const FluidState& fs, Workspace& ws, const std::size_t cell)
+    {
+        const std::size_t numCells = ws.numCells_;
+        if (ws.warm_[cell]) {
+            ws.L_[cell] = ws.storedL_[cell];
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                ws.K_[compIdx*numCells + cell] = ws.storedK_[compIdx*numCells + cell];
+            }
+        }
+        else {
+            ws.L_[cell] = Opm::getValue(fs.L());
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                ws.K_[compIdx*numCells + cell] = Opm::getValue(fs.K(compIdx));
+            }
+        }
+    }
+
+    // Flash the cells in ws.cells_, which also receives the warm-started
+    // cells whose flash failed.
+    static void flash_(Workspace& ws,
+                       const std::string& twoPhaseMethod,
+                       const Scalar flash_tolerance,
+                       const EOSType& eos_type,
+                       const int verbosity)
+    {
+        const std::size_t numCells = ws.numCells_;
+        ws.retry_.clear();
+
+        // Stability test of the cells which are not known to be two-phase
+        std::vector<std::size_t> stabilityCells;
+        for (const auto cell : ws.cells_) {
+            const Scalar L = ws.L_[cell];
+            ws.singlePhase_[cell] = 0;
+            if (L <= 0 || L == 1) {
+                stabilityCells.push_back(cell);
+            }
+        }
+        if (!stabilityCells.empty()) {
+            phaseStabilityTest_(ws, stabilityCells);
+        }
+
+        // Initial liquid fraction of two-phase cells, and phase labeling of
+        // single-phase ones
+        std::vector<std::size_t> twoPhaseCells;
+        for (const auto cell : ws.cells_) {
+            ComponentVector K, z;
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                K[compIdx] = ws.K_[compIdx*numCells + cell];
+                z[compIdx] = ws.z_[compIdx*numCells + cell];
+            }
+
+            if (ws.singlePhase_[cell]) {
+                ScalarFluidState fs_scalar;
+                fs_scalar.setTemperature(ws.T_[cell]);
+                ws.L_[cell] = Base::li_single_phase_label_(fs_scalar, z, verbosity);
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    ws.x_[compIdx*numCells + cell] = z[compIdx];
+                    ws.y_[compIdx*numCells + cell] = z[compIdx];
+                }
+                continue;
+            }
+
+            try {
+                ws.L_[cell] = Base::solveRachfordRice_g_(K, z, verbosity);
+                twoPhaseCells.push_back(cell);
+            }
+            catch (const std::runtime_error&) {
+                if (!ws.warm_[cell]) {
+                    throw;
+                }
+                ws.retry_.push_back(cell);
+            }
+        }
+
+        // Composition of the two-phase cells
+        std::vector<std::size_t> newtonCells;
+        if (twoPhaseMethod == "newton") {
+            newtonCells = twoPhaseCells;
+        }
+        else {
+            const bool newton_afterwards = (twoPhaseMethod == "ssi+newton");
+            const int maxIterations = newton_afterwards ? 5 : 100;
+            auto unconverged = successiveSubstitutionComposition_(ws, twoPhaseCells, maxIterations,
+                                                                  flash_tolerance);
+            if (newton_afterwards) {
+                newtonCells = std::move(unconverged);
+            }
+            else {
+                for (const auto cell : unconverged) {
+                    if (!ws.warm_[cell]) {
+                        OPM_THROW(std::runtime_error,
+                                  fmt::format("Successive substitution composition update did not "
+                                              "converge within maxIterations {}.", maxIterations));
+                    }
+                    ws.retry_.push_back(cell);
+                }
+            }
+        }
+
+        for (const auto cell : newtonCells) {
+            ScalarFluidState fs_scalar;
+            fs_scalar.setPressure(oilPhaseIdx, ws.p_[cell]);
+            fs_scalar.setPressure(gasPhaseIdx, ws.p_[cell]);
+            fs_scalar.setTemperature(ws.T_[cell]);
+            ComponentVector K, z;
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                K[compIdx] = ws.K_[compIdx*numCells + cell];
+                z[compIdx] = ws.z_[compIdx*numCells + cell];
+                fs_scalar.setMoleFraction(compIdx, z[compIdx]);
+            }
+
+            Scalar L = ws.L_[cell];
+            try {
+                Base::newtonComposition_(K, L, fs_scalar, z, flash_tolerance, eos_type, verbosity);
+            }
+            catch (const std::runtime_error&) {
+                if (!ws.warm_[cell]) {
+                    throw;
+                }
+                ws.retry_.push_back(cell);
+                continue;
+            }
+
+            ws.L_[cell] = L;
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                const std::size_t idx = compIdx*numCells + cell;
+                ws.K_[idx] = K[compIdx];
+                ws.x_[idx] = fs_scalar.moleFraction(oilPhaseIdx, compIdx);
+                ws.y_[idx] = fs_scalar.moleFraction(gasPhaseIdx, compIdx);
+            }
+        }
+
+        // A warm-started cell which does not end up with two phases may have
+        // converged to a spurious solution.
+        for (const auto cell : twoPhaseCells) {
+            const Scalar L = ws.L_[cell];
+            if (ws.warm_[cell] && !(L > 0 && L < 1)) {
+                ws.retry_.push_back(cell);
+            }
+        }
+        std::sort(ws.retry_.begin(), ws.retry_.end());
+        ws.retry_.erase(std::unique(ws.retry_.begin(), ws.retry_.end()), ws.retry_.end());
+    }
+
+    // Michelsen's stability test, see PTFlash::phaseStabilityTest_().
+    static void phaseStabilityTest_(Workspace& ws, const std::vector<std::size_t>& cells)
+    {
+        const std::size_t numCells = ws.numCells_;
+        for (const bool isGas : { true, false }) {
+            auto& set = ws.set_;
+            gather_(ws, cells, set);
+
+            // The fugacities of the reference phase, with the global
+            // composition, do not change during the iterations.
+            fugacityCoefficients_(ws, set, set.z.data(), /*isGas=*/!isGas, set.phi0.data());
+
+            for (int i = 0; i < 20000 && set.size() > 0; ++i) {
+                const std::size_t m = set.size();
+                trialComposition_(set, isGas);
+                fugacityCoefficients_(ws, set, set.x.data(), isGas, set.phi1.data());
+
+                ws.keep_.assign(m, 1);
+                for (std::size_t j = 0; j < m; ++j) {
+                    Scalar R_norm = 0.0;
+                    Scalar K_norm = 0.0;
+                    for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                        const std::size_t idx = compIdx*m + j;
+                        const Scalar fug_fake = set.phi1[idx] * set.x[idx];
+                        const Scalar fug_global = set.phi0[idx] * set.z[idx];
+                        const Scalar R = isGas
+                            ? (fug_global / fug_fake) / set.S[j]
+                            : (fug_fake / fug_global) * set.S[j];
+                        set.K[idx] *= R;
+
+                        const Scalar a = R - 1.0;
+                        const Scalar b = std::log(set.K[idx]);
+                        R_norm += a*a;
+                        K_norm += b*b;
+                    }
+
+                    const bool isTrivial = (K_norm < 1e-5);
+                    if (isTrivial || R_norm < 1e-10) {
+                        const std::size_t cell = set.cell[j];
+                        (isGas ? ws.trivialV_ : ws.trivialL_)[cell] = isTrivial;
+                        auto& xy = isGas ? ws.y_ : ws.x_;
+                        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                            xy[compIdx*numCells + cell] = set.x[compIdx*m + j];
+                        }
+                        (isGas ? ws.SV_ : ws.SL_)[cell] = set.S[j];
+                        ws.keep_[j] = 0;
+                    }
+                }
+
+                set.compact(ws.keep_);
+            }
+            if (set.size() > 0) {
+                OPM_THROW(std::runtime_error, " Stability test did not converge");
+            }
+        }
+
+        for (const auto cell : cells) {
+            const bool V_unstable = (ws.SV_[cell] < (1.0 + 1e-5)) || ws.trivialV_[cell];
+            const bool L_stable = (ws.SL_[cell] < (1.0 + 1e-5)) || ws.trivialL_[cell];
+            ws.singlePhase_[cell] = L_stable && V_unstable;
+            if (!ws.singlePhase_[cell]) {
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    const std::size_t idx = compIdx*numCells + cell;
+                    ws.K_[idx] = ws.y_[idx] / ws.x_[idx];
+                }
+            }
+        }
+    }
+
+    // Successive substitution of the two-phase cells, see
+    // PTFlash::successiveSubstitutionComposition_().  Returns the cells
+    // which did not converge, except for warm-started ones which are added to
+    // ws.retry_ instead if their liquid fraction leaves (0, 1).
+    static std::vector<std::size_t>
+    successiveSubstitutionComposition_(Workspace& ws,
+                                       const std::vector<std::size_t>& cells,
+                                       const int maxIterations,
+                                       const Scalar flash_tolerance)
+    {
+        const std::size_t numCells = ws.numCells_;
+        auto& set = ws.set_;
+        gather_(ws, cells, set);
+
+        for (int i = 0; i < maxIterations && set.size() > 0; ++i) {
+            const std::size_t m = set.size();
+            computeLiquidVapor_(set);
+            fugacityCoefficients_(ws, set, set.x.data(), /*isGas=*/false, set.phi0.data());
+            fugacityCoefficients_(ws, set, set.y.data(), /*isGas=*/true, set.phi1.data());
+
+            ws.keep_.assign(m, 1);
+            for (std::size_t j = 0; j < m; ++j) {
+                std::array<Scalar, numComponents> fugRatio;
+                Scalar convNorm = 0.0;
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    const std::size_t idx = compIdx*m + j;
+                    fugRatio[compIdx] = (set.phi0[idx] * set.x[idx]) / (set.phi1[idx] * set.y[idx]);
+                    convNorm += (fugRatio[compIdx] - 1.0) * (fugRatio[compIdx] - 1.0);
+                }
+
+                const std::size_t cell = set.cell[j];
+                if (std::sqrt(convNorm) < flash_tolerance) {
+                    ws.L_[cell] = set.L[j];
+                    for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                        const std::size_t idx = compIdx*m + j;
+                        ws.K_[compIdx*numCells + cell] = set.K[idx];
+                        ws.x_[compIdx*numCells + cell] = set.x[idx];
+                        ws.y_[compIdx*numCells + cell] = set.y[idx];
+                    }
+                    ws.keep_[j] = 0;
+                    continue;
+                }
+
+                ComponentVector K, z;
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    const std::size_t idx = compIdx*m + j;
+                    set.K[idx] *= fugRatio[compIdx];
+                    K[compIdx] = set.K[idx];
+                    z[compIdx] = set.z[idx];
+                }
+                try {
+                    set.L[j] = Base::solveRachfordRice_g_(K, z, 0);
+                }
+                catch (const std::runtime_error&) {
+                    if (!ws.warm_[cell]) {
+                        throw;
+                    }
+                    set.L[j] = 0.0;
+                }
+
+                // A warm-started cell whose liquid fraction leaves (0, 1) has
+                // most likely become single-phase, and is flashed again from
+                // the values of the fluid state.
+                if (ws.warm_[cell] && !(set.L[j] > 0 && set.L[j] < 1)) {
+                    ws.retry_.push_back(cell);
+                    ws.keep_[j] = 0;
+                }
+            }
+
+            set.compact(ws.keep_);
+        }
+
+        // Unconverged cells continue from their last iterate.
+        std::vector<std::size_t> unconverged(set.cell.begin(), set.cell.end());
+        const std::size_t m = set.size();
+        for (std::size_t j = 0; j < m; ++j) {
+            const std::size_t cell = set.cell[j];
+            ws.L_[cell] = set.L[j];
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                ws.K_[compIdx*numCells + cell] = set.K[compIdx*m + j];
+            }
+        }
+
+        return unconverged;
+    }
+
+    static void gather_(const Workspace& ws, const std::vector<std::size_t>& cells, CellSet& set)
+    {
+        const std::size_t numCells = ws.numCells_;
+        const std::size_t n = cells.size();
+        set.resize(n);
+        for (std::size_t j = 0; j < n; ++j) {
+            const std::size_t cell = cells[j];
+            set.cell[j] = cell;
+            set.zMin[j] = ws.zMin_[cell];
+            set.L[j] = ws.L_[cell];
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                const std::size_t src = compIdx*numCells + cell;
+                const std::size_t dst = compIdx*n + j;
+                set.z[dst] = ws.z_[src];
+                set.K[dst] = ws.K_[src];
+                set.sqrtA[dst] = ws.sqrtA_[src];
+                set.Bi[dst] = ws.Bi_[src];
+            }
+        }
+    }
+
+    // Normalized composition of the trial phase of the stability test in
+    // set.x, and the sum of the unnormalized one in set.S.
+    static void trialComposition_(CellSet& set, const bool isGas)
+    {
+        const std::size_t n = set.size();
+        Scalar* S = set.S.data();
+        Scalar* xy = set.x.data();
+        const Scalar* K = set.K.data();
+        const Scalar* z = set.z.data();
+
+        std::fill(set.S.begin(), set.S.end(), 0.0);
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const std::size_t o = compIdx*n;
+            for (std::size_t j = 0; j < n; ++j) {
+                xy[o + j] = isGas ? K[o + j] * z[o + j] : z[o + j] / K[o + j];
+                S[j] += xy[o + j];
+            }
+        }
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const std::size_t o = compIdx*n;
+            for (std::size_t j = 0; j < n; ++j) {
+                xy[o + j] /= S[j];
+            }
+        }
+    }
+
+    // Normalized liquid and vapor compositions from K, L and z, see
+    // PTFlash::computeLiquidVapor_().
+    static void computeLiquidVapor_(CellSet& set)
+    {
+        const std::size_t n = set.size();
+        Scalar* x = set.x.data();
+        Scalar* y = set.y.data();
+        const Scalar* K = set.K.data();
+        const Scalar* z = set.z.data();
+        const Scalar* L = set.L.data();
+
+        // Use phi0 and phi1 to accumulate the sums, they are overwritten by
+        // the fugacity coefficients afterwards.
+        Scalar* sumx = set.phi0.data();
+        Scalar* sumy = set.phi1.data();
+        std::fill_n(sumx, n, 0.0);
+        std::fill_n(sumy, n, 0.0);
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const std::size_t o = compIdx*n;
+            for (std::size_t j = 0; j < n; ++j) {
+                const Scalar d = L[j] + (1 - L[j])*K[o + j];
+                x[o + j] = z[o + j] / d;
+                y[o + j] = (K[o + j] * z[o + j]) / d;
+                sumx[j] += x[o + j];
+                sumy[j] += y[o + j];
+            }
+        }
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const std::size_t o = compIdx*n;
+            for (std::size_t j = 0; j < n; ++j) {
+                x[o + j] /= sumx[j];
+                y[o + j] /= sumy[j];
+            }
+        }
+    }
+
+    /*!
+     * \brief Fugacity coefficients of the components of a phase for all
+     *        cells of a set, see CubicEOS::computeFugacityCoefficient().
+     *
+     * \param x Composition of the phase, stored like the per-component
+     *          quantities of the set.
+     * \param isGas Whether to select the gas root of the cubic equation.
+     * \param phi Receives the fugacity coefficients.
+     */
+    static void fugacityCoefficients_(Workspace& ws,
+                                      const CellSet& set,
+                                      const Scalar* x,
+                                      const bool isGas,
+                                      Scalar* phi)
+    {
+        const std::size_t n = set.size();
+        const Scalar m1 = ws.m1_;
+        const Scalar m2 = ws.m2_;
+        const auto& c = ws.oneMinusKij_;
+        const Scalar* sqrtA = set.sqrtA.data();
+        const Scalar* Bi = set.Bi.data();
+
+        // Layout of the scratch memory: sum_j (1 - k_ij) sqrt(A_j) x_j per
+        // component, followed by A, B and the coefficients of ln(phi_i).
+        ws.mixture_.resize((numComponents + 6)*n);
+        Scalar* Ax = ws.mixture_.data();
+        Scalar* A = Ax + numComponents*n;
+        Scalar* B = A + n;
+        Scalar* alpha = B + n;
+        Scalar* beta = alpha + n;
+        Scalar* zMinusOne = beta + n;
+        Scalar* twoOverA = zMinusOne + n;
+
+        // Mixture parameters.  The mole fractions are clamped to [0, 1] for
+        // A and B as by CubicEOSParams::updateMix(), but not for the
+        // component sums.
+        std::fill_n(A, 2*n, 0.0);
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const std::size_t o = compIdx*n;
+            std::fill_n(Ax + o, n, 0.0);
+            for (int compJIdx = 0; compJIdx < numComponents; ++compJIdx) {
+                const std::size_t oj = compJIdx*n;
+                const Scalar cij = c[compIdx][compJIdx];
+                for (std::size_t j = 0; j < n; ++j) {
+                    Ax[o + j] += cij * sqrtA[oj + j] * x[oj + j];
+                    const Scalar xi = std::clamp(x[o + j], Scalar{0}, Scalar{1});
+                    const Scalar xj = std::clamp(x[oj + j], Scalar{0}, Scalar{1});
+                    A[j] += xi * xj * cij * sqrtA[o + j] * sqrtA[oj + j];
+                }
+            }
+            for (std::size_t j = 0; j < n; ++j) {
+                B[j] += std::clamp(x[o + j], Scalar{0}, Scalar{1}) * Bi[o + j];
+            }
+        }
+
+        // Compressibility factor and the terms of ln(phi_i) which do not
+        // depend on the component
+        for (std::size_t j = 0; j < n; ++j) {
+            const Scalar Z = std::max(compressibilityFactor_(A[j], B[j], m1, m2, isGas), set.zMin[j]);
+            alpha[j] = -std::log(Z - B[j]);
+            beta[j] = std::log((Z + m2 * B[j]) / (Z + m1 * B[j])) * A[j] / ((m1 - m2) * B[j]);
+            zMinusOne[j] = Z - 1;
+            twoOverA[j] = 2 / A[j];
+        }
+
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const std::size_t o = compIdx*n;
+            for (std::size_t j = 0; j < n; ++j) {
+                const Scalar Bi_B = Bi[o + j] / B[j];
+                const Scalar A_s = sqrtA[o + j] * Ax[o + j];
+                const Scalar ln_phi = alpha[j] + Bi_B * zMinusOne[j]
+                    + beta[j] * (twoOverA[j] * A_s - Bi_B);
+                phi[o + j] = std::clamp(std::exp(ln_phi), Scalar{1e-10}, Scalar{1e10});
+            }
+        }
+    }
+
+    /*!
+     * \brief Root of the cubic equation of state for the compressibility
+     *        factor, see CubicEOS::computeMolarVolume().
+     *
+     * Solves the cubic like cubicRoots(), but only computes the root which
+     * is selected: the largest one for the gas phase and the smallest one
+     * for the liquid phase if there are three real roots.
+     */
+    static Scalar compressibilityFactor_(const Scalar A, const Scalar B,
+                                         const Scalar m1, const Scalar m2,
+                                         const bool isGas)
+    {
+        // Z^3 + a2*Z^2 + a3*Z + a4 = 0
+        const Scalar a2 = (m1 + m2 - 1) * B - 1;
+        const Scalar a3 = A + m1 * m2 * B * B - (m1 + m2) * B * (B + 1);
+        const Scalar a4 = -A * B - m1 * m2 * B * B * (B + 1);
+
+        // Depressed cubic t^3 + p*t + q = 0 with Z = t - a2/3
+        const Scalar shift = a2 / 3.0;
+        const Scalar p = a3 - a2 * a2 / 3.0;
+        const Scalar q = (2.0 * a2 * a2 * a2 - 9.0 * a2 * a3 + 27.0 * a4) / 27.0;
+
+        const Scalar discr = 4.0 * p * p * p + 27.0 * q * q;
+        if (discr < 0.0) {
+            // Three real roots.  cos(theta) yields the largest and
+            // cos(theta - 4*pi/3) the smallest one.
+            const Scalar theta = (1.0 / 3.0) * std::acos(((3.0 * q) / (2.0 * p)) * std::sqrt(-3.0 / p));
+            const Scalar phase = isGas ? 0.0 : (4.0 * std::numbers::pi) / 3.0;
+            return 2.0 * std::sqrt(-p / 3.0) * std::cos(theta - phase) - shift;
+        }
+        if (p < 0) {
+            const Scalar theta = (1.0 / 3.0) * std::acosh(((-3.0 * std::abs(q)) / (2.0 * p)) * std::sqrt(-3.0 / p));
+            return ((-2.0 * std::abs(q)) / q) * std::sqrt(-p / 3.0) * std::cosh(theta) - shift;
+        }
+        if (p > 0) {
+            const Scalar theta = (1.0 / 3.0) * std::asinh(((3.0 * q) / (2.0 * p)) * std::sqrt(3.0 / p));
+            return -2.0 * std::sqrt(p / 3.0) * std::sinh(theta) - shift;
+        }
+        return std::cbrt(-q) - shift;
+    }
+};
+
+} // namespace Opm
+
+#endif // OPM_PTFLASH_BATCH_HPP
@@ -0,0 +1,290 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::PTFlashStabilityCache
+ */
+#ifndef OPM_PTFLASH_STABILITY_CACHE_HPP
+#define OPM_PTFLASH_STABILITY_CACHE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Remembers the outcome of the phase stability test of every cell, so
+ *        that PTFlash can skip the test while the state of a cell changes
+ *        only slightly.
+ *
+ * For every cell, the cache stores the pressure, temperature and global
+ * composition of the last full stability test or two-phase flash, whether
+ * the cell was single-phase, its K-values, and an estimate of its distance
+ * to the phase boundary.  The distance is the smallest margin 1 - S of the
+ * two trial phases of Michelsen's test, where S is the sum of the mole
+ * numbers of the trial phase; a trial phase which converges to the trivial
+ * solution does not limit the distance.
+ *
+ * If pressure, temperature and composition of a cell moved less than the
+ * thresholds since the last test, a single-phase cell whose distance to the
+ * boundary is at least minStabilityMargin stays single-phase without a
+ * stability test, and a two-phase cell starts the two-phase flash from the
+ * cached K-values.  If the latter does not converge to a non-trivial
+ * two-phase solution, PTFlash falls back to the stability test.
+ *
+ * The entries of different cells are independent, so that cells may be
+ * flashed concurrently as long as every cell is flashed by one thread only.
+ */
+template <class Scalar, int numComponents>
+class PTFlashStabilityCache
+{
+public:
+    //! Thresholds below which a cell may reuse the outcome of the last test.
+    struct Thresholds
+    {
+        //! Maximum change of the pressure relative to the cached pressure
+        Scalar maxRelativePressureChange = 1.0e-3;
+
+        //! Maximum change of the temperature [K]
+        Scalar maxTemperatureChange = 0.1;
+
+        //! Maximum change of any global mole fraction
+        Scalar maxCompositionChange = 1.0e-4;
+
+        //! Minimum distance to the phase boundary of a single-phase cell
+        Scalar minStabilityMargin = 1.0e-2;
+    };
+
+    //! How the outcome of the last test may be reused for a cell.
+    enum class Lookup { Miss, SinglePhase, TwoPhase };
+
+    //! Number of flashes which consulted the cache, and what came of it.
+    struct Counters
+    {
+        //! Flashes which would have required a stability test
+        std::size_t lookups = 0;
+
+        //! Stability tests skipped because the cell stayed single-phase
+        std::size_t singlePhaseHits = 0;
+
+        //! Stability tests skipped by a two-phase flash from cached K-values
+        std::size_t twoPhaseHits = 0;
+
+        //! Two-phase flashes from cached K-values which fell back to a
+        //! stability test
+        std::size_t fallbacks = 0;
+
+        //! Fraction of the lookups which skipped the stability test
+        double hitRate() const
+        {
+            return lookups == 0 ? 0.0
+                : static_cast<double>(singlePhaseHits + twoPhaseHits) / lookups;
+        }
+
+        Counters& operator+=(const Counters& other)
+        {
+            lookups += other.lookups;
+            singlePhaseHits += other.singlePhaseHits;
+            twoPhaseHits += other.twoPhaseHits;
+            fallbacks += other.fallbacks;
+            return *this;
+        }
+    };
+
+    explicit PTFlashStabilityCache(const std::size_t numCells = 0,
+                                   const Thresholds& thresholds = Thresholds{})
+        : entries_(numCells)
+        , thresholds_(thresholds)
+    {}
+
+    //! Set the number of cells, and forget all cached outcomes.
+    void resize(const std::size_t numCells)
+    {
+        entries_.assign(numCells, Entry{});
+    }
+
+    std::size_t numCells() const
+    { return entries_.size(); }
+
+    //! Forget the cached outcomes of all cells but keep the counters.
+    void invalidate()
+    {
+        for (auto& entry : entries_) {
+            entry.valid = false;
+        }
+    }
+
+    const Thresholds& thresholds() const
+    { return thresholds_; }
+
+    void setThresholds(const Thresholds& thresholds)
+    { thresholds_ = thresholds; }
+
+    //! Counters summed over all cells.
+    Counters counters() const
+    {
+        Counters result;
+        for (const auto& entry : entries_) {
+            result += entry.counters;
+        }
+        return result;
+    }
+
+    //! Counters of a single cell.
+    const Counters& counters(const std::size_t cellIdx) const
+    { return entries_.at(cellIdx).counters; }
+
+    void resetCounters()
+    {
+        for (auto& entry : entries_) {
+            entry.counters = Counters{};
+        }
+    }
+
+    /*!
+     * \brief Decide whether the outcome of the last test of a cell may be
+     *        reused for the given state, and count the lookup.
+     */
+    template <class Vector>
+    Lookup lookup(const std::size_t cellIdx,
+                  const Scalar pressure,
+                  const Scalar temperature,
+                  const Vector& z)
+    {
+        auto& entry = entries_.at(cellIdx);
+        ++entry.counters.lookups;
+        if (!entry.valid) {
+            return Lookup::Miss;
+        }
+
+        if (std::abs(pressure - entry.pressure) > thresholds_.maxRelativePressureChange*entry.pressure ||
+            std::abs(temperature - entry.temperature) > thresholds_.maxTemperatureChange)
+        {
+            return Lookup::Miss;
+        }
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            if (std::abs(z[compIdx] - entry.z[compIdx]) > thresholds_.maxCompositionChange) {
+                return Lookup::Miss;
+            }
+        }
+
+        if (entry.singlePhase) {
+            if (entry.stabilityMargin < thresholds_.minStabilityMargin) {
+                return Lookup::Miss;
+            }
+            ++entry.counters.singlePhaseHits;
+            return Lookup::SinglePhase;
+        }
+
+        ++entry.counters.twoPhaseHits;
+        return Lookup::TwoPhase;
+    }
+
+    //! K-values of the last two-phase flash of a cell.
+    const std::array<Scalar, numComponents>& K(const std::size_t cellIdx) const
+    { return entries_.at(cellIdx).K; }
+
+    /*!
+     * \brief Count a two-phase flash from cached K-values which did not
+     *        yield a two-phase solution, and forget the outcome for the cell.
+     */
+    void recordFallback(const std::size_t cellIdx)
+    {
+        auto& entry = entries_.at(cellIdx);
+        --entry.counters.twoPhaseHits;
+        ++entry.counters.fallbacks;
+        entry.valid = false;
+    }
+
+    //! Store the outcome of a stability test which found a single phase.
+    template <class Vector>
+    void storeSinglePhase(const std::size_t cellIdx,
+                          const Scalar pressure,
+                          const Scalar temperature,
+                          const Vector& z,
+                          const Scalar stabilityMargin)
+    {
+        auto& entry = entries_.at(cellIdx);
+        store_(entry, pressure, temperature, z);
+        entry.singlePhase = true;
+        entry.stabilityMargin = stabilityMargin;
+    }
+
+    //! Store the K-values of a two-phase flash.
+    template <class Vector>
+    void storeTwoPhase(const std::size_t cellIdx,
+                       const Scalar pressure,
+                       const Scalar temperature,
+                       const Vector& z,
+                       const Vector& K)
+    {
+        auto& entry = entries_.at(cellIdx);
+        store_(entry, pressure, temperature, z);
+        entry.singlePhase = false;
+        entry.stabilityMargin = 0.0;
+        std::copy_n(K.begin(), numComponents, entry.K.begin());
+    }
+
+    //! Distance to the phase boundary of a trial phase of the stability
+    //! test.
+    static Scalar stabilityMargin(const bool isTrivial, const Scalar S)
+    {
+        return isTrivial ? std::numeric_limits<Scalar>::max() : Scalar{1} - S;
+    }
+
+private:
+    struct Entry
+    {
+        bool valid = false;
+        bool singlePhase = false;
+        Scalar pressure{};
+        Scalar temperature{};
+        Scalar stabilityMargin{};
+        std::array<Scalar, numComponents> z{};
+        std::array<Scalar, numComponents> K{};
+        Counters counters{};
+    };
+
+    template <class Vector>
+    static void store_(Entry& entry,
+                       const Scalar pressure,
+                       const Scalar temperature,
+                       const Vector& z)
+    {
+        entry.valid = true;
+        entry.pressure = pressure;
+        entry.temperature = temperature;
+        std::copy_n(z.begin(), numComponents, entry.z.begin());
+    }
+
+    std::vector<Entry> entries_;
+    Thresholds thresholds_;
+};
+
+} // namespace Opm
+
+#endif // OPM_PTFLASH_STABILITY_CACHE_HPP
@@ -704,6 +704,16 @@ public:
         data_[dstart_() + varIdx] = derVal;
     }
 
+    // set the value and multiply all derivatives by a common factor, i.e.,
+    // apply the chain rule (f(x))' = f'(x)*x' to an evaluation of x
+    template <class RhsValueType>
+    OPM_HOST_DEVICE void setValueAndScaleDerivatives(const RhsValueType& val, const ValueType& factor)
+    {
+        setValue(val);
+        for (int i = dstart_(); i < dend_(); ++i)
+            data_[i] *= factor;
+    }
+
     template<class Serializer>
     OPM_HOST_DEVICE void serializeOp(Serializer& serializer)
     {
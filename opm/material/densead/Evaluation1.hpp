@@ -42,6 +42,7 @@
 
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/utility/gpuDecorators.hpp>
+#include <opm/material/densead/EvaluationSimd.hpp>
 
 namespace Opm {
 namespace DenseAd {
@@ -128,7 +129,14 @@ public:
     // set all derivatives to zero
     OPM_HOST_DEVICE constexpr void clearDerivatives()
     {
+#if OPM_DENSEAD_SIMD_ENABLED
+        // the padding is cleared as well, which establishes the invariant
+        // that it is zero
+        for (std::size_t i = dstart_(); i < data_.size(); ++i)
+            data_[i] = 0.0;
+#else
         data_[1] = 0.0;
+#endif
     }
 
     // create an uninitialized Evaluation object that is compatible with the
@@ -221,8 +229,13 @@ public:
     {
         assert(size() == other.size());
 
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::transform(data_, other.data_,
+                        [](const auto& a, const auto& b) { return a + b; });
+#else
         data_[0] += other.data_[0];
         data_[1] += other.data_[1];
+#endif
 
         return *this;
     }
@@ -242,8 +255,13 @@ public:
     {
         assert(size() == other.size());
 
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::transform(data_, other.data_,
+                        [](const auto& a, const auto& b) { return a - b; });
+#else
         data_[0] -= other.data_[0];
         data_[1] -= other.data_[1];
+#endif
 
         return *this;
     }
@@ -268,11 +286,19 @@ public:
         const ValueType u = this->value();
         const ValueType v = other.value();
 
+#if OPM_DENSEAD_SIMD_ENABLED
+        // value and derivatives in one pass: u*v + v*0 for the value and
+        // u'*v + v'*u for the derivatives
+        Simd::transformDerivatives(data_, other.data_, u,
+                                   [v](const auto& a, const auto& b, const auto& c)
+                                   { return a * v + b * c; });
+#else
         // value
         data_[valuepos_()] *= v ;
 
         //  derivatives
         data_[1] = data_[1] * v + other.data_[1] * u;
+#endif
 
         return *this;
     }
@@ -281,8 +307,12 @@ public:
     template <class RhsValueType>
     OPM_HOST_DEVICE Evaluation& operator*=(const RhsValueType& other)
     {
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::scale(data_, other);
+#else
         data_[0] *= other;
         data_[1] *= other;
+#endif
 
         return *this;
     }
@@ -294,10 +324,22 @@ public:
 
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
         // u'v)/v^2.
+#if OPM_DENSEAD_SIMD_ENABLED
+        const ValueType u = this->value();
+        const ValueType v = other.value();
+        const ValueType vv = v*v;
+
+        // value and derivatives in one pass: (v*u - 0*v)/v^2 for the value
+        // and (v*u' - u*v')/v^2 for the derivatives
+        Simd::transformDerivatives(data_, other.data_, u,
+                                   [v, vv](const auto& a, const auto& b, const auto& c)
+                                   { return (v*a - c*b)/vv; });
+#else
         ValueType& u = data_[valuepos_()];
         const ValueType& v = other.value();
         data_[1] = (v*data_[1] - u*other.data_[1])/(v*v);
         u /= v;
+#endif
 
         return *this;
     }
@@ -308,8 +350,12 @@ public:
     {
         const ValueType tmp = 1.0/other;
 
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::scale(data_, tmp);
+#else
         data_[0] *= tmp;
         data_[1] *= tmp;
+#endif
 
         return *this;
     }
@@ -366,8 +412,13 @@ public:
         Evaluation result;
 
         // set value and derivatives to negative
+#if OPM_DENSEAD_SIMD_ENABLED
+        result.data_ = data_;
+        Simd::transform(result.data_, [](const auto& a) { return -a; });
+#else
         result.data_[0] = - data_[0];
         result.data_[1] = - data_[1];
+#endif
 
         return result;
     }
@@ -518,6 +569,19 @@ public:
         data_[dstart_() + varIdx] = derVal;
     }
 
+    // set the value and multiply all derivatives by a common factor, i.e.,
+    // apply the chain rule (f(x))' = f'(x)*x' to an evaluation of x
+    template <class RhsValueType>
+    OPM_HOST_DEVICE void setValueAndScaleDerivatives(const RhsValueType& val, const ValueType& factor)
+    {
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::scaleDerivatives(data_, ValueType(val), factor);
+#else
+        data_[valuepos_()] = val;
+        data_[1] *= factor;
+#endif
+    }
+
     template<class Serializer>
     OPM_HOST_DEVICE void serializeOp(Serializer& serializer)
     {
@@ -525,7 +589,14 @@ public:
     }
 
 private:
+#if OPM_DENSEAD_SIMD_ENABLED
+    // value and derivatives, padded with zeros to a multiple of the SIMD
+    // width
+    alignas(Simd::alignment<ValueT>(2))
+    std::array<ValueT, Simd::paddedLength<ValueT>(2)> data_;
+#else
     std::array<ValueT, 2> data_;
+#endif
 };
 
 } // namespace DenseAd
@@ -42,6 +42,7 @@
 
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/utility/gpuDecorators.hpp>
+#include <opm/material/densead/EvaluationSimd.hpp>
 
 namespace Opm {
 namespace DenseAd {
@@ -128,6 +129,12 @@ public:
     // set all derivatives to zero
     OPM_HOST_DEVICE constexpr void clearDerivatives()
     {
+#if OPM_DENSEAD_SIMD_ENABLED
+        // the padding is cleared as well, which establishes the invariant
+        // that it is zero
+        for (std::size_t i = dstart_(); i < data_.size(); ++i)
+            data_[i] = 0.0;
+#else
         data_[1] = 0.0;
         data_[2] = 0.0;
         data_[3] = 0.0;
@@ -138,6 +145,7 @@ public:
         data_[8] = 0.0;
         data_[9] = 0.0;
         data_[10] = 0.0;
+#endif
     }
 
     // create an uninitialized Evaluation object that is compatible with the
@@ -239,6 +247,10 @@ public:
     {
         assert(size() == other.size());
 
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::transform(data_, other.data_,
+                        [](const auto& a, const auto& b) { return a + b; });
+#else
         data_[0] += other.data_[0];
         data_[1] += other.data_[1];
         data_[2] += other.data_[2];
@@ -250,6 +262,7 @@ public:
         data_[8] += other.data_[8];
         data_[9] += other.data_[9];
         data_[10] += other.data_[10];
+#endif
 
         return *this;
     }
@@ -269,6 +282,10 @@ public:
     {
         assert(size() == other.size());
 
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::transform(data_, other.data_,
+                        [](const auto& a, const auto& b) { return a - b; });
+#else
         data_[0] -= other.data_[0];
         data_[1] -= other.data_[1];
         data_[2] -= other.data_[2];
@@ -280,6 +297,7 @@ public:
         data_[8] -= other.data_[8];
         data_[9] -= other.data_[9];
         data_[10] -= other.data_[10];
+#endif
 
         return *this;
     }
@@ -304,6 +322,13 @@ public:
         const ValueType u = this->value();
         const ValueType v = other.value();
 
+#if OPM_DENSEAD_SIMD_ENABLED
+        // value and derivatives in one pass: u*v + v*0 for the value and
+        // u'*v + v'*u for the derivatives
+        Simd::transformDerivatives(data_, other.data_, u,
+                                   [v](const auto& a, const auto& b, const auto& c)
+                                   { return a * v + b * c; });
+#else
         // value
         data_[valuepos_()] *= v ;
 
@@ -318,6 +343,7 @@ public:
         data_[8] = data_[8] * v + other.data_[8] * u;
         data_[9] = data_[9] * v + other.data_[9] * u;
         data_[10] = data_[10] * v + other.data_[10] * u;
+#endif
 
         return *this;
     }
@@ -326,6 +352,9 @@ public:
     template <class RhsValueType>
     OPM_HOST_DEVICE Evaluation& operator*=(const RhsValueType& other)
     {
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::scale(data_, other);
+#else
         data_[0] *= other;
         data_[1] *= other;
         data_[2] *= other;
@@ -337,6 +366,7 @@ public:
         data_[8] *= other;
         data_[9] *= other;
         data_[10] *= other;
+#endif
 
         return *this;
     }
@@ -348,6 +378,17 @@ public:
 
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
         // u'v)/v^2.
+#if OPM_DENSEAD_SIMD_ENABLED
+        const ValueType u = this->value();
+        const ValueType v = other.value();
+        const ValueType vv = v*v;
+
+        // value and derivatives in one pass: (v*u - 0*v)/v^2 for the value
+        // and (v*u' - u*v')/v^2 for the derivatives
+        Simd::transformDerivatives(data_, other.data_, u,
+                                   [v, vv](const auto& a, const auto& b, const auto& c)
+                                   { return (v*a - c*b)/vv; });
+#else
         ValueType& u = data_[valuepos_()];
         const ValueType& v = other.value();
         data_[1] = (v*data_[1] - u*other.data_[1])/(v*v);
@@ -361,6 +402,7 @@ public:
         data_[9] = (v*data_[9] - u*other.data_[9])/(v*v);
         data_[10] = (v*data_[10] - u*other.data_[10])/(v*v);
         u /= v;
+#endif
 
         return *this;
     }
@@ -371,6 +413,9 @@ public:
     {
         const ValueType tmp = 1.0/other;
 
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::scale(data_, tmp);
+#else
         data_[0] *= tmp;
         data_[1] *= tmp;
         data_[2] *= tmp;
@@ -382,6 +427,7 @@ public:
         data_[8] *= tmp;
         data_[9] *= tmp;
         data_[10] *= tmp;
+#endif
 
         return *this;
     }
@@ -438,6 +484,10 @@ public:
         Evaluation result;
 
         // set value and derivatives to negative
+#if OPM_DENSEAD_SIMD_ENABLED
+        result.data_ = data_;
+        Simd::transform(result.data_, [](const auto& a) { return -a; });
+#else
         result.data_[0] = - data_[0];
         result.data_[1] = - data_[1];
         result.data_[2] = - data_[2];
@@ -449,6 +499,7 @@ public:
         result.data_[8] = - data_[8];
         result.data_[9] = - data_[9];
         result.data_[10] = - data_[10];
+#endif
 
         return result;
     }
@@ -599,6 +650,28 @@ public:
         data_[dstart_() + varIdx] = derVal;
     }
 
+    // set the value and multiply all derivatives by a common factor, i.e.,
+    // apply the chain rule (f(x))' = f'(x)*x' to an evaluation of x
+    template <class RhsValueType>
+    OPM_HOST_DEVICE void setValueAndScaleDerivatives(const RhsValueType& val, const ValueType& factor)
+    {
+#if OPM_DENSEAD_SIMD_ENABLED
+        Simd::scaleDerivatives(data_, ValueType(val), factor);
+#else
+        data_[valuepos_()] = val;
+        data_[1] *= factor;
+        data_[2] *= factor;
+        data_[3] *= factor;
+        data_[4] *= factor;
+        data_[5] *= factor;
+        data_[6] *= factor;
+        data_[7] *= factor;
+        data_[8] *= factor;
+        data_[9] *= factor;
+        data_[10] *= factor;
+#endif
+    }
+
     template<class Serializer>
     OPM_HOST_DEVICE void serializeOp(Serializer& serializer)
     {
@@ -606,7 +679,14 @@ public:
     }
 
 private:
+#if OPM_DENSEAD_SIMD_ENABLED
+    // value and derivatives, padded with zeros to a multiple of the SIMD
+    // width
+    alignas(Simd::alignment<ValueT>(11))
+    std::array<ValueT, Simd::paddedLength<ValueT>(11)> data_;
+#else
     std::array<ValueT, 11> data_;
+#endif
 };
 
 } // namespace DenseAd
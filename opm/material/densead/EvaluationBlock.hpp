@@ -0,0 +1,756 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Blocks of dense-AD evaluations which are processed together.
+ *
+ * An EvaluationBlock<ValueT, numDerivs, blockSize> represents blockSize
+ * independent Evaluation<ValueT, numDerivs> objects, e.g., of the same
+ * expression in blockSize cells.  It is the statically sized Evaluation
+ * whose value type is a ValueBlock, i.e., a fixed-size array of blockSize
+ * scalars with lane-wise arithmetic.  The values and the derivatives are
+ * therefore stored in derivative-major structure-of-arrays layout, and every
+ * operation on the block is a loop over the lanes of each derivative which
+ * the compiler can vectorize across cells.
+ *
+ * All arithmetic operators of Evaluation and the functions of the
+ * MathToolbox are available for blocks.  Functions with a value-dependent
+ * branch, like min(), max(), abs() and pow() with a zero base, select the
+ * result per lane.  Comparison operators are not available, because a block
+ * does not have a single truth value.  Code which branches on the value of
+ * an evaluation thus needs to be rewritten before it can be instantiated for
+ * blocks, while branch-free material and PVT relations can be used as is.
+ */
+#ifndef OPM_DENSEAD_EVALUATION_BLOCK_HPP
+#define OPM_DENSEAD_EVALUATION_BLOCK_HPP
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <opm/common/utility/gpuDecorators.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace Opm {
+namespace DenseAd {
+
+/*!
+ * \brief Fixed-size array of scalars with lane-wise arithmetic.
+ *
+ * This is the value type of the Evaluation objects which represent an
+ * EvaluationBlock.  Arithmetic scalars convert implicitly to a block of
+ * identical lanes.
+ */
+template <class ValueT, int blockSize>
+class ValueBlock
+{
+    static_assert(blockSize > 0, "Blocks must contain at least one lane");
+
+public:
+    typedef ValueT ValueType;
+
+    //! Create an uninitialized block
+    ValueBlock() = default;
+
+    //! Create a block of identical lanes
+    template <class Scalar, std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+    OPM_HOST_DEVICE constexpr ValueBlock(const Scalar value)
+    {
+        for (int lane = 0; lane < blockSize; ++lane) {
+            lanes_[lane] = value;
+        }
+    }
+
+    //! Create a block from the values of its lanes
+    OPM_HOST_DEVICE explicit constexpr ValueBlock(const std::array<ValueT, blockSize>& lanes)
+        : lanes_(lanes)
+    {}
+
+    //! Return the number of lanes
+    OPM_HOST_DEVICE static constexpr int size()
+    { return blockSize; }
+
+    OPM_HOST_DEVICE ValueT& operator[](const int lane)
+    { return lanes_[lane]; }
+
+    OPM_HOST_DEVICE const ValueT& operator[](const int lane) const
+    { return lanes_[lane]; }
+
+    OPM_HOST_DEVICE ValueBlock operator-() const
+    { return this->apply([](const ValueT& x) { return -x; }); }
+
+    OPM_HOST_DEVICE ValueBlock& operator+=(const ValueBlock& other)
+    { return this->update(other, [](ValueT& x, const ValueT& y) { x += y; }); }
+
+    OPM_HOST_DEVICE ValueBlock& operator-=(const ValueBlock& other)
+    { return this->update(other, [](ValueT& x, const ValueT& y) { x -= y; }); }
+
+    OPM_HOST_DEVICE ValueBlock& operator*=(const ValueBlock& other)
+    { return this->update(other, [](ValueT& x, const ValueT& y) { x *= y; }); }
+
+    OPM_HOST_DEVICE ValueBlock& operator/=(const ValueBlock& other)
+    { return this->update(other, [](ValueT& x, const ValueT& y) { x /= y; }); }
+
+    template <class Scalar, std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+    OPM_HOST_DEVICE ValueBlock& operator+=(const Scalar other)
+    { return *this += ValueBlock(other); }
+
+    template <class Scalar, std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+    OPM_HOST_DEVICE ValueBlock& operator-=(const Scalar other)
+    { return *this -= ValueBlock(other); }
+
+    template <class Scalar, std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+    OPM_HOST_DEVICE ValueBlock& operator*=(const Scalar other)
+    { return *this *= ValueBlock(other); }
+
+    template <class Scalar, std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+    OPM_HOST_DEVICE ValueBlock& operator/=(const Scalar other)
+    { return *this /= ValueBlock(other); }
+
+    //! Return the block of f(x) for all lanes x
+    template <class Function>
+    OPM_HOST_DEVICE ValueBlock apply(Function&& f) const
+    {
+        ValueBlock result;
+        for (int lane = 0; lane < blockSize; ++lane) {
+            result.lanes_[lane] = f(lanes_[lane]);
+        }
+
+        return result;
+    }
+
+    //! Return the block of f(x, y) for all pairs of lanes x and y
+    template <class Function>
+    OPM_HOST_DEVICE ValueBlock apply(const ValueBlock& other, Function&& f) const
+    {
+        ValueBlock result;
+        for (int lane = 0; lane < blockSize; ++lane) {
+            result.lanes_[lane] = f(lanes_[lane], other.lanes_[lane]);
+        }
+
+        return result;
+    }
+
+private:
+    template <class Function>
+    OPM_HOST_DEVICE ValueBlock& update(const ValueBlock& other, Function&& f)
+    {
+        for (int lane = 0; lane < blockSize; ++lane) {
+            f(lanes_[lane], other.lanes_[lane]);
+        }
+
+        return *this;
+    }
+
+    std::array<ValueT, blockSize> lanes_;
+};
+
+template <class ValueT, int blockSize>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator+(ValueBlock<ValueT, blockSize> a, const ValueBlock<ValueT, blockSize>& b)
+{ return a += b; }
+
+template <class ValueT, int blockSize>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator-(ValueBlock<ValueT, blockSize> a, const ValueBlock<ValueT, blockSize>& b)
+{ return a -= b; }
+
+template <class ValueT, int blockSize>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator*(ValueBlock<ValueT, blockSize> a, const ValueBlock<ValueT, blockSize>& b)
+{ return a *= b; }
+
+template <class ValueT, int blockSize>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator/(ValueBlock<ValueT, blockSize> a, const ValueBlock<ValueT, blockSize>& b)
+{ return a /= b; }
+
+template <class ValueT, int blockSize, class Scalar,
+          std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator+(ValueBlock<ValueT, blockSize> a, const Scalar b)
+{ return a += b; }
+
+template <class ValueT, int blockSize, class Scalar,
+          std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator-(ValueBlock<ValueT, blockSize> a, const Scalar b)
+{ return a -= b; }
+
+template <class ValueT, int blockSize, class Scalar,
+          std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator*(ValueBlock<ValueT, blockSize> a, const Scalar b)
+{ return a *= b; }
+
+template <class ValueT, int blockSize, class Scalar,
+          std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator/(ValueBlock<ValueT, blockSize> a, const Scalar b)
+{ return a /= b; }
+
+template <class Scalar, class ValueT, int blockSize,
+          std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator+(const Scalar a, const ValueBlock<ValueT, blockSize>& b)
+{ return ValueBlock<ValueT, blockSize>(a) += b; }
+
+template <class Scalar, class ValueT, int blockSize,
+          std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator-(const Scalar a, const ValueBlock<ValueT, blockSize>& b)
+{ return ValueBlock<ValueT, blockSize>(a) -= b; }
+
+template <class Scalar, class ValueT, int blockSize,
+          std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator*(const Scalar a, const ValueBlock<ValueT, blockSize>& b)
+{ return ValueBlock<ValueT, blockSize>(a) *= b; }
+
+template <class Scalar, class ValueT, int blockSize,
+          std::enable_if_t<std::is_arithmetic_v<Scalar>, int> = 0>
+OPM_HOST_DEVICE ValueBlock<ValueT, blockSize>
+operator/(const Scalar a, const ValueBlock<ValueT, blockSize>& b)
+{ return ValueBlock<ValueT, blockSize>(a) /= b; }
+
+/*!
+ * \brief blockSize evaluations of numDerivs derivatives in derivative-major
+ *        structure-of-arrays layout.
+ */
+template <class ValueT, int numDerivs, int blockSize>
+using EvaluationBlock = Evaluation<ValueBlock<ValueT, blockSize>, numDerivs>;
+
+/*!
+ * \brief Create a block from blockSize consecutive evaluations.
+ */
+template <int blockSize, class ValueT, int numDerivs>
+OPM_HOST_DEVICE EvaluationBlock<ValueT, numDerivs, blockSize>
+loadBlock(const Evaluation<ValueT, numDerivs>* evals)
+{
+    EvaluationBlock<ValueT, numDerivs, blockSize> block;
+
+    ValueBlock<ValueT, blockSize> row;
+    for (int lane = 0; lane < blockSize; ++lane) {
+        row[lane] = evals[lane].value();
+    }
+    block.setValue(row);
+
+    for (int varIdx = 0; varIdx < numDerivs; ++varIdx) {
+        for (int lane = 0; lane < blockSize; ++lane) {
+            row[lane] = evals[lane].derivative(varIdx);
+        }
+        block.setDerivative(varIdx, row);
+    }
+
+    return block;
+}
+
+/*!
+ * \brief Write the evaluations of a block to blockSize consecutive
+ *        evaluations.
+ */
+template <class ValueT, int numDerivs, int blockSize>
+OPM_HOST_DEVICE void storeBlock(const EvaluationBlock<ValueT, numDerivs, blockSize>& block,
+                                Evaluation<ValueT, numDerivs>* evals)
+{
+    for (int lane = 0; lane < blockSize; ++lane) {
+        evals[lane].setValue(block.value()[lane]);
+    }
+
+    for (int varIdx = 0; varIdx < numDerivs; ++varIdx) {
+        const auto& row = block.derivative(varIdx);
+        for (int lane = 0; lane < blockSize; ++lane) {
+            evals[lane].setDerivative(varIdx, row[lane]);
+        }
+    }
+}
+
+/*!
+ * \brief Return the evaluation of a single lane of a block.
+ */
+template <class ValueT, int numDerivs, int blockSize>
+OPM_HOST_DEVICE Evaluation<ValueT, numDerivs>
+extractLane(const EvaluationBlock<ValueT, numDerivs, blockSize>& block, const int lane)
+{
+    Evaluation<ValueT, numDerivs> result;
+
+    result.setValue(block.value()[lane]);
+    for (int varIdx = 0; varIdx < numDerivs; ++varIdx) {
+        result.setDerivative(varIdx, block.derivative(varIdx)[lane]);
+    }
+
+    return result;
+}
+
+namespace detail {
+
+// Return the lanes of a for which useA is true and the lanes of b otherwise.
+template <class ValueT, int numDerivs, int blockSize>
+OPM_HOST_DEVICE EvaluationBlock<ValueT, numDerivs, blockSize>
+selectLanes(const std::array<bool, static_cast<std::size_t>(blockSize)>& useA,
+            const EvaluationBlock<ValueT, numDerivs, blockSize>& a,
+            const EvaluationBlock<ValueT, numDerivs, blockSize>& b)
+{
+    const auto select = [&useA](const auto& x, const auto& y)
+    {
+        auto row = y;
+        for (int lane = 0; lane < blockSize; ++lane) {
+            if (useA[lane]) {
+                row[lane] = x[lane];
+            }
+        }
+
+        return row;
+    };
+
+    EvaluationBlock<ValueT, numDerivs, blockSize> result;
+    result.setValue(select(a.value(), b.value()));
+    for (int varIdx = 0; varIdx < numDerivs; ++varIdx) {
+        result.setDerivative(varIdx, select(a.derivative(varIdx), b.derivative(varIdx)));
+    }
+
+    return result;
+}
+
+// Lane-wise comparison of the values of two blocks.
+template <class ValueT, int blockSize, class Compare>
+OPM_HOST_DEVICE std::array<bool, blockSize>
+compareLanes(const ValueBlock<ValueT, blockSize>& a,
+             const ValueBlock<ValueT, blockSize>& b,
+             Compare&& compare)
+{
+    std::array<bool, blockSize> result;
+    for (int lane = 0; lane < blockSize; ++lane) {
+        result[lane] = compare(a[lane], b[lane]);
+    }
+
+    return result;
+}
+
+template <class ValueT, int numDerivs, int blockSize>
+OPM_HOST_DEVICE EvaluationBlock<ValueT, numDerivs, blockSize>
+chainRule(const EvaluationBlock<ValueT, numDerivs, blockSize>& x,
+          const ValueBlock<ValueT, blockSize>& f,
+          const ValueBlock<ValueT, blockSize>& df_dx)
+{
+    EvaluationBlock<ValueT, numDerivs, blockSize> result(x);
+    result.setValueAndScaleDerivatives(f, df_dx);
+
+    return result;
+}
+
+} // namespace detail
+
+} // namespace DenseAd
+
+/*!
+ * \brief Lane-wise mathematical functions of value blocks.
+ */
+template <class ValueT, int blockSize>
+struct MathToolbox<DenseAd::ValueBlock<ValueT, blockSize>>
+{
+    typedef DenseAd::ValueBlock<ValueT, blockSize> ValueType;
+    typedef MathToolbox<ValueT> InnerToolbox;
+    typedef typename InnerToolbox::Scalar Scalar;
+    typedef ValueType Evaluation;
+
+    OPM_HOST_DEVICE static Evaluation value(const Evaluation& x)
+    { return x; }
+
+    OPM_HOST_DEVICE static Evaluation createBlank(const Evaluation&)
+    { return Evaluation(); }
+
+    OPM_HOST_DEVICE static Evaluation createConstantZero(const Evaluation&)
+    { return Evaluation(0.0); }
+
+    OPM_HOST_DEVICE static Evaluation createConstantOne(const Evaluation&)
+    { return Evaluation(1.0); }
+
+    OPM_HOST_DEVICE static Evaluation createConstant(const Evaluation& value)
+    { return value; }
+
+    OPM_HOST_DEVICE static Evaluation createConstant(const Evaluation&, const Evaluation& value)
+    { return value; }
+
+    template <class LhsEval>
+    OPM_HOST_DEVICE static LhsEval decay(const Evaluation& x)
+    {
+        static_assert(std::is_same_v<LhsEval, Evaluation>,
+                      "Value blocks can only decay to themselves");
+        return x;
+    }
+
+    OPM_HOST_DEVICE static bool isSame(const Evaluation& a, const Evaluation& b, Scalar tolerance)
+    {
+        for (int lane = 0; lane < blockSize; ++lane) {
+            if (!InnerToolbox::isSame(a[lane], b[lane], tolerance)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    OPM_HOST_DEVICE static Evaluation max(const Evaluation& arg1, const Evaluation& arg2)
+    { return arg1.apply(arg2, [](const ValueT& x, const ValueT& y) { return InnerToolbox::max(x, y); }); }
+
+    OPM_HOST_DEVICE static Evaluation min(const Evaluation& arg1, const Evaluation& arg2)
+    { return arg1.apply(arg2, [](const ValueT& x, const ValueT& y) { return InnerToolbox::min(x, y); }); }
+
+    OPM_HOST_DEVICE static Evaluation abs(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::abs(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation tan(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::tan(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation atan(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::atan(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation atan2(const Evaluation& arg1, const Evaluation& arg2)
+    { return arg1.apply(arg2, [](const ValueT& x, const ValueT& y) { return InnerToolbox::atan2(x, y); }); }
+
+    OPM_HOST_DEVICE static Evaluation sin(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::sin(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation asin(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::asin(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation cos(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::cos(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation acos(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::acos(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation sqrt(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::sqrt(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation exp(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::exp(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation log(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::log(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation log10(const Evaluation& arg)
+    { return arg.apply([](const ValueT& x) { return InnerToolbox::log10(x); }); }
+
+    OPM_HOST_DEVICE static Evaluation pow(const Evaluation& base, const Evaluation& exp)
+    { return base.apply(exp, [](const ValueT& x, const ValueT& y) { return InnerToolbox::pow(x, y); }); }
+
+    OPM_HOST_DEVICE static bool isfinite(const Evaluation& arg)
+    {
+        for (int lane = 0; lane < blockSize; ++lane) {
+            if (!InnerToolbox::isfinite(arg[lane])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    OPM_HOST_DEVICE static bool isnan(const Evaluation& arg)
+    {
+        for (int lane = 0; lane < blockSize; ++lane) {
+            if (InnerToolbox::isnan(arg[lane])) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+/*!
+ * \brief Mathematical functions of evaluation blocks.
+ *
+ * This specialization takes precedence over the one for general Evaluation
+ * objects in Math.hpp, whose functions branch on the value of their
+ * arguments.
+ */
+template <class ValueT, int blockSize, int numVars>
+struct MathToolbox<DenseAd::Evaluation<DenseAd::ValueBlock<ValueT, blockSize>, numVars>>
+{
+    typedef DenseAd::ValueBlock<ValueT, blockSize> ValueType;
+    typedef MathToolbox<ValueType> InnerToolbox;
+    typedef typename InnerToolbox::Scalar Scalar;
+    typedef DenseAd::Evaluation<ValueType, numVars> Evaluation;
+
+    OPM_HOST_DEVICE static ValueType value(const Evaluation& eval)
+    { return eval.value(); }
+
+    OPM_HOST_DEVICE static Evaluation createBlank(const Evaluation& x)
+    { return Evaluation::createBlank(x); }
+
+    OPM_HOST_DEVICE static Evaluation createConstantZero(const Evaluation& x)
+    { return Evaluation::createConstantZero(x); }
+
+    OPM_HOST_DEVICE static Evaluation createConstantOne(const Evaluation& x)
+    { return Evaluation::createConstantOne(x); }
+
+    OPM_HOST_DEVICE static Evaluation createConstant(const ValueType& value)
+    { return Evaluation::createConstant(value); }
+
+    OPM_HOST_DEVICE static Evaluation createConstant(unsigned numDeriv, const ValueType& value)
+    { return Evaluation::createConstant(numDeriv, value); }
+
+    OPM_HOST_DEVICE static Evaluation createConstant(const Evaluation& x, const ValueType& value)
+    { return Evaluation::createConstant(x, value); }
+
+    OPM_HOST_DEVICE static Evaluation createVariable(const ValueType& value, int varIdx)
+    { return Evaluation::createVariable(value, varIdx); }
+
+    template <class LhsEval>
+    OPM_HOST_DEVICE static LhsEval decay(const Evaluation& eval)
+    {
+        static_assert(std::is_same_v<LhsEval, Evaluation> || std::is_same_v<LhsEval, ValueType>,
+                      "Evaluation blocks can only decay to themselves or to their value blocks");
+
+        if constexpr (std::is_same_v<LhsEval, Evaluation>) {
+            return eval;
+        }
+        else {
+            return eval.value();
+        }
+    }
+
+    // comparison
+    OPM_HOST_DEVICE static bool isSame(const Evaluation& a, const Evaluation& b, Scalar tolerance)
+    {
+        if (!InnerToolbox::isSame(a.value(), b.value(), tolerance))
+            return false;
+
+        for (int curVarIdx = 0; curVarIdx < numVars; ++curVarIdx)
+            if (!InnerToolbox::isSame(a.derivative(curVarIdx), b.derivative(curVarIdx), tolerance))
+                return false;
+
+        return true;
+    }
+
+    // arithmetic functions
+    template <class Arg1Eval, class Arg2Eval>
+    OPM_HOST_DEVICE static Evaluation max(const Arg1Eval& arg1, const Arg2Eval& arg2)
+    {
+        const auto& x1 = toBlock_(arg1);
+        const auto& x2 = toBlock_(arg2);
+        return DenseAd::detail::selectLanes(DenseAd::detail::compareLanes(x1.value(), x2.value(),
+                                                                          std::greater<ValueT>{}),
+                                            x1, x2);
+    }
+
+    template <class Arg1Eval, class Arg2Eval>
+    OPM_HOST_DEVICE static Evaluation min(const Arg1Eval& arg1, const Arg2Eval& arg2)
+    {
+        const auto& x1 = toBlock_(arg1);
+        const auto& x2 = toBlock_(arg2);
+        return DenseAd::detail::selectLanes(DenseAd::detail::compareLanes(x1.value(), x2.value(),
+                                                                          std::less<ValueT>{}),
+                                            x1, x2);
+    }
+
+    OPM_HOST_DEVICE static Evaluation abs(const Evaluation& arg)
+    {
+        return DenseAd::detail::selectLanes(DenseAd::detail::compareLanes(arg.value(), ValueType(0.0),
+                                                                          std::greater<ValueT>{}),
+                                            arg, -arg);
+    }
+
+    OPM_HOST_DEVICE static Evaluation tan(const Evaluation& arg)
+    {
+        const ValueType f = InnerToolbox::tan(arg.value());
+        return DenseAd::detail::chainRule(arg, f, 1.0 + f*f);
+    }
+
+    OPM_HOST_DEVICE static Evaluation atan(const Evaluation& arg)
+    {
+        const ValueType& x = arg.value();
+        return DenseAd::detail::chainRule(arg, InnerToolbox::atan(x), 1.0/(1.0 + x*x));
+    }
+
+    OPM_HOST_DEVICE static Evaluation atan2(const Evaluation& arg1, const Evaluation& arg2)
+    {
+        // d/dv atan2(x, y) = (x' y - x y') / (x^2 + y^2)
+        const ValueType& x = arg1.value();
+        const ValueType& y = arg2.value();
+        const ValueType denom = x*x + y*y;
+
+        Evaluation result = arg1*(y/denom) - arg2*(x/denom);
+        result.setValue(InnerToolbox::atan2(x, y));
+
+        return result;
+    }
+
+    template <class Eval2>
+    OPM_HOST_DEVICE static Evaluation atan2(const Evaluation& arg1, const Eval2& arg2)
+    { return atan2(arg1, toBlock_(arg2)); }
+
+    template <class Eval1>
+    OPM_HOST_DEVICE static Evaluation atan2(const Eval1& arg1, const Evaluation& arg2)
+    { return atan2(toBlock_(arg1), arg2); }
+
+    OPM_HOST_DEVICE static Evaluation sin(const Evaluation& arg)
+    {
+        const ValueType& x = arg.value();
+        return DenseAd::detail::chainRule(arg, InnerToolbox::sin(x), InnerToolbox::cos(x));
+    }
+
+    OPM_HOST_DEVICE static Evaluation asin(const Evaluation& arg)
+    {
+        const ValueType& x = arg.value();
+        return DenseAd::detail::chainRule(arg, InnerToolbox::asin(x),
+                                          1.0/InnerToolbox::sqrt(1.0 - x*x));
+    }
+
+    OPM_HOST_DEVICE static Evaluation cos(const Evaluation& arg)
+    {
+        const ValueType& x = arg.value();
+        return DenseAd::detail::chainRule(arg, InnerToolbox::cos(x), -InnerToolbox::sin(x));
+    }
+
+    OPM_HOST_DEVICE static Evaluation acos(const Evaluation& arg)
+    {
+        const ValueType& x = arg.value();
+        return DenseAd::detail::chainRule(arg, InnerToolbox::acos(x),
+                                          -1.0/InnerToolbox::sqrt(1.0 - x*x));
+    }
+
+    OPM_HOST_DEVICE static Evaluation sqrt(const Evaluation& arg)
+    {
+        const ValueType f = InnerToolbox::sqrt(arg.value());
+        return DenseAd::detail::chainRule(arg, f, 0.5/f);
+    }
+
+    OPM_HOST_DEVICE static Evaluation exp(const Evaluation& arg)
+    {
+        const ValueType f = InnerToolbox::exp(arg.value());
+        return DenseAd::detail::chainRule(arg, f, f);
+    }
+
+    OPM_HOST_DEVICE static Evaluation log(const Evaluation& arg)
+    {
+        const ValueType& x = arg.value();
+        return DenseAd::detail::chainRule(arg, InnerToolbox::log(x), 1.0/x);
+    }
+
+    OPM_HOST_DEVICE static Evaluation log10(const Evaluation& arg)
+    {
+        const ValueType& x = arg.value();
+        return DenseAd::detail::chainRule(arg, InnerToolbox::log10(x),
+                                          1.0/(x*std::log(ValueT{10})));
+    }
+
+    // the special cases of a zero base are treated per lane in the same way
+    // as for single evaluations, i.e., the result is zero.
+    template <class RhsValueType>
+    OPM_HOST_DEVICE static Evaluation pow(const Evaluation& base, const RhsValueType& exp)
+    {
+        const ValueType& x = base.value();
+        const ValueType e(exp);
+
+        ValueType f, df_dx;
+        for (int lane = 0; lane < blockSize; ++lane) {
+            const bool zero = (x[lane] == 0.0);
+            f[lane] = zero ? ValueT{0} : MathToolbox<ValueT>::pow(x[lane], e[lane]);
+            df_dx[lane] = zero ? ValueT{0} : f[lane]/x[lane]*e[lane];
+        }
+
+        return DenseAd::detail::chainRule(base, f, df_dx);
+    }
+
+    template <class RhsValueType>
+    OPM_HOST_DEVICE static Evaluation pow(const RhsValueType& base, const Evaluation& exp)
+    {
+        const ValueType b(base);
+
+        ValueType f, df_dx;
+        for (int lane = 0; lane < blockSize; ++lane) {
+            const bool zero = (b[lane] == 0.0);
+            const ValueT lnBase = zero ? ValueT{0} : MathToolbox<ValueT>::log(b[lane]);
+            f[lane] = zero ? ValueT{0} : MathToolbox<ValueT>::exp(lnBase*exp.value()[lane]);
+            df_dx[lane] = lnBase*f[lane];
+        }
+
+        return DenseAd::detail::chainRule(exp, f, df_dx);
+    }
+
+    OPM_HOST_DEVICE static Evaluation pow(const Evaluation& base, const Evaluation& exp)
+    {
+        // (f^g)' = (g/f*f' + log(f)*g')*f^g for all lanes with a non-zero
+        // base, which also gives the zero result for the other lanes
+        ValueType valuePow, gOverF, logF;
+        for (int lane = 0; lane < blockSize; ++lane) {
+            const ValueT f = base.value()[lane];
+            const ValueT g = exp.value()[lane];
+            const bool zero = (f == 0.0);
+
+            valuePow[lane] = zero ? ValueT{0} : MathToolbox<ValueT>::pow(f, g);
+            gOverF[lane] = zero ? ValueT{0} : g/f;
+            logF[lane] = zero ? ValueT{0} : MathToolbox<ValueT>::log(f);
+        }
+
+        Evaluation result = base*gOverF + exp*logF;
+        result.setValueAndScaleDerivatives(valuePow, valuePow);
+
+        return result;
+    }
+
+    OPM_HOST_DEVICE static bool isfinite(const Evaluation& arg)
+    {
+        if (!InnerToolbox::isfinite(arg.value()))
+            return false;
+
+        for (int i = 0; i < numVars; ++i)
+            if (!InnerToolbox::isfinite(arg.derivative(i)))
+                return false;
+
+        return true;
+    }
+
+    OPM_HOST_DEVICE static bool isnan(const Evaluation& arg)
+    {
+        if (InnerToolbox::isnan(arg.value()))
+            return true;
+
+        for (int i = 0; i < numVars; ++i)
+            if (InnerToolbox::isnan(arg.derivative(i)))
+                return true;
+
+        return false;
+    }
+
+private:
+    OPM_HOST_DEVICE static const Evaluation& toBlock_(const Evaluation& x)
+    { return x; }
+
+    template <class Arg>
+    OPM_HOST_DEVICE static Evaluation toBlock_(const Arg& x)
+    { return Evaluation(ValueType(x)); }
+};
+
+} // namespace Opm
+
+#endif // OPM_DENSEAD_EVALUATION_BLOCK_HPP
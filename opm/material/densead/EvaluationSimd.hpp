@@ -0,0 +1,344 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Storage layout and lane-wise kernels for the SIMD-padded variant of
+ *        the statically sized dense-AD Evaluation specializations.
+ *
+ * The variant is selected by defining OPM_DENSEAD_SIMD to a non-zero value
+ * (CMake option OPM_DENSEAD_SIMD).  The value and the derivatives are then
+ * stored in an array whose length is a multiple of the SIMD register width
+ * and whose padding elements are always zero, so that the arithmetic
+ * operators can process all derivatives with full-width vector instructions
+ * and no remainder loop.  The kernels use std::experimental::simd if the
+ * standard library provides it, and plain loops, which the compiler may
+ * vectorize, otherwise.
+ */
+#ifndef OPM_DENSEAD_EVALUATION_SIMD_HPP
+#define OPM_DENSEAD_EVALUATION_SIMD_HPP
+
+#include <opm/common/utility/gpuDecorators.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if OPM_DENSEAD_SIMD && !defined(__CUDACC__) && !defined(__HIPCC__)
+#define OPM_DENSEAD_SIMD_ENABLED 1
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#endif
+#if defined(__cpp_lib_experimental_parallel_simd)
+#define OPM_DENSEAD_HAVE_STD_SIMD 1
+#endif
+#endif
+
+namespace Opm::DenseAd::Simd {
+
+/*!
+ * \brief Number of ValueT elements in a vector register, or one if ValueT is
+ *        not a SIMD-capable type or the padded variant is disabled.
+ *
+ * The register width is capped at 256 bits even on AVX-512 hardware.
+ * 512-bit packs were measured to be slower for evaluations of three, four
+ * and six derivatives, both because of the additional padding and because
+ * the compiler copies evaluations in 256-bit chunks.
+ */
+template <class ValueT>
+constexpr std::size_t registerWidth()
+{
+#if OPM_DENSEAD_SIMD_ENABLED
+    if constexpr (std::is_same_v<ValueT, double> || std::is_same_v<ValueT, float>) {
+#if defined(__AVX__)
+        return 32 / sizeof(ValueT);
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+        return 16 / sizeof(ValueT);
+#endif
+    }
+#endif
+
+    return 1;
+}
+
+/*!
+ * \brief Number of elements processed per vector instruction for an array of
+ *        given length.
+ *
+ * Short arrays use a narrower register than the widest available one, e.g.,
+ * 128 bits for two doubles, to avoid needless padding.
+ */
+template <class ValueT>
+constexpr std::size_t packWidth(const std::size_t length)
+{
+    return std::min(registerWidth<ValueT>(), std::bit_ceil(length));
+}
+
+/*!
+ * \brief Length of the storage array of an evaluation of given unpadded
+ *        length, i.e., one plus the number of derivatives.
+ */
+template <class ValueT>
+constexpr std::size_t paddedLength(const std::size_t length)
+{
+    const auto lanes = packWidth<ValueT>(length);
+    return ((length + lanes - 1) / lanes) * lanes;
+}
+
+/*!
+ * \brief Alignment of the storage array of an evaluation of given unpadded
+ *        length.
+ */
+template <class ValueT>
+constexpr std::size_t alignment(const std::size_t length)
+{
+    return std::max(alignof(ValueT), packWidth<ValueT>(length) * sizeof(ValueT));
+}
+
+#if OPM_DENSEAD_HAVE_STD_SIMD
+namespace detail {
+
+template <class ValueT, std::size_t N>
+using Pack = std::experimental::simd<ValueT,
+                                     std::experimental::simd_abi::deduce_t<ValueT, packWidth<ValueT>(N)>>;
+
+template <class F, std::size_t... PackIdx>
+inline void forEachPack(F&& f, std::index_sequence<PackIdx...>)
+{
+    (f(std::integral_constant<std::size_t, PackIdx>{}), ...);
+}
+
+// Invoke f(std::integral_constant<std::size_t, offset>{}) for the offsets
+// of all packs of a padded array.  The calls are unrolled at compile time,
+// which the compiler does not do for a loop at -O2.
+template <class ValueT, std::size_t N, class F>
+inline void forEachPack(F&& f)
+{
+    constexpr auto lanes = packWidth<ValueT>(N);
+    static_assert(N % lanes == 0, "Array must be padded to the pack width");
+
+    forEachPack([&f](const auto packIdx) {
+                    f(std::integral_constant<std::size_t, packIdx*lanes>{});
+                },
+                std::make_index_sequence<N / lanes>{});
+}
+
+} // namespace detail
+#endif
+
+/*!
+ * \brief Apply a lane-wise operation to all elements of a padded array.
+ *
+ * \param a In-out array.  Receives op(a[i]) for all i.
+ *
+ * \param op Operation.  Must accept both single elements and
+ *        std::experimental::simd packs of elements.
+ */
+template <class ValueT, std::size_t N, class Op>
+OPM_HOST_DEVICE inline void transform(std::array<ValueT, N>& a, Op&& op)
+{
+#if OPM_DENSEAD_HAVE_STD_SIMD
+    if constexpr (packWidth<ValueT>(N) > 1) {
+        using Pack = detail::Pack<ValueT, N>;
+        namespace stdx = std::experimental;
+
+        detail::forEachPack<ValueT, N>([&a, &op](const auto i) {
+            const Pack x(a.data() + i, stdx::element_aligned);
+            op(x).copy_to(a.data() + i, stdx::element_aligned);
+        });
+
+        return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < N; ++i) {
+        a[i] = op(a[i]);
+    }
+}
+
+/*!
+ * \brief Apply a lane-wise binary operation to all elements of two padded
+ *        arrays.
+ *
+ * \param a In-out array.  Receives op(a[i], b[i]) for all i.
+ *
+ * \param b Second operand.
+ *
+ * \param op Operation.  Must accept both single elements and
+ *        std::experimental::simd packs of elements.
+ */
+template <class ValueT, std::size_t N, class Op>
+OPM_HOST_DEVICE inline void transform(std::array<ValueT, N>& a,
+                                      const std::array<ValueT, N>& b,
+                                      Op&& op)
+{
+#if OPM_DENSEAD_HAVE_STD_SIMD
+    if constexpr (packWidth<ValueT>(N) > 1) {
+        using Pack = detail::Pack<ValueT, N>;
+        namespace stdx = std::experimental;
+
+        detail::forEachPack<ValueT, N>([&a, &b, &op](const auto i) {
+            const Pack x(a.data() + i, stdx::element_aligned);
+            const Pack y(b.data() + i, stdx::element_aligned);
+            op(x, y).copy_to(a.data() + i, stdx::element_aligned);
+        });
+
+        return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < N; ++i) {
+        a[i] = op(a[i], b[i]);
+    }
+}
+
+/*!
+ * \brief Apply a lane-wise binary operation with an additional coefficient
+ *        which vanishes for the value element.
+ *
+ * This allows computing the value and the derivatives of a product or a
+ * quotient in a single pass.  Overwriting the value element separately
+ * after a full-width store stalls the next full-width load of the array on
+ * most current processors.
+ *
+ * \param a In-out array.  Receives op(a[i], b[i], c[i]) for all i, where
+ *        c[0] is zero and c[i] equals the coefficient for all i > 0.
+ *
+ * \param b Second operand.
+ *
+ * \param coeff Coefficient of the derivative elements.
+ *
+ * \param op Operation.  Must accept both single elements and
+ *        std::experimental::simd packs of elements.
+ */
+template <class ValueT, std::size_t N, class Op>
+OPM_HOST_DEVICE inline void transformDerivatives(std::array<ValueT, N>& a,
+                                                 const std::array<ValueT, N>& b,
+                                                 const ValueT coeff,
+                                                 Op&& op)
+{
+#if OPM_DENSEAD_HAVE_STD_SIMD
+    if constexpr (packWidth<ValueT>(N) > 1) {
+        using Pack = detail::Pack<ValueT, N>;
+        namespace stdx = std::experimental;
+
+        detail::forEachPack<ValueT, N>([&a, &b, &op, coeff](const auto i) {
+            const Pack x(a.data() + i, stdx::element_aligned);
+            const Pack y(b.data() + i, stdx::element_aligned);
+            if constexpr (i == 0) {
+                const Pack c([coeff](const auto lane)
+                             { return (lane == 0) ? ValueT{0} : coeff; });
+                op(x, y, c).copy_to(a.data() + i, stdx::element_aligned);
+            }
+            else {
+                op(x, y, Pack(coeff)).copy_to(a.data() + i, stdx::element_aligned);
+            }
+        });
+
+        return;
+    }
+#endif
+
+    a[0] = op(a[0], b[0], ValueT{0});
+    for (std::size_t i = 1; i < N; ++i) {
+        a[i] = op(a[i], b[i], coeff);
+    }
+}
+
+/*!
+ * \brief Overwrite the first element of a padded array and multiply all
+ *        other elements by a common factor.
+ *
+ * \param a In-out array.
+ *
+ * \param first New value of the first element.
+ *
+ * \param factor Factor of all other elements.
+ */
+template <class ValueT, std::size_t N>
+OPM_HOST_DEVICE inline void scaleDerivatives(std::array<ValueT, N>& a,
+                                             const ValueT first,
+                                             const ValueT factor)
+{
+#if OPM_DENSEAD_HAVE_STD_SIMD
+    if constexpr (packWidth<ValueT>(N) > 1) {
+        using Pack = detail::Pack<ValueT, N>;
+        namespace stdx = std::experimental;
+
+        detail::forEachPack<ValueT, N>([&a, first, factor](const auto i) {
+            const Pack x(a.data() + i, stdx::element_aligned);
+            if constexpr (i == 0) {
+                // x*c + d with c = (0, factor, ...) and d = (first, 0, ...),
+                // which does not need a separate scalar store.
+                const Pack c([factor](const auto lane)
+                             { return (lane == 0) ? ValueT{0} : factor; });
+                const Pack d([first](const auto lane)
+                             { return (lane == 0) ? first : ValueT{0}; });
+                (x*c + d).copy_to(a.data() + i, stdx::element_aligned);
+            }
+            else {
+                (x*factor).copy_to(a.data() + i, stdx::element_aligned);
+            }
+        });
+
+        return;
+    }
+#endif
+
+    a[0] = first;
+    for (std::size_t i = 1; i < N; ++i) {
+        a[i] *= factor;
+    }
+}
+
+/*!
+ * \brief Multiply all elements of a padded array by a common factor.
+ *
+ * \param a In-out array.
+ *
+ * \param factor Factor.  Converted to ValueT if the array is processed in
+ *        packs.
+ */
+template <class ValueT, std::size_t N, class Factor>
+OPM_HOST_DEVICE inline void scale(std::array<ValueT, N>& a, const Factor& factor)
+{
+#if OPM_DENSEAD_HAVE_STD_SIMD
+    if constexpr (packWidth<ValueT>(N) > 1) {
+        const ValueT f = factor;
+        transform(a, [f](const auto& x) { return x*f; });
+
+        return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < N; ++i) {
+        a[i] *= factor;
+    }
+}
+
+} // namespace Opm::DenseAd::Simd
+
+#endif // OPM_DENSEAD_EVALUATION_SIMD_HPP
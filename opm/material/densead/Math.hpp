@@ -33,6 +33,7 @@
 #define OPM_LOCAL_AD_MATH_HPP
 
 #include "Evaluation.hpp"
+#include "EvaluationSimd.hpp"
 
 #include <opm/material/common/MathToolbox.hpp>
 
@@ -43,6 +44,26 @@ namespace DenseAd {
 template <class ValueT, int numVars, unsigned staticSize>
 class Evaluation;
 
+namespace detail {
+
+// Apply the chain rule for a function of a single evaluation in
+// derivative-parallel form, i.e., set the value and scale all derivatives of
+// x in one operation.  This lets the SIMD-padded Evaluation specializations
+// process all derivatives with vector instructions.
+template <class ValueType, int numVars, unsigned staticSize>
+OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize>
+chainRule(const Evaluation<ValueType, numVars, staticSize>& x,
+          const ValueType& f,
+          const ValueType& df_dx)
+{
+    Evaluation<ValueType, numVars, staticSize> result(x);
+    result.setValueAndScaleDerivatives(f, df_dx);
+
+    return result;
+}
+
+} // namespace detail
+
 // provide some algebraic functions
 template <class ValueType, int numVars, unsigned staticSize>
 OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> abs(const Evaluation<ValueType, numVars, staticSize>& x)
@@ -333,35 +354,25 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> sqrt(const Evaluation
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
     const ValueType& sqrt_x = ValueTypeToolbox::sqrt(x.value());
-    result.setValue(sqrt_x);
 
     // derivatives use the chain rule
     ValueType df_dx = 0.5/sqrt_x;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx) {
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-    }
 
-    return result;
+    return detail::chainRule(x, sqrt_x, df_dx);
 }
 
 template <class ValueType, int numVars, unsigned staticSize>
 OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> exp(const Evaluation<ValueType, numVars, staticSize>& x)
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
-    Evaluation<ValueType, numVars, staticSize> result(x);
 
     const ValueType& exp_x = ValueTypeToolbox::exp(x.value());
-    result.setValue(exp_x);
 
     // derivatives use the chain rule
     const ValueType& df_dx = exp_x;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
 
-    return result;
+    return detail::chainRule(x, exp_x, df_dx);
 }
 
 // exponentiation of arbitrary base with a fixed constant
@@ -370,24 +381,21 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const Evaluation<
                                                const ExpType& exp)
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
-    Evaluation<ValueType, numVars, staticSize> result(base);
-
-    const ValueType& pow_x = ValueTypeToolbox::pow(base.value(), exp);
-    result.setValue(pow_x);
 
     if (base == 0.0) {
         // we special case the base 0 case because 0.0 is in the valid range of the
         // base but the generic code leads to NaNs.
+        Evaluation<ValueType, numVars, staticSize> result(base);
         result = 0.0;
-    }
-    else {
-        // derivatives use the chain rule
-        const ValueType& df_dx = pow_x/base.value()*exp;
-        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-            result.setDerivative(curVarIdx, df_dx*base.derivative(curVarIdx));
+        return result;
     }
 
-    return result;
+    const ValueType& pow_x = ValueTypeToolbox::pow(base.value(), exp);
+
+    // derivatives use the chain rule
+    const ValueType& df_dx = pow_x/base.value()*exp;
+
+    return detail::chainRule(base, pow_x, df_dx);
 }
 
 // exponentiation of constant base with an arbitrary exponent
@@ -397,24 +405,21 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const BaseType& b
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(exp);
-
     if (base == 0.0) {
         // we special case the base 0 case because 0.0 is in the valid range of the
         // base but the generic code leads to NaNs.
+        Evaluation<ValueType, numVars, staticSize> result(exp);
         result = 0.0;
+        return result;
     }
-    else {
-        const ValueType& lnBase = ValueTypeToolbox::log(base);
-        result.setValue(ValueTypeToolbox::exp(lnBase*exp.value()));
 
-        // derivatives use the chain rule
-        const ValueType& df_dx = lnBase*result.value();
-        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-            result.setDerivative(curVarIdx, df_dx*exp.derivative(curVarIdx));
-    }
+    const ValueType& lnBase = ValueTypeToolbox::log(base);
+    const ValueType& pow_x = ValueTypeToolbox::exp(lnBase*exp.value());
 
-    return result;
+    // derivatives use the chain rule
+    const ValueType& df_dx = lnBase*pow_x;
+
+    return detail::chainRule(exp, pow_x, df_dx);
 }
 
 // this is the most expensive power function. Computationally it is pretty expensive, so
@@ -434,18 +439,29 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const Evaluation<
     }
     else {
         ValueType valuePow = ValueTypeToolbox::pow(base.value(), exp.value());
-        result.setValue(valuePow);
 
         // use the chain rule for the derivatives. since both, the base and the exponent can
         // potentially depend on the variable set, calculating these is quite elaborate...
         const ValueType& f = base.value();
         const ValueType& g = exp.value();
         const ValueType& logF = ValueTypeToolbox::log(f);
+#if OPM_DENSEAD_SIMD_ENABLED
+        // the derivatives are (g/f*f' + log(f)*g')*f^g, which is evaluated for all
+        // derivatives at once. the rounding differs slightly from the scalar loop below.
+        Evaluation<ValueType, numVars, staticSize> expTerm(exp);
+        expTerm *= logF;
+
+        result *= g/f;
+        result += expTerm;
+        result.setValueAndScaleDerivatives(valuePow, valuePow);
+#else
+        result.setValue(valuePow);
         for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx) {
             const ValueType& fPrime = base.derivative(curVarIdx);
             const ValueType& gPrime = exp.derivative(curVarIdx);
             result.setDerivative(curVarIdx, (g*fPrime/f + logF*gPrime) * valuePow);
         }
+#endif
     }
 
     return result;
@@ -456,16 +472,10 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> log(const Evaluation<
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::log(x.value()));
-
     // derivatives use the chain rule
     const ValueType& df_dx = 1/x.value();
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
 
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::log(x.value()), df_dx);
 }
 
 
@@ -474,16 +484,10 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> log10(const Evaluatio
 {
     typedef MathToolbox<ValueType> ValueTypeToolbox;
 
-    Evaluation<ValueType, numVars, staticSize> result(x);
-
-    result.setValue(ValueTypeToolbox::log10(x.value()));
-
     // derivatives use the chain rule
     const ValueType& df_dx = 1/x.value() * ValueTypeToolbox::log10(ValueTypeToolbox::exp(1.0));
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
 
-    return result;
+    return detail::chainRule(x, ValueTypeToolbox::log10(x.value()), df_dx);
 }
 
 } // namespace DenseAd
@@ -25,6 +25,8 @@
 #include <opm/material/fluidmatrixinteractions/EclEpsGridProperties.hpp>
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
 
+#include <utility>
+
 namespace Opm::EclMaterialLaw {
 
 /* constructors*/
@@ -35,15 +37,32 @@ HystParams(typename Manager<Traits>::Params& params,
            const EclEpsGridProperties* epsImbGridProperties,
            const EclipseState& eclState,
            const Manager<Traits>& parent)
-    : params_(params)
+    : HystParams(params, epsGridProperties, epsImbGridProperties, eclState, parent,
+                 std::make_shared<GasOilHystParams>(),
+                 std::make_shared<OilWaterHystParams>(),
+                 std::make_shared<GasWaterHystParams>())
+{
+}
+
+template <class Traits>
+HystParams<Traits>::
+HystParams(typename Manager<Traits>::Params& params,
+           const EclEpsGridProperties& epsGridProperties,
+           const EclEpsGridProperties* epsImbGridProperties,
+           const EclipseState& eclState,
+           const Manager<Traits>& parent,
+           std::shared_ptr<GasOilHystParams> gasOilParams,
+           std::shared_ptr<OilWaterHystParams> oilWaterParams,
+           std::shared_ptr<GasWaterHystParams> gasWaterParams)
+    : gasOilParams_(std::move(gasOilParams))
+    , oilWaterParams_(std::move(oilWaterParams))
+    , gasWaterParams_(std::move(gasWaterParams))
+    , params_(params)
     , epsGridProperties_(epsGridProperties)
     , epsImbGridProperties_(epsImbGridProperties)
     , eclState_(eclState)
     , parent_(parent)
 {
-    gasOilParams_ = std::make_shared<GasOilHystParams>();
-    oilWaterParams_ = std::make_shared<OilWaterHystParams>();
-    gasWaterParams_ = std::make_shared<GasWaterHystParams>();
 }
 
 /* public methods, alphabetically sorted */
@@ -58,6 +58,17 @@ public:
                const EclipseState& eclState,
                const Manager<Traits>& parent);
 
+    // Use caller provided objects for the two-phase parameters, e.g., slots
+    // of a contiguous per-cell array, rather than allocating new ones.
+    HystParams(typename Manager<Traits>::Params& params,
+               const EclEpsGridProperties& epsGridProperties,
+               const EclEpsGridProperties* epsImbGridProperties,
+               const EclipseState& eclState,
+               const Manager<Traits>& parent,
+               std::shared_ptr<GasOilHystParams> gasOilParams,
+               std::shared_ptr<OilWaterHystParams> oilWaterParams,
+               std::shared_ptr<GasWaterHystParams> gasWaterParams);
+
     void finalize();
 
     std::shared_ptr<GasOilHystParams> getGasOilParams()
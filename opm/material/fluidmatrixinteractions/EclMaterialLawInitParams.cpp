@@ -30,7 +30,12 @@
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawReadEffectiveParams.hpp>
 #include <opm/material/fluidmatrixinteractions/EclMultiplexerMaterialParams.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace {
 
@@ -42,6 +47,43 @@ unsigned satOrImbRegion(const std::vector<int>& array,
     return static_cast<unsigned>(value);
 }
 
+/// Contiguous storage of per-cell parameter objects.
+///
+/// The objects are allocated in blocks of consecutive cells rather than one
+/// heap allocation per cell.  The pointers returned by at() share ownership
+/// of their entire block, so the storage object need not outlive them.
+/// Using several blocks rather than a single array also means that threads
+/// working on different ranges of cells update different reference counts.
+template <class T>
+class CellBlockStorage
+{
+public:
+    explicit CellBlockStorage(const std::size_t numCells)
+        : blocks_((numCells + blockSize - 1) / blockSize)
+    {
+        const auto numBlocks = static_cast<std::int64_t>(blocks_.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (std::int64_t block = 0; block < numBlocks; ++block) {
+            const auto begin = block * blockSize;
+            blocks_[block] = std::make_shared<T[]>(std::min(blockSize, numCells - begin));
+        }
+    }
+
+    std::shared_ptr<T> at(const std::size_t cell) const
+    {
+        const auto& block = blocks_[cell / blockSize];
+        return { block, block.get() + cell % blockSize };
+    }
+
+private:
+    static constexpr std::size_t blockSize = 4096;
+
+    std::vector<std::shared_ptr<T[]>> blocks_;
+};
+
 } // anonymous namespace
 
 namespace Opm::EclMaterialLaw {
@@ -86,6 +128,15 @@ run(const IntLookupFunction& fieldPropIntOnLeafAssigner,
     initArrays_(satnumArray, imbnumArray, mlpArray);
     const auto num_arrays = mlpArray.size();
     for (unsigned i = 0; i < num_arrays; i++) {
+        // The two-phase parameters of all cells are kept in contiguous
+        // arrays instead of being allocated individually.
+        const CellBlockStorage<typename HystParams<Traits>::GasOilHystParams>
+            gasOilStorage{this->numCompressedElems_};
+        const CellBlockStorage<typename HystParams<Traits>::OilWaterHystParams>
+            oilWaterStorage{this->numCompressedElems_};
+        const CellBlockStorage<typename HystParams<Traits>::GasWaterHystParams>
+            gasWaterStorage{this->numCompressedElems_};
+
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
@@ -97,7 +148,10 @@ run(const IntLookupFunction& fieldPropIntOnLeafAssigner,
                 epsGridProperties_,
                 epsImbGridProperties_.get(),
                 this->eclState_,
-                this->parent_
+                this->parent_,
+                gasOilStorage.at(elemIdx),
+                oilWaterStorage.at(elemIdx),
+                gasWaterStorage.at(elemIdx)
             };
 
             hystParams.setConfig(satRegionIdx);
@@ -33,8 +33,8 @@
 #include "EclTwoPhaseMaterial.hpp"
 
 #include <cassert>
-#include <memory>
 #include <type_traits>
+#include <variant>
 
 #include <opm/material/common/EnsureFinalized.hpp>
 
@@ -68,7 +68,9 @@ constexpr bool FrontIsEclMultiplexerDispatchV = FrontIsEclMultiplexerDispatch<Ar
  *        multiplexed three-phase material law.
  *
  * Essentially, this class just stores parameter object for the "nested" material law and
- * provides some methods to convert to it.
+ * provides some methods to convert to it.  The nested parameter object is stored in
+ * place, so that a vector of multiplexer parameters does not need one heap allocation
+ * per element and accessing the nested parameters does not need an indirection.
  */
 template<class Traits, class GasOilMaterialLawT, class OilWaterMaterialLawT, class GasWaterMaterialLawT>
 class EclMultiplexerMaterialParams : public Traits, public EnsureFinalized
@@ -86,16 +88,12 @@ class EclMultiplexerMaterialParams : public Traits, public EnsureFinalized
     using DefaultParams = typename DefaultMaterial::Params;
     using TwoPhaseParams = typename TwoPhaseMaterial::Params;
 
-    template <class ParamT>
-    struct Deleter
-    {
-        inline void operator () ( void* ptr )
-        {
-            delete static_cast< ParamT* > (ptr);
-        }
-    };
-
-    using ParamPointerType = std::shared_ptr<void>;
+    // std::monostate for the OnePhase approach and before setApproach().
+    using RealParamsType = std::variant<std::monostate,
+                                        Stone1Params,
+                                        Stone2Params,
+                                        DefaultParams,
+                                        TwoPhaseParams>;
 
 public:
     using EnsureFinalized :: finalize;
@@ -115,31 +113,31 @@ public:
 
     EclMultiplexerMaterialParams& operator= ( const EclMultiplexerMaterialParams& other )
     {
-        realParams_.reset();
+        realParams_.template emplace<std::monostate>();
         setApproach( other.approach() );
         return *this;
     }
 
     void setApproach(EclMultiplexerApproach newApproach)
     {
-        assert(realParams_ == 0);
+        assert(std::holds_alternative<std::monostate>(realParams_));
         approach_ = newApproach;
 
         switch (approach()) {
         case EclMultiplexerApproach::Stone1:
-            realParams_ = ParamPointerType(new Stone1Params, Deleter< Stone1Params > () );
+            realParams_.template emplace<Stone1Params>();
             break;
 
         case EclMultiplexerApproach::Stone2:
-            realParams_ = ParamPointerType(new Stone2Params, Deleter< Stone2Params > () );
+            realParams_.template emplace<Stone2Params>();
             break;
 
         case EclMultiplexerApproach::Default:
-            realParams_ = ParamPointerType(new DefaultParams, Deleter< DefaultParams > () );
+            realParams_.template emplace<DefaultParams>();
             break;
 
         case EclMultiplexerApproach::TwoPhase:
-            realParams_ = ParamPointerType(new TwoPhaseParams, Deleter< TwoPhaseParams > () );
+            realParams_.template emplace<TwoPhaseParams>();
             break;
 
         case EclMultiplexerApproach::OnePhase:
@@ -246,20 +244,21 @@ public:
     }
 
 private:
+    // Unchecked access, the approach has already been asserted by the callers.
     template <class ParamT>
     ParamT& castTo()
     {
-        return *(static_cast<ParamT *> (realParams_.operator->()));
+        return *std::get_if<ParamT>(&realParams_);
     }
 
     template <class ParamT>
     const ParamT& castTo() const
     {
-        return *(static_cast<const ParamT *> (realParams_.operator->()));
+        return *std::get_if<ParamT>(&realParams_);
     }
 
     EclMultiplexerApproach approach_{EclMultiplexerApproach::Default};
-    ParamPointerType realParams_;
+    RealParamsType realParams_;
 };
 } // namespace Opm
 
@@ -33,6 +33,9 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <functional>
+
 namespace Opm {
 
 template<class Scalar, template<class> class Storage>
@@ -225,6 +228,61 @@ setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa)
                              static_cast<Scalar>(viscaqa[0].getC2("NACL"))};
 }
 
+template<class Scalar, template<class> class Storage>
+void BrineCo2Pvt<Scalar, Storage>::
+enableTabulation(const Co2BrineTabulationParams<Scalar>& params)
+{
+    // Evaluate the correlations, not a previous tabulation.
+    tables_.reset();
+
+    // With a fixed salinity per region, each distinct salinity gets a table
+    // in temperature and pressure only.
+    Scalar salinityMin = 0.0;
+    Scalar salinityMax = params.salinityMax;
+    std::size_t numTables = (enableSaltConcentration_ || !salinity_.empty()) ? 1 : 0;
+    if (!enableSaltConcentration_ &&
+        std::adjacent_find(salinity_.begin(), salinity_.end(),
+                           std::not_equal_to<>{}) != salinity_.end())
+    {
+        numTables = salinity_.size();
+    }
+    else {
+        for (const auto& s : salinity_) {
+            salinityMax = std::max(salinityMax, s);
+        }
+    }
+
+    auto tables = std::make_shared<Tables>();
+    for (std::size_t tableIdx = 0; tableIdx < numTables; ++tableIdx) {
+        if (!enableSaltConcentration_) {
+            salinityMin = salinity_[tableIdx];
+            salinityMax = salinity_[tableIdx];
+        }
+        if (enableDissolution_) {
+            tables->moleFractionCO2.emplace_back(params, salinityMin, salinityMax,
+                [this](Scalar T, Scalar p, Scalar S) { return moleFractionCO2_(0, T, p, S); });
+        }
+        tables->viscosity.emplace_back(params, salinityMin, salinityMax,
+            [this](Scalar T, Scalar p, Scalar S) { return brineViscosity_(0, T, p, S); });
+    }
+    tables->pureWaterDensity = TabulatedFunction(params, 0.0, 0.0,
+        [this](Scalar T, Scalar p, Scalar) { return pureWaterDensity_(T, p); });
+
+    std::size_t numSamples = tables->pureWaterDensity.numSamples();
+    Scalar maxFallbackFraction = tables->pureWaterDensity.fallbackFraction();
+    for (const auto* functions : { &tables->moleFractionCO2, &tables->viscosity }) {
+        for (const auto& f : *functions) {
+            numSamples += f.numSamples();
+            maxFallbackFraction = std::max(maxFallbackFraction, f.fallbackFraction());
+        }
+    }
+
+    tables_ = std::move(tables);
+    OpmLog::info(fmt::format("Tabulated the CO2-brine liquid properties using {} sampling points. "
+                             "At most {:.2f}% of the table cells fall back to the correlations.",
+                             numSamples, 100.0*maxFallbackFraction));
+}
+
 template class BrineCo2Pvt<double>;
 template class BrineCo2Pvt<float>;
 
@@ -45,10 +45,12 @@
 #include <opm/material/binarycoefficients/H2O_CO2.hpp>
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
 #include <opm/material/fluidsystems/BlackOilFunctions.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/Co2BrineTabulation.hpp>
 
 #include <opm/input/eclipse/EclipseState/Co2StoreConfig.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace Opm {
@@ -189,6 +191,22 @@ public:
 
     void setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa);
 
+    /*!
+     * \brief Tabulate the CO2 solubility, the pure water density and the brine
+     *        viscosity, and interpolate them instead of evaluating the
+     *        correlations.
+     *
+     * Must be called after all other parameters have been set.  States
+     * outside the tabulated range, and cells of the tables in which the
+     * interpolation does not meet the tolerance, are evaluated by the
+     * correlations.  Copies for GPUs do not carry the tables.
+     */
+    void enableTabulation(const Co2BrineTabulationParams<Scalar>& params);
+
+    //! Returns true iff the properties are interpolated in tables.
+    bool tabulationEnabled() const
+    { return tables_ != nullptr; }
+
     /*!
      * \brief Return the number of PVT regions which are considered by this PVT-object.
      */
@@ -266,14 +284,7 @@ public:
     {
         OPM_TIMEFUNCTION_LOCAL(Subsystem::PvtProps);
         const Evaluation salinity = salinityFromConcentration(regionIdx, temperature, pressure, saltConcentration);
-        if (enableEzrokhiViscosity_) {
-            const Evaluation& mu_pure = H2O::liquidViscosity(temperature, pressure, extrapolate);
-            const Evaluation& nacl_exponent = ezrokhiExponent_(temperature, ezrokhiViscNaClCoeff_);
-            return mu_pure * pow(10.0, nacl_exponent * salinity);
-        }
-        else {
-            return Brine::liquidViscosity(temperature, pressure, salinity);
-        }
+        return brineViscosity_(regionIdx, temperature, pressure, salinity);
     }
 
     /*!
@@ -300,15 +311,7 @@ public:
                                                   const Evaluation& pressure) const
     {
         OPM_TIMEFUNCTION_LOCAL(Subsystem::PvtProps);
-        if (enableEzrokhiViscosity_) {
-            const Evaluation& mu_pure = H2O::liquidViscosity(temperature, pressure, extrapolate);
-            const Evaluation& nacl_exponent = ezrokhiExponent_(temperature, ezrokhiViscNaClCoeff_);
-            return mu_pure * pow(10.0, nacl_exponent * Evaluation(salinity_[regionIdx]));
-        }
-        else {
-            return Brine::liquidViscosity(temperature, pressure, Evaluation(salinity_[regionIdx]));
-        }
-
+        return brineViscosity_(regionIdx, temperature, pressure, Evaluation(salinity_[regionIdx]));
     }
 
 
@@ -526,16 +529,9 @@ public:
 
         // Water viscosity
         const Evaluation& mu_H20 = H2O::liquidViscosity(temperature, pressure, extrapolate);
-        Evaluation mu_Brine;
-        if (enableEzrokhiViscosity_) {
-            const Evaluation& nacl_exponent = ezrokhiExponent_(temperature,
-                                                               ezrokhiViscNaClCoeff_);
-            mu_Brine = mu_H20 * pow(10.0, nacl_exponent * Evaluation(salinity_[regionIdx]));
-        }
-        else {
-            // Brine viscosity
-            mu_Brine = Brine::liquidViscosity(temperature, pressure, Evaluation(salinity_[regionIdx]));
-        }
+        // Brine viscosity
+        const Evaluation mu_Brine = brineViscosity_(regionIdx, temperature, pressure,
+                                                    Evaluation(salinity_[regionIdx]));
         const Evaluation log_D_Brine = log_D_H20 - 0.87*log10(mu_Brine / mu_H20);
 
         return pow(Evaluation(10), log_D_Brine) * 1e-4; // convert from cm2/s to m2/s
@@ -570,10 +566,61 @@ public:
             return 0.0;
         }
 
+        const Evaluation xlCO2 = moleFractionCO2_(regionIdx, temperature, pressure, salinity);
+        return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
+    }
+
+private:
+    using TabulatedFunction = Co2BrineTabulatedFunction<Scalar>;
+
+    // Tables of the properties which are expensive to compute.  The
+    // properties which depend on the salinity are tabulated for the salinity
+    // of each region, or as functions of salinity if the salt concentration
+    // is a primary variable.
+    struct Tables
+    {
+        std::vector<TabulatedFunction> moleFractionCO2{};
+        std::vector<TabulatedFunction> viscosity{};
+        TabulatedFunction pureWaterDensity{};
+    };
+
+    template <class LhsEval>
+    static const TabulatedFunction*
+    applicableTable_(const std::vector<TabulatedFunction>& tables,
+                     unsigned regionIdx,
+                     const LhsEval& temperature,
+                     const LhsEval& pressure,
+                     const LhsEval& salinity)
+    {
+        if (tables.empty()) {
+            return nullptr;
+        }
+
+        const auto& table = tables[tables.size() == 1 ? 0 : regionIdx];
+        return table.applies(temperature, pressure, salinity) ? &table : nullptr;
+    }
+
+    // Equilibrium mole fraction of CO2 in the liquid phase.
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval moleFractionCO2_(unsigned regionIdx,
+                                             const LhsEval& temperature,
+                                             const LhsEval& pressure,
+                                             const LhsEval& salinity) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (tables_) {
+            if (const auto* table = applicableTable_(tables_->moleFractionCO2, regionIdx,
+                                                     temperature, pressure, salinity))
+            {
+                return table->eval(temperature, pressure, salinity);
+            }
+        }
+#endif
+
         // calulate the equilibrium composition for the given
         // temperature and pressure.
-        Evaluation xgH2O;
-        Evaluation xlCO2;
+        LhsEval xgH2O;
+        LhsEval xlCO2;
         BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables_,
                                                     temperature,
                                                     pressure,
@@ -585,12 +632,51 @@ public:
                                                     extrapolate);
 
         // normalize the phase compositions
-        xlCO2 = max(0.0, min(1.0, xlCO2));
+        return max(0.0, min(1.0, xlCO2));
+    }
 
-        return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval brineViscosity_(unsigned regionIdx,
+                                            const LhsEval& temperature,
+                                            const LhsEval& pressure,
+                                            const LhsEval& salinity) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (tables_) {
+            if (const auto* table = applicableTable_(tables_->viscosity, regionIdx,
+                                                     temperature, pressure, salinity))
+            {
+                return table->eval(temperature, pressure, salinity);
+            }
+        }
+#endif
+
+        if (enableEzrokhiViscosity_) {
+            const LhsEval& mu_pure = H2O::liquidViscosity(temperature, pressure, extrapolate);
+            const LhsEval& nacl_exponent = ezrokhiExponent_(temperature, ezrokhiViscNaClCoeff_);
+            return mu_pure * pow(10.0, nacl_exponent * salinity);
+        }
+        else {
+            return Brine::liquidViscosity(temperature, pressure, salinity);
+        }
+    }
+
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval pureWaterDensity_(const LhsEval& temperature,
+                                              const LhsEval& pressure) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (tables_) {
+            const LhsEval salinity{0.0};
+            if (tables_->pureWaterDensity.applies(temperature, pressure, salinity)) {
+                return tables_->pureWaterDensity.eval(temperature, pressure, salinity);
+            }
+        }
+#endif
+
+        return H2O::liquidDensity(temperature, pressure, extrapolate);
     }
 
-private:
     template <class LhsEval>
     OPM_HOST_DEVICE LhsEval ezrokhiExponent_(const LhsEval& temperature,
                                              const ContainerT& ezrokhiCoeff) const
@@ -633,7 +719,7 @@ private:
 #endif
         }
 
-        const LhsEval& rho_pure = H2O::liquidDensity(T, pl, extrapolate);
+        const LhsEval& rho_pure = pureWaterDensity_(T, pl);
         if (enableEzrokhiDensity_) {
             const LhsEval& nacl_exponent = ezrokhiExponent_(T, ezrokhiDenNaClCoeff_);
             const LhsEval& co2_exponent = ezrokhiExponent_(T, ezrokhiDenCo2Coeff_);
@@ -822,7 +908,7 @@ private:
         if (enableSaltConcentration_) {
             // Convert concentration [kg/m³] to mass fraction [kg_salt/kg_solution].
             // First approximation using pure water density
-            const LhsEval rho_w = H2O::liquidDensity(T, P, true);
+            const LhsEval rho_w = pureWaterDensity_(T, P);
             const LhsEval S_approx = saltConcentration / rho_w;
             // Improved estimate using Batzle-Wang brine density
             const LhsEval rho_brine = Brine::liquidDensity(T, P, S_approx, rho_w);
@@ -852,6 +938,7 @@ private:
     Co2StoreConfig::LiquidMixingType liquidMixType_{};
     Co2StoreConfig::SaltMixingType saltMixType_{};
     Params co2Tables_;
+    std::shared_ptr<const Tables> tables_{};
 };
 
 } // namespace Opm
@@ -0,0 +1,267 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+#include <opm/material/fluidsystems/blackoilpvt/Co2BrineTabulation.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace Opm {
+
+template <class Scalar>
+Co2BrineTabulatedFunction<Scalar>::
+Co2BrineTabulatedFunction(const Co2BrineTabulationParams<Scalar>& params,
+                          const Scalar salinityMin,
+                          const Scalar salinityMax,
+                          const Function& f)
+    : tMin_(params.temperatureMin)
+    , tMax_(params.temperatureMax)
+    , pMin_(params.pressureMin)
+    , pMax_(params.pressureMax)
+    , sMin_(salinityMin)
+    , sMax_(salinityMax)
+{
+    constexpr unsigned initialSamples = 17;
+    constexpr unsigned initialSalinitySamples = 5;
+
+    const unsigned maxSamples = std::max(params.maxSamples, 2u);
+    const unsigned maxSalinitySamples = std::max(params.maxSalinitySamples, 2u);
+    unsigned numT = std::min(initialSamples, maxSamples);
+    unsigned numP = numT;
+    unsigned numS = (salinityMax > salinityMin)
+        ? std::min(initialSalinitySamples, maxSalinitySamples) : 1;
+
+    // Halve the intervals of every axis on which too many midpoints miss the
+    // tolerance, until no axis needs to be refined or may be refined.  An
+    // axis is not refined further if the last refinement did not reduce the
+    // mean error notably, which happens if the correlation itself is only
+    // about as accurate as the tolerance, e.g., due to an iterative solve.
+    std::array<Scalar, 3> previousError;
+    previousError.fill(std::numeric_limits<Scalar>::max());
+    const auto refine = [&params, &previousError](const std::size_t axis,
+                                                  unsigned& n,
+                                                  const unsigned nMax,
+                                                  const AxisAccuracy& accuracy)
+    {
+        if (n < 2 || accuracy.failingFraction <= params.maxFallbackFraction ||
+            2*n - 1 > nMax || accuracy.meanError > Scalar{0.75}*previousError[axis])
+        {
+            return false;
+        }
+
+        previousError[axis] = accuracy.meanError;
+        n = 2*n - 1;
+        return true;
+    };
+
+    sample_(f, numT, numP, numS);
+    while (true) {
+        const auto accuracy = checkAccuracy_(f, params.tolerance);
+
+        bool refined = refine(0, numT, maxSamples, accuracy[0]);
+        refined = refine(1, numP, maxSamples, accuracy[1]) || refined;
+        refined = refine(2, numS, maxSalinitySamples, accuracy[2]) || refined;
+        if (!refined) {
+            break;
+        }
+
+        sample_(f, numT, numP, numS);
+    }
+}
+
+template <class Scalar>
+void Co2BrineTabulatedFunction<Scalar>::
+sample_(const Function& f, const unsigned numT, const unsigned numP, const unsigned numS)
+{
+    // Sampling points of the previous grid are also sampling points of the
+    // refined grid and need not be evaluated again.
+    const bool reuse = !samples_.empty();
+    const auto ratio = [](const unsigned newN, const unsigned oldN)
+    { return (oldN > 1) ? (newN - 1)/(oldN - 1) : 1u; };
+    const unsigned rT = reuse ? ratio(numT, numT_) : 1;
+    const unsigned rP = reuse ? ratio(numP, numP_) : 1;
+    const unsigned rS = reuse ? ratio(numS, numS_) : 1;
+
+    std::vector<Scalar> samples(static_cast<std::size_t>(numT)*numP*numS);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int row = 0; row < static_cast<int>(numP*numS); ++row) {
+        const unsigned j = row % numP;
+        const unsigned k = row / numP;
+        const Scalar p = coordinate_(j, pMin_, pMax_, numP);
+        const Scalar S = coordinate_(k, sMin_, sMax_, numS);
+        for (unsigned i = 0; i < numT; ++i) {
+            const std::size_t idx = static_cast<std::size_t>(row)*numT + i;
+            if (reuse && i % rT == 0 && j % rP == 0 && k % rS == 0) {
+                samples[idx] = samples_[sampleIndex_(i/rT, j/rP, k/rS)];
+            }
+            else {
+                samples[idx] = f(coordinate_(i, tMin_, tMax_, numT), p, S);
+            }
+        }
+    }
+
+    samples_ = std::move(samples);
+    numT_ = numT;
+    numP_ = numP;
+    numS_ = numS;
+}
+
+template <class Scalar>
+Scalar Co2BrineTabulatedFunction<Scalar>::
+coordinate_(const Scalar a, const Scalar xMin, const Scalar xMax, const unsigned n) const
+{
+    return (n > 1) ? xMin + a*(xMax - xMin)/(n - 1) : xMin;
+}
+
+template <class Scalar>
+std::array<typename Co2BrineTabulatedFunction<Scalar>::AxisAccuracy, 3>
+Co2BrineTabulatedFunction<Scalar>::
+checkAccuracy_(const Function& f, const Scalar tolerance)
+{
+    const unsigned numCellsS = (numS_ > 1) ? numS_ - 1 : 1;
+    fallback_.assign(static_cast<std::size_t>(numT_ - 1)*(numP_ - 1)*numCellsS, 0);
+
+    // Relative error of the interpolation at a point given in (fractional)
+    // sampling point indices.  NaN if the correlation or the interpolation
+    // is not finite.
+    const auto error = [this, &f](const Scalar a, const Scalar b, const Scalar c)
+    {
+        const Scalar T = coordinate_(a, tMin_, tMax_, numT_);
+        const Scalar p = coordinate_(b, pMin_, pMax_, numP_);
+        const Scalar S = coordinate_(c, sMin_, sMax_, numS_);
+        const Scalar exact = f(T, p, S);
+        const Scalar diff = std::abs(eval(T, p, S) - exact);
+        return (diff == 0) ? Scalar{0} : diff/std::abs(exact);
+    };
+
+    // Mark the cells adjacent to a point, given by the ranges of the indices
+    // of the cells around it.
+    const auto mark = [this, numCellsS](const int iLo, const int iHi,
+                                        const int jLo, const int jHi,
+                                        const int kLo, const int kHi)
+    {
+        for (int k = std::max(kLo, 0); k <= std::min(kHi, static_cast<int>(numCellsS) - 1); ++k) {
+            for (int j = std::max(jLo, 0); j <= std::min(jHi, static_cast<int>(numP_) - 2); ++j) {
+                for (int i = std::max(iLo, 0); i <= std::min(iHi, static_cast<int>(numT_) - 2); ++i) {
+                    fallback_[cellIndex_(i, j, k)] = 1;
+                }
+            }
+        }
+    };
+
+    // Check the midpoints of the edges in the direction of each axis, and the
+    // centres of the cells, which all have the same indices as the sampling
+    // point at their lower corner.
+    // The errors enter the mean error of the axis capped at one, and
+    // non-finite ones as one.
+    enum Check : unsigned char { TEdge = 1, PEdge = 2, SEdge = 4, Centre = 8 };
+    std::vector<unsigned char> failing(samples_.size(), 0);
+    double sumErrorT = 0.0;
+    double sumErrorP = 0.0;
+    double sumErrorS = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+:sumErrorT,sumErrorP,sumErrorS)
+#endif
+    for (int row = 0; row < static_cast<int>(numP_*numS_); ++row) {
+        const int j = row % numP_;
+        const int k = row / numP_;
+        for (int i = 0; i < static_cast<int>(numT_); ++i) {
+            auto& fails = failing[static_cast<std::size_t>(row)*numT_ + i];
+            const auto check = [&fails, tolerance](const Scalar err, const Check flag)
+            {
+                if (!(err <= tolerance)) {
+                    fails |= flag;
+                }
+                return (err <= 1) ? err : Scalar{1};
+            };
+
+            const bool hasT = i + 1 < static_cast<int>(numT_);
+            const bool hasP = j + 1 < static_cast<int>(numP_);
+            const bool hasS = k + 1 < static_cast<int>(numS_);
+            if (hasT) {
+                sumErrorT += check(error(i + 0.5, j, k), TEdge);
+            }
+            if (hasP) {
+                sumErrorP += check(error(i, j + 0.5, k), PEdge);
+            }
+            if (hasS) {
+                sumErrorS += check(error(i, j, k + 0.5), SEdge);
+            }
+            if (hasT && hasP && (hasS || numS_ == 1)) {
+                check(error(i + 0.5, j + 0.5, hasS ? k + 0.5 : k), Centre);
+            }
+        }
+    }
+
+    std::array<std::size_t, 3> numFailing{};
+    for (int k = 0; k < static_cast<int>(numS_); ++k) {
+        // Cells below and above a sampling layer, if any.
+        const int kLo = (numS_ > 1) ? k - 1 : 0;
+        for (int j = 0; j < static_cast<int>(numP_); ++j) {
+            for (int i = 0; i < static_cast<int>(numT_); ++i) {
+                const auto fails = failing[sampleIndex_(i, j, k)];
+                if (fails & TEdge) {
+                    ++numFailing[0];
+                    mark(i, i, j - 1, j, kLo, k);
+                }
+                if (fails & PEdge) {
+                    ++numFailing[1];
+                    mark(i - 1, i, j, j, kLo, k);
+                }
+                if (fails & SEdge) {
+                    ++numFailing[2];
+                    mark(i - 1, i, j - 1, j, k, k);
+                }
+                if (fails & Centre) {
+                    mark(i, i, j, j, k, k);
+                }
+            }
+        }
+    }
+
+    const std::array<std::size_t, 3> numChecked {
+        static_cast<std::size_t>(numT_ - 1)*numP_*numS_,
+        static_cast<std::size_t>(numT_)*(numP_ - 1)*numS_,
+        static_cast<std::size_t>(numT_)*numP_*(numS_ - 1),
+    };
+
+    const std::array<double, 3> sumError { sumErrorT, sumErrorP, sumErrorS };
+
+    std::array<AxisAccuracy, 3> result{};
+    for (std::size_t axis = 0; axis < result.size(); ++axis) {
+        if (numChecked[axis] > 0) {
+            result[axis].failingFraction = static_cast<Scalar>(numFailing[axis]) / numChecked[axis];
+            result[axis].meanError = sumError[axis] / numChecked[axis];
+        }
+    }
+
+    return result;
+}
+
+template class Co2BrineTabulatedFunction<double>;
+template class Co2BrineTabulatedFunction<float>;
+
+} // namespace Opm
@@ -0,0 +1,230 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Error-controlled tabulation of CO2-brine properties in temperature,
+ *        pressure and salinity.
+ */
+#ifndef OPM_CO2_BRINE_TABULATION_HPP
+#define OPM_CO2_BRINE_TABULATION_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Range and accuracy of the tabulated CO2-brine properties.
+ *
+ * Outside the range, the properties are computed from the correlations.
+ */
+template <class Scalar>
+struct Co2BrineTabulationParams
+{
+    //! Temperature range [K]
+    Scalar temperatureMin = 283.15;
+    Scalar temperatureMax = 423.15;
+
+    //! Pressure range [Pa]
+    Scalar pressureMin = 1.0e5;
+    Scalar pressureMax = 7.0e7;
+
+    //! Upper bound of the salinity [kg NaCl/kg brine] for properties which
+    //! are tabulated as functions of salinity
+    Scalar salinityMax = 0.25;
+
+    //! Relative tolerance of the interpolated values
+    Scalar tolerance = 1.0e-3;
+
+    //! Maximum number of sampling points of the temperature and pressure axes
+    unsigned maxSamples = 257;
+
+    //! Maximum number of sampling points of the salinity axis
+    unsigned maxSalinitySamples = 65;
+
+    //! Fraction of the cells of an axis which may exceed the tolerance
+    //! before the axis is refined further.  These cells, typically at kinks
+    //! of the correlations, fall back to the correlation.
+    Scalar maxFallbackFraction = 0.05;
+};
+
+/*!
+ * \brief A property which is sampled on a uniform grid in temperature and
+ *        pressure, and optionally salinity, and interpolated linearly.
+ *
+ * The grid is refined by doubling the number of intervals of each axis on
+ * which the interpolation at the midpoints between sampling points does not
+ * meet the relative tolerance.  Cells in which the interpolation still
+ * exceeds the tolerance at the edge midpoints or the centre are marked, and
+ * applies() returns false for them, so that the caller falls back to the
+ * correlation.
+ *
+ * A property which is tabulated for a single salinity only applies to
+ * exactly this salinity.
+ */
+template <class Scalar>
+class Co2BrineTabulatedFunction
+{
+public:
+    using Function = std::function<Scalar(Scalar temperature, Scalar pressure, Scalar salinity)>;
+
+    Co2BrineTabulatedFunction() = default;
+
+    /*!
+     * \brief Tabulate a property.
+     *
+     * \param params Range and accuracy of the tabulation.
+     * \param salinityMin Lower bound of the salinity.
+     * \param salinityMax Upper bound of the salinity.  If equal to the lower
+     *        bound, the property is tabulated for this salinity only.
+     * \param f Correlation of the property.
+     */
+    Co2BrineTabulatedFunction(const Co2BrineTabulationParams<Scalar>& params,
+                              Scalar salinityMin,
+                              Scalar salinityMax,
+                              const Function& f);
+
+    /*!
+     * \brief Returns true iff the state lies in the tabulated range and the
+     *        interpolation meets the tolerance there.
+     */
+    template <class Evaluation>
+    bool applies(const Evaluation& temperature,
+                 const Evaluation& pressure,
+                 const Evaluation& salinity) const
+    {
+        if (samples_.empty()) {
+            return false;
+        }
+
+        const Scalar T = scalarValue(temperature);
+        const Scalar p = scalarValue(pressure);
+        const Scalar S = scalarValue(salinity);
+        if (!(tMin_ <= T && T <= tMax_ && pMin_ <= p && p <= pMax_)) {
+            return false;
+        }
+        if (numS_ == 1 ? S != sMin_ : !(sMin_ <= S && S <= sMax_)) {
+            return false;
+        }
+
+        const unsigned k = numS_ == 1 ? 0 : segment_(S, sMin_, sMax_, numS_);
+        return !fallback_[cellIndex_(segment_(T, tMin_, tMax_, numT_),
+                                     segment_(p, pMin_, pMax_, numP_), k)];
+    }
+
+    /*!
+     * \brief Evaluate the property by (bi- or tri-) linear interpolation.
+     */
+    template <class Evaluation>
+    Evaluation eval(const Evaluation& temperature,
+                    const Evaluation& pressure,
+                    const Evaluation& salinity) const
+    {
+        Evaluation alpha = (temperature - tMin_)*((numT_ - 1)/(tMax_ - tMin_));
+        Evaluation beta = (pressure - pMin_)*((numP_ - 1)/(pMax_ - pMin_));
+        const unsigned i = segment_(scalarValue(temperature), tMin_, tMax_, numT_);
+        const unsigned j = segment_(scalarValue(pressure), pMin_, pMax_, numP_);
+        alpha -= i;
+        beta -= j;
+
+        if (numS_ == 1) {
+            return interpolateLayer_(i, j, 0, alpha, beta);
+        }
+
+        Evaluation gamma = (salinity - sMin_)*((numS_ - 1)/(sMax_ - sMin_));
+        const unsigned k = segment_(scalarValue(salinity), sMin_, sMax_, numS_);
+        gamma -= k;
+
+        const Evaluation s0 = interpolateLayer_(i, j, k, alpha, beta);
+        const Evaluation s1 = interpolateLayer_(i, j, k + 1, alpha, beta);
+        return s0 + (s1 - s0)*gamma;
+    }
+
+    //! Number of sampling points
+    std::size_t numSamples() const
+    { return samples_.size(); }
+
+    //! Fraction of the cells which fall back to the correlation
+    Scalar fallbackFraction() const
+    {
+        return fallback_.empty() ? Scalar{0}
+            : static_cast<Scalar>(std::count(fallback_.begin(), fallback_.end(), 1)) / fallback_.size();
+    }
+
+private:
+    // Index of the interval of a uniform axis which contains x.
+    static unsigned segment_(const Scalar x, const Scalar xMin, const Scalar xMax, const unsigned n)
+    {
+        const int i = static_cast<int>((x - xMin)*((n - 1)/(xMax - xMin)));
+        return static_cast<unsigned>(std::clamp(i, 0, static_cast<int>(n) - 2));
+    }
+
+    std::size_t sampleIndex_(const unsigned i, const unsigned j, const unsigned k) const
+    { return (static_cast<std::size_t>(k)*numP_ + j)*numT_ + i; }
+
+    std::size_t cellIndex_(const unsigned i, const unsigned j, const unsigned k) const
+    { return (static_cast<std::size_t>(k)*(numP_ - 1) + j)*(numT_ - 1) + i; }
+
+    template <class Evaluation>
+    Evaluation interpolateLayer_(const unsigned i, const unsigned j, const unsigned k,
+                                 const Evaluation& alpha, const Evaluation& beta) const
+    {
+        const Scalar* v = &samples_[sampleIndex_(i, j, k)];
+        const Evaluation s0 = v[0] + (v[1] - v[0])*alpha;
+        const Evaluation s1 = v[numT_] + (v[numT_ + 1] - v[numT_])*alpha;
+        return s0 + (s1 - s0)*beta;
+    }
+
+    // Accuracy of the interpolation between the sampling points of an axis.
+    struct AxisAccuracy
+    {
+        Scalar failingFraction{};
+        Scalar meanError{};
+    };
+
+    void sample_(const Function& f, unsigned numT, unsigned numP, unsigned numS);
+    Scalar coordinate_(Scalar a, Scalar xMin, Scalar xMax, unsigned n) const;
+    std::array<AxisAccuracy, 3> checkAccuracy_(const Function& f, Scalar tolerance);
+
+    std::vector<Scalar> samples_{};
+    std::vector<unsigned char> fallback_{};
+    unsigned numT_{};
+    unsigned numP_{};
+    unsigned numS_{};
+    Scalar tMin_{};
+    Scalar tMax_{};
+    Scalar pMin_{};
+    Scalar pMax_{};
+    Scalar sMin_{};
+    Scalar sMax_{};
+};
+
+} // namespace Opm
+
+#endif // OPM_CO2_BRINE_TABULATION_HPP
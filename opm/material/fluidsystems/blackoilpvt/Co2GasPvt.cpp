@@ -31,6 +31,10 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
+#include <fmt/format.h>
+
+#include <algorithm>
+
 namespace Opm {
 
 template<class Scalar, template<class> class Storage>
@@ -177,6 +181,39 @@ setEzrokhiDenCoeff(const std::vector<EzrokhiTable>& denaqa)
                             static_cast<Scalar>(denaqa[0].getC2("NACL"))};
 }
 
+template<class Scalar, template<class> class Storage>
+void Co2GasPvt<Scalar, Storage>::
+enableTabulation(const Co2BrineTabulationParams<Scalar>& params)
+{
+    // Evaluate the correlations, not a previous tabulation.
+    tables_.reset();
+
+    // The salinity is computed from the salt concentration of the cells, so
+    // the solubility is tabulated as a function of it.
+    Scalar salinityMax = params.salinityMax;
+    for (const auto& s : salinity_) {
+        salinityMax = std::max(salinityMax, s);
+    }
+
+    auto tables = std::make_shared<Tables>();
+    if (enableVaporization_) {
+        tables->moleFractionH2O = TabulatedFunction(params, 0.0, salinityMax,
+            [this](Scalar T, Scalar p, Scalar S) { return moleFractionH2O_(T, p, S); });
+    }
+    tables->viscosity = TabulatedFunction(params, 0.0, 0.0,
+        [this](Scalar T, Scalar p, Scalar) { return saturatedViscosity(0, T, p); });
+
+    const std::size_t numSamples = tables->moleFractionH2O.numSamples()
+                                 + tables->viscosity.numSamples();
+    const Scalar maxFallbackFraction = std::max(tables->moleFractionH2O.fallbackFraction(),
+                                                tables->viscosity.fallbackFraction());
+
+    tables_ = std::move(tables);
+    OpmLog::info(fmt::format("Tabulated the CO2 gas properties using {} sampling points. "
+                             "At most {:.2f}% of the table cells fall back to the correlations.",
+                             numSamples, 100.0*maxFallbackFraction));
+}
+
 template class Co2GasPvt<double>;
 template class Co2GasPvt<float>;
 
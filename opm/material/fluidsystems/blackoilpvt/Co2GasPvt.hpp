@@ -40,12 +40,14 @@
 #include <opm/material/components/SimpleHuDuanH2O.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/Co2BrineTabulation.hpp>
 #include <opm/input/eclipse/EclipseState/Co2StoreConfig.hpp>
 #include <opm/material/components/CO2Tables.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace Opm {
@@ -224,6 +226,14 @@ public:
                                                   const Evaluation& pressure) const
     {
         OPM_TIMEBLOCK_LOCAL(saturatedViscosity, Subsystem::PvtProps);
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (tables_) {
+            const Evaluation salinity{0.0};
+            if (tables_->viscosity.applies(temperature, pressure, salinity)) {
+                return tables_->viscosity.eval(temperature, pressure, salinity);
+            }
+        }
+#endif
         // Neglects impact of vaporized water on the visosity
         return CO2::gasViscosity(co2Tables, temperature, pressure, extrapolate);
     }
@@ -392,7 +402,29 @@ public:
     OPM_HOST_DEVICE const Params& getParams() const
     { return co2Tables; }
 
+    /*!
+     * \brief Tabulate the water vapour solubility and the CO2 viscosity, and
+     *        interpolate them instead of evaluating the correlations.
+     *
+     * The solubility is tabulated as a function of salinity.  Must be called
+     * after all other parameters have been set.  Copies for GPUs do not carry
+     * the tables.
+     */
+    void enableTabulation(const Co2BrineTabulationParams<Scalar>& params);
+
+    //! Returns true iff the properties are interpolated in tables.
+    bool tabulationEnabled() const
+    { return tables_ != nullptr; }
+
 private:
+    using TabulatedFunction = Co2BrineTabulatedFunction<Scalar>;
+
+    struct Tables
+    {
+        TabulatedFunction moleFractionH2O{};
+        TabulatedFunction viscosity{};
+    };
+
     template <class LhsEval>
     LhsEval ezrokhiExponent_(const LhsEval& temperature,
                              const ContainerT& ezrokhiCoeff) const
@@ -412,6 +444,22 @@ private:
             return 0.0;
         }
 
+        const LhsEval xgH2O = moleFractionH2O_(temperature, pressure, salinity);
+        return convertXgWToRvw(convertxgWToXgW(xgH2O, salinity), regionIdx);
+    }
+
+    // Equilibrium mole fraction of water in the gas phase.
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval moleFractionH2O_(const LhsEval& temperature,
+                                             const LhsEval& pressure,
+                                             const LhsEval& salinity) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (tables_ && tables_->moleFractionH2O.applies(temperature, pressure, salinity)) {
+            return tables_->moleFractionH2O.eval(temperature, pressure, salinity);
+        }
+#endif
+
         // calulate the equilibrium composition for the given
         // temperature and pressure.
         LhsEval xgH2O;
@@ -427,9 +475,7 @@ private:
                                                     extrapolate);
 
         // normalize the phase compositions
-        xgH2O = max(0.0, min(1.0, xgH2O));
-
-        return convertXgWToRvw(convertxgWToXgW(xgH2O, salinity), regionIdx);
+        return max(0.0, min(1.0, xgH2O));
     }
 
     /*!
@@ -493,6 +539,7 @@ private:
     int activityModel_{};
     Co2StoreConfig::GasMixingType gastype_{};
     Params co2Tables;
+    std::shared_ptr<const Tables> tables_{};
 };
 
 } // namespace Opm
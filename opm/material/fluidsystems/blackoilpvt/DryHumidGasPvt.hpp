@@ -34,6 +34,7 @@
 #include <opm/material/common/MathToolbox.hpp>
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtValues.hpp>
 
 #include <cstddef>
 
@@ -170,12 +171,47 @@ public:
                          const Evaluation& /*Rv*/,
                          const Evaluation& Rvw) const
     {
-        const Evaluation& invBg = inverseGasB_[regionIdx].eval(pressure, Rvw, /*extrapolate=*/true);
-        const Evaluation& invMugBg = inverseGasBMu_[regionIdx].eval(pressure, Rvw, /*extrapolate=*/true);
+        unsigned i, j1, j2;
+        Evaluation alpha, beta1, beta2;
+        inverseGasB_[regionIdx].findPoints(i, j1, j2, alpha, beta1, beta2, pressure, Rvw, /*extrapolate=*/true);
+
+        const Evaluation& invBg = inverseGasB_[regionIdx].eval(i, j1, j2, alpha, beta1, beta2);
+        const Evaluation& invMugBg = inverseGasBMu_[regionIdx].eval(i, j1, j2, alpha, beta1, beta2);
 
         return invBg / invMugBg;
     }
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-], the inverse of
+     *        the product of formation volume factor and viscosity, the
+     *        viscosity [Pa s] and the saturated water vaporization factor
+     *        [m^3/m^3] of the fluid phase.
+     *
+     * Locates (p, Rvw) in the PVT tables only once.  The results are
+     * identical to those of inverseFormationVolumeFactor(), viscosity()
+     * and saturatedWaterVaporizationFactor() without salt.
+     */
+    template <class Evaluation>
+    PvtValues<Evaluation> pvtValues(unsigned regionIdx,
+                                    const Evaluation& /*temperature*/,
+                                    const Evaluation& pressure,
+                                    const Evaluation& /*Rv*/,
+                                    const Evaluation& Rvw) const
+    {
+        PvtValues<Evaluation> values;
+
+        unsigned i, j1, j2;
+        Evaluation alpha, beta1, beta2;
+        inverseGasB_[regionIdx].findPoints(i, j1, j2, alpha, beta1, beta2, pressure, Rvw, /*extrapolate=*/true);
+
+        values.invB = inverseGasB_[regionIdx].eval(i, j1, j2, alpha, beta1, beta2);
+        values.invBMu = inverseGasBMu_[regionIdx].eval(i, j1, j2, alpha, beta1, beta2);
+        values.mu = values.invB / values.invBMu;
+        values.saturatedFactor = saturatedWaterVaporizationFactorTable_[regionIdx].eval(pressure, /*extrapolate=*/true);
+
+        return values;
+    }
+
     /*!
      * \brief Returns the dynamic viscosity [Pa s] of oil saturated gas at a given pressure.
      */
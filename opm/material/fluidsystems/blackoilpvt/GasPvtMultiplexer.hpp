@@ -32,10 +32,12 @@
 #include <opm/material/fluidsystems/blackoilpvt/DryHumidGasPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/GasPvtThermal.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/H2GasPvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WetGasPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WetHumidGasPvt.hpp>
 
 #include <functional>
+#include <span>
 namespace Opm {
 
 class EclipseState;
@@ -210,6 +212,42 @@ public:
     inverseFormationVolumeFactorAndViscosity(const FluidState& fluidState, unsigned regionIdx)
     { OPM_GAS_PVT_MULTIPLEXER_CALL(return pvtImpl.inverseFormationVolumeFactorAndViscosity(fluidState, regionIdx)); }
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-] and viscosity
+     *        [Pa s] of the fluid phase for a batch of cells.
+     *
+     * Equivalent to calling inverseFormationVolumeFactor() and viscosity()
+     * for each cell, but dispatches on the PVT approach only once for the
+     * whole batch and visits the cells grouped by PVT region.  PVT models
+     * providing pvtValues() locate each cell in their tables only once.
+     * All arrays must have the same size.  The Evaluation type must be
+     * specified explicitly.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactorAndViscosity(std::span<const unsigned> regionIdx,
+                                                  std::span<const Evaluation> temperature,
+                                                  std::span<const Evaluation> pressure,
+                                                  std::span<const Evaluation> Rv,
+                                                  std::span<const Evaluation> Rvw,
+                                                  std::span<Evaluation> invB,
+                                                  std::span<Evaluation> mu) const
+    {
+        PvtBatch::checkSizes(regionIdx.size(), temperature, pressure, Rv, Rvw, invB, mu);
+        OPM_GAS_PVT_MULTIPLEXER_CALL(PvtBatch::forEachCell(regionIdx, [&pvtImpl, &temperature, &pressure, &Rv, &Rvw, &invB, &mu]
+                                                           (const unsigned region, const std::size_t cell)
+        {
+            if constexpr (requires { pvtImpl.pvtValues(region, temperature[cell], pressure[cell], Rv[cell], Rvw[cell]); }) {
+                const auto values = pvtImpl.pvtValues(region, temperature[cell], pressure[cell], Rv[cell], Rvw[cell]);
+                invB[cell] = values.invB;
+                mu[cell] = values.mu;
+            }
+            else {
+                invB[cell] = pvtImpl.inverseFormationVolumeFactor(region, temperature[cell], pressure[cell], Rv[cell], Rvw[cell]);
+                mu[cell] = pvtImpl.viscosity(region, temperature[cell], pressure[cell], Rv[cell], Rvw[cell]);
+            }
+        }), break);
+    }
+
     /*!
      * \brief Returns the formation volume factor [-] of oil saturated gas given a set of parameters.
      */
@@ -228,6 +266,27 @@ public:
                                               const Evaluation& pressure) const
     { OPM_GAS_PVT_MULTIPLEXER_CALL(return pvtImpl.saturatedOilVaporizationFactor(regionIdx, temperature, pressure)); }
 
+    /*!
+     * \brief Returns the oil vaporization factor \f$R_v\f$ [m^3/m^3] of oil
+     *        saturated gas for a batch of cells.
+     *
+     * Batched counterpart of saturatedOilVaporizationFactor(regionIdx,
+     * temperature, pressure).  All arrays must have the same size.
+     */
+    template <class Evaluation>
+    void saturatedOilVaporizationFactor(std::span<const unsigned> regionIdx,
+                                        std::span<const Evaluation> temperature,
+                                        std::span<const Evaluation> pressure,
+                                        std::span<Evaluation> RvSat) const
+    {
+        PvtBatch::checkSizes(regionIdx.size(), temperature, pressure, RvSat);
+        OPM_GAS_PVT_MULTIPLEXER_CALL(PvtBatch::forEachCell(regionIdx, [&pvtImpl, &temperature, &pressure, &RvSat]
+                                                           (const unsigned region, const std::size_t cell)
+        {
+            RvSat[cell] = pvtImpl.saturatedOilVaporizationFactor(region, temperature[cell], pressure[cell]);
+        }), break);
+    }
+
     /*!
      * \brief Returns the oil vaporization factor \f$R_v\f$ [m^3/m^3] of oil saturated gas.
      */
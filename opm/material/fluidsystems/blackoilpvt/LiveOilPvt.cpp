@@ -336,6 +336,15 @@ void LiveOilPvt<Scalar>::initEnd()
         invSatOilBMu.setXYContainers(satPressuresArray, invSatOilBMuArray);
 
         updateSaturationPressure_(regionIdx);
+
+        // the tables are complete, so replace the bisections of the segment
+        // searches during the evaluation by constant time lookups
+        inverseOilBTable_[regionIdx].buildSegmentLookup();
+        invOilBMu.buildSegmentLookup();
+        invSatOilB.buildSegmentLookup();
+        invSatOilBMu.buildSegmentLookup();
+        saturatedGasDissolutionFactorTable_[regionIdx].buildSegmentLookup();
+        saturationPressure_[regionIdx].buildSegmentLookup();
     }
 }
 
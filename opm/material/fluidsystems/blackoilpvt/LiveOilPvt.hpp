@@ -33,6 +33,7 @@
 #include <opm/material/common/MathToolbox.hpp>
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtValues.hpp>
 
 #include <cstddef>
 
@@ -178,12 +179,47 @@ public:
                          const Evaluation& Rs) const
     {
         // ATTENTION: Rs is the first axis!
-        const Evaluation& invBo = inverseOilBTable_[regionIdx].eval(Rs, pressure, /*extrapolate=*/true);
-        const Evaluation& invMuoBo = inverseOilBMuTable_[regionIdx].eval(Rs, pressure, /*extrapolate=*/true);
+        unsigned i, j1, j2;
+        Evaluation alpha, beta1, beta2;
+        inverseOilBTable_[regionIdx].findPoints(i, j1, j2, alpha, beta1, beta2, Rs, pressure, /*extrapolate=*/true);
+
+        const Evaluation& invBo = inverseOilBTable_[regionIdx].eval(i, j1, j2, alpha, beta1, beta2);
+        const Evaluation& invMuoBo = inverseOilBMuTable_[regionIdx].eval(i, j1, j2, alpha, beta1, beta2);
 
         return invBo / invMuoBo;
     }
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-], the inverse of
+     *        the product of formation volume factor and viscosity, the
+     *        viscosity [Pa s] and the saturated gas dissolution factor
+     *        [m^3/m^3] of the fluid phase.
+     *
+     * Locates (Rs, p) in the PVT tables only once.  The results are
+     * identical to those of inverseFormationVolumeFactor(), viscosity()
+     * and saturatedGasDissolutionFactor().
+     */
+    template <class Evaluation>
+    PvtValues<Evaluation> pvtValues(unsigned regionIdx,
+                                    const Evaluation& /*temperature*/,
+                                    const Evaluation& pressure,
+                                    const Evaluation& Rs) const
+    {
+        PvtValues<Evaluation> values;
+
+        // ATTENTION: Rs is the first axis!
+        unsigned i, j1, j2;
+        Evaluation alpha, beta1, beta2;
+        inverseOilBTable_[regionIdx].findPoints(i, j1, j2, alpha, beta1, beta2, Rs, pressure, /*extrapolate=*/true);
+
+        values.invB = inverseOilBTable_[regionIdx].eval(i, j1, j2, alpha, beta1, beta2);
+        values.invBMu = inverseOilBMuTable_[regionIdx].eval(i, j1, j2, alpha, beta1, beta2);
+        values.mu = values.invB / values.invBMu;
+        values.saturatedFactor = saturatedGasDissolutionFactorTable_[regionIdx].eval(pressure, /*extrapolate=*/true);
+
+        return values;
+    }
+
     /*!
      * \brief Returns the dynamic viscosity [Pa s] of the fluid phase given a set of parameters.
      */
@@ -34,6 +34,9 @@
 #include <opm/material/fluidsystems/blackoilpvt/LiveOilPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtThermal.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/ConstantRsDeadOilPvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp>
+
+#include <span>
 
 namespace Opm {
 
@@ -207,6 +210,41 @@ public:
     inverseFormationVolumeFactorAndViscosity(const FluidState& fluidState, unsigned regionIdx)
     { OPM_OIL_PVT_MULTIPLEXER_CALL(return pvtImpl.inverseFormationVolumeFactorAndViscosity(fluidState, regionIdx)); }
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-] and viscosity
+     *        [Pa s] of the fluid phase for a batch of cells.
+     *
+     * Equivalent to calling inverseFormationVolumeFactor() and viscosity()
+     * for each cell, but dispatches on the PVT approach only once for the
+     * whole batch and visits the cells grouped by PVT region.  PVT models
+     * providing pvtValues() locate each cell in their tables only once.
+     * All arrays must have the same size.  The Evaluation type must be
+     * specified explicitly.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactorAndViscosity(std::span<const unsigned> regionIdx,
+                                                  std::span<const Evaluation> temperature,
+                                                  std::span<const Evaluation> pressure,
+                                                  std::span<const Evaluation> Rs,
+                                                  std::span<Evaluation> invB,
+                                                  std::span<Evaluation> mu) const
+    {
+        PvtBatch::checkSizes(regionIdx.size(), temperature, pressure, Rs, invB, mu);
+        OPM_OIL_PVT_MULTIPLEXER_CALL(PvtBatch::forEachCell(regionIdx, [&pvtImpl, &temperature, &pressure, &Rs, &invB, &mu]
+                                                           (const unsigned region, const std::size_t cell)
+        {
+            if constexpr (requires { pvtImpl.pvtValues(region, temperature[cell], pressure[cell], Rs[cell]); }) {
+                const auto values = pvtImpl.pvtValues(region, temperature[cell], pressure[cell], Rs[cell]);
+                invB[cell] = values.invB;
+                mu[cell] = values.mu;
+            }
+            else {
+                invB[cell] = pvtImpl.inverseFormationVolumeFactor(region, temperature[cell], pressure[cell], Rs[cell]);
+                mu[cell] = pvtImpl.viscosity(region, temperature[cell], pressure[cell], Rs[cell]);
+            }
+        }), break);
+    }
+
     /*!
      * \brief Returns the formation volume factor [-] of the fluid phase.
      */
@@ -225,6 +263,27 @@ public:
                                              const Evaluation& pressure) const
     { OPM_OIL_PVT_MULTIPLEXER_CALL(return pvtImpl.saturatedGasDissolutionFactor(regionIdx, temperature, pressure)); }
 
+    /*!
+     * \brief Returns the gas dissolution factor \f$R_s\f$ [m^3/m^3] of
+     *        saturated oil for a batch of cells.
+     *
+     * Batched counterpart of saturatedGasDissolutionFactor(regionIdx,
+     * temperature, pressure).  All arrays must have the same size.
+     */
+    template <class Evaluation>
+    void saturatedGasDissolutionFactor(std::span<const unsigned> regionIdx,
+                                       std::span<const Evaluation> temperature,
+                                       std::span<const Evaluation> pressure,
+                                       std::span<Evaluation> RsSat) const
+    {
+        PvtBatch::checkSizes(regionIdx.size(), temperature, pressure, RsSat);
+        OPM_OIL_PVT_MULTIPLEXER_CALL(PvtBatch::forEachCell(regionIdx, [&pvtImpl, &temperature, &pressure, &RsSat]
+                                                           (const unsigned region, const std::size_t cell)
+        {
+            RsSat[cell] = pvtImpl.saturatedGasDissolutionFactor(region, temperature[cell], pressure[cell]);
+        }), break);
+    }
+
     /*!
      * \brief Returns the gas dissolution factor \f$R_s\f$ [m^3/m^3] of saturated oil.
      */
@@ -0,0 +1,113 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Helpers for evaluating black-oil PVT relations for many cells at
+ *        once.
+ */
+#ifndef OPM_PVT_BATCH_HPP
+#define OPM_PVT_BATCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Opm::PvtBatch {
+
+/*!
+ * \brief Verify that all arrays of a batched PVT evaluation have the same
+ *        number of elements.
+ *
+ * \param numCells Number of cells in batch.  Typically the size of the
+ *        region index array.
+ *
+ * \param arrays Input and output arrays of the batched evaluation.
+ */
+template <class... Arrays>
+void checkSizes(const std::size_t numCells, const Arrays&... arrays)
+{
+    if (((arrays.size() != numCells) || ...)) {
+        throw std::invalid_argument {
+            "Inconsistent array sizes in batched PVT evaluation of "
+            + std::to_string(numCells) + " cells"
+        };
+    }
+}
+
+/*!
+ * \brief Visit all cells of a batched PVT evaluation, grouped by PVT
+ *        region.
+ *
+ * Cells of the same region are visited consecutively, in increasing cell
+ * order, so that a region's tables stay in cache for the duration of that
+ * group.  The common case of all cells belonging to a single region
+ * reduces to a plain loop over the cells.
+ *
+ * \param regionIdx PVT region index of each cell.
+ *
+ * \param cellFunction Call-back invoked as cellFunction(regionIdx, cell)
+ *        for each cell.
+ */
+template <class CellFunction>
+void forEachCell(std::span<const unsigned> regionIdx, CellFunction&& cellFunction)
+{
+    const auto numCells = regionIdx.size();
+    if (numCells == 0) {
+        return;
+    }
+
+    const auto [minRegion, maxRegion] = std::ranges::minmax(regionIdx);
+    if (minRegion == maxRegion) {
+        for (std::size_t cell = 0; cell < numCells; ++cell) {
+            cellFunction(minRegion, cell);
+        }
+
+        return;
+    }
+
+    // Stable counting sort of cells by region.
+    auto start = std::vector<std::size_t>(maxRegion - minRegion + 2, 0);
+    for (const auto region : regionIdx) {
+        ++start[region - minRegion + 1];
+    }
+
+    std::partial_sum(start.begin(), start.end(), start.begin());
+
+    auto order = std::vector<std::size_t>(numCells);
+    for (std::size_t cell = 0; cell < numCells; ++cell) {
+        order[start[regionIdx[cell] - minRegion]++] = cell;
+    }
+
+    for (const auto cell : order) {
+        cellFunction(regionIdx[cell], cell);
+    }
+}
+
+} // namespace Opm::PvtBatch
+
+#endif // OPM_PVT_BATCH_HPP
@@ -0,0 +1,60 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::PvtValues
+ */
+#ifndef OPM_PVT_VALUES_HPP
+#define OPM_PVT_VALUES_HPP
+
+namespace Opm {
+
+/*!
+ * \brief PVT quantities of a single fluid phase in a single cell.
+ *
+ * Returned by the pvtValues() member functions of the tabulated PVT
+ * classes, which locate the cell's position in the PVT tables only once
+ * and reuse the interpolation weights for all quantities.
+ */
+template <class Evaluation>
+struct PvtValues
+{
+    //! Inverse formation volume factor \f$1/B\f$ [-].
+    Evaluation invB{};
+
+    //! Inverse of the product of formation volume factor and viscosity,
+    //! \f$1/(B \mu)\f$ [1/(Pa s)].
+    Evaluation invBMu{};
+
+    //! Dynamic viscosity \f$\mu\f$ [Pa s].
+    Evaluation mu{};
+
+    //! Saturated dissolution or vaporization factor at the cell pressure
+    //! [m^3/m^3].  \f$R_{s,sat}\f$ for live oil, \f$R_{v,sat}\f$ for wet
+    //! and wet humid gas, and \f$R_{vw,sat}\f$ for dry humid gas.
+    Evaluation saturatedFactor{};
+};
+
+} // namespace Opm
+
+#endif // OPM_PVT_VALUES_HPP
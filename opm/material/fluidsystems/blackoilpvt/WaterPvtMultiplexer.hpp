@@ -31,8 +31,11 @@
 #include <opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityWaterPvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityBrinePvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtBatch.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WaterPvtThermal.hpp>
 
+#include <span>
+
 #define OPM_WATER_PVT_MULTIPLEXER_CALL(codeToCall, ...)                                \
     switch (approach_) {                                                               \
     case WaterPvtApproach::ConstantCompressibilityWater: {                             \
@@ -195,6 +198,34 @@ public:
     inverseFormationVolumeFactorAndViscosity(const FluidState& fluidState, unsigned regionIdx)
     { OPM_WATER_PVT_MULTIPLEXER_CALL(return pvtImpl.inverseFormationVolumeFactorAndViscosity(fluidState, regionIdx)); }
 
+    /*!
+     * \brief Returns the inverse formation volume factor [-] and viscosity
+     *        [Pa s] of the fluid phase for a batch of cells.
+     *
+     * Equivalent to calling inverseFormationVolumeFactor() and viscosity()
+     * for each cell, but dispatches on the PVT approach only once for the
+     * whole batch and visits the cells grouped by PVT region.  All arrays
+     * must have the same size.  The Evaluation type must be specified
+     * explicitly.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactorAndViscosity(std::span<const unsigned> regionIdx,
+                                                  std::span<const Evaluation> temperature,
+                                                  std::span<const Evaluation> pressure,
+                                                  std::span<const Evaluation> Rsw,
+                                                  std::span<const Evaluation> saltconcentration,
+                                                  std::span<Evaluation> invB,
+                                                  std::span<Evaluation> mu) const
+    {
+        PvtBatch::checkSizes(regionIdx.size(), temperature, pressure, Rsw, saltconcentration, invB, mu);
+        OPM_WATER_PVT_MULTIPLEXER_CALL(PvtBatch::forEachCell(regionIdx, [&pvtImpl, &temperature, &pressure, &Rsw, &saltconcentration, &invB, &mu]
+                                                             (const unsigned region, const std::size_t cell)
+        {
+            invB[cell] = pvtImpl.inverseFormationVolumeFactor(region, temperature[cell], pressure[cell], Rsw[cell], saltconcentration[cell]);
+            mu[cell] = pvtImpl.viscosity(region, temperature[cell], pressure[cell], Rsw[cell], saltconcentration[cell]);
+        }), break);
+    }
+
         /*!
      * \brief Returns the formation volume factor [-] of the fluid phase.
      */
@@ -366,6 +366,15 @@ void WetGasPvt<Scalar>::initEnd()
         invSatGasBMu.setXYContainers(satPressuresArray, invSatGasBMuArray);
 
         updateSaturationPressure_(regionIdx);
+
+        // the tables are complete, so replace the bisections of the segment
+        // searches during the evaluation by constant time lookups
+        inverseGasB_[regionIdx].buildSegmentLookup();
+        invGasBMu.buildSegmentLookup();
+        invSatGasB.buildSegmentLookup();
+        invSatGasBMu.buildSegmentLookup();
+        saturatedOilVaporizationFactorTable_[regionIdx].buildSegmentLookup();
+        saturationPressure_[regionIdx].buildSegmentLookup();
     }
 }
 
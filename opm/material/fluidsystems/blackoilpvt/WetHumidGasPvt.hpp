@@ -33,6 +33,7 @@
 #include <opm/material/common/MathToolbox.hpp>
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/PvtValues.hpp>
 #include <opm/material/fluidsystems/BlackOilFunctions.hpp>
 
 #include <cstddef>
@@ -153,17 +154,44 @@ public:
     {
         const Evaluation& temperature = 1E30;
 
-        if (Rv >= (1.0 - 1e-10) * saturatedOilVaporizationFactor(regionIdx, temperature, pressure)) {
-            const Evaluation& invBg = inverseGasBRvSat_[regionIdx].eval(pressure, Rvw, /*extrapolate=*/true);
-            const Evaluation& invMugBg = inverseGasBMuRvSat_[regionIdx].eval(pressure, Rvw, /*extrapolate=*/true);
-            return invBg / invMugBg;
-        }
-        else {
-            // for Rv undersaturated viscosity is evaluated at saturated Rvw values
-            const Evaluation& invBg = inverseGasBRvwSat_[regionIdx].eval(pressure, Rv, /*extrapolate=*/true);
-            const Evaluation& invMugBg = inverseGasBMuRvwSat_[regionIdx].eval(pressure, Rv, /*extrapolate=*/true);
-            return invBg / invMugBg;
-        }
+        return this->pvtValues(regionIdx, temperature, pressure, Rv, Rvw).mu;
+    }
+
+    /*!
+     * \brief Returns the inverse formation volume factor [-], the inverse of
+     *        the product of formation volume factor and viscosity, the
+     *        viscosity [Pa s] and the saturated oil vaporization factor
+     *        [m^3/m^3] of the fluid phase.
+     *
+     * Locates the cell's position in the PVT tables only once.  The
+     * results are identical to those of inverseFormationVolumeFactor(),
+     * viscosity() and saturatedOilVaporizationFactor().
+     */
+    template <class Evaluation>
+    PvtValues<Evaluation> pvtValues(unsigned regionIdx,
+                                    const Evaluation& /*temperature*/,
+                                    const Evaluation& pressure,
+                                    const Evaluation& Rv,
+                                    const Evaluation& Rvw) const
+    {
+        PvtValues<Evaluation> values;
+        values.saturatedFactor = saturatedOilVaporizationFactorTable_[regionIdx].eval(pressure, /*extrapolate=*/true);
+
+        // for Rv undersaturated Bg^-1 and viscosity are evaluated at
+        // saturated Rvw values
+        const bool oilSaturated = Rv >= (1.0 - 1e-10) * values.saturatedFactor;
+        const auto& invBTable = oilSaturated ? inverseGasBRvSat_[regionIdx] : inverseGasBRvwSat_[regionIdx];
+        const auto& invBMuTable = oilSaturated ? inverseGasBMuRvSat_[regionIdx] : inverseGasBMuRvwSat_[regionIdx];
+
+        unsigned i, j1, j2;
+        Evaluation alpha, beta1, beta2;
+        invBTable.findPoints(i, j1, j2, alpha, beta1, beta2, pressure, oilSaturated ? Rvw : Rv, /*extrapolate=*/true);
+
+        values.invB = invBTable.eval(i, j1, j2, alpha, beta1, beta2);
+        values.invBMu = invBMuTable.eval(i, j1, j2, alpha, beta1, beta2);
+        values.mu = values.invB / values.invBMu;
+
+        return values;
     }
 
     /*!
@@ -26,6 +26,7 @@
 #include <opm/output/eclipse/EclipseIO.hpp>
 
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/TimingMacros.hpp>
 
 #include <opm/common/utility/TimeService.hpp>
 
@@ -1194,6 +1195,8 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
                                    std::optional<int>   time_step,
                                    const bool           forceFinalWrite)
 {
+    OPM_TIMEFUNCTION();
+
     if (! this->impl->outputEnabled()) {
         // Run does not request any output.  Uncommon, but might be useful
         // in the case of performance testing.
@@ -1243,6 +1246,8 @@ void Opm::EclipseIO::writeTimeStep(const Action::State&      action_state,
                                    std::optional<int>        time_step,
                                    const bool                forceFinalWrite)
 {
+    OPM_TIMEFUNCTION();
+
     if (! this->impl->outputEnabled()) {
         // Run does not request any output.  Uncommon, but might be useful
         // in the case of performance testing.
@@ -32,7 +32,9 @@
 #include <cstddef>
 #include <functional>
 #include <map>
+#include <numeric>
 #include <set>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -49,42 +51,77 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
                                        const EclipseGrid&           grid,
                                        const Schedule&              schedule)
 {
+    this->connection_map.clear();
+    this->well_map.clear();
+    this->connection_slots.clear();
+    this->slot_index.clear();
+
     if (fip_regions.empty()) {
         return;
     }
 
-    auto regions = std::vector<std::reference_wrapper<const std::vector<int>>>{};
-    std::ranges::transform(fip_regions, std::back_inserter(regions),
-                           [&fp](const auto& fipReg)
-                           { return std::cref(fp.get_int(fipReg)); });
-
+    // Connection slots: all active cell connections, in well order.
+    auto active_cells = std::vector<std::size_t>{};
     for (const auto& wname : schedule.back().well_order()) {
-        const auto& conns = schedule.back().wells(wname).getConnections();
-        if (conns.empty()) { continue; }
+        for (const auto& conn : schedule.back().wells(wname).getConnections()) {
+            if (! grid.cellActive(conn.global_index())) {
+                continue;
+            }
 
-        auto regID = regions.begin();
-        for (const auto& fipReg : fip_regions) {
-            auto first = true;
+            this->connection_slots.emplace_back(wname, conn.global_index());
+            active_cells.push_back(grid.activeIndex(conn.global_index()));
+        }
+    }
 
-            for (const auto& conn : conns) {
-                if (! grid.cellActive(conn.global_index())) {
-                    continue;
-                }
+    const auto num_slots = this->connection_slots.size();
 
-                const auto region = regID->get()[grid.activeIndex(conn.global_index())];
-                const auto reg_pair = std::make_pair(fipReg, region);
+    for (const auto& fipReg : fip_regions) {
+        const auto& region = fp.get_int(fipReg);
 
-                this->connection_map[reg_pair]
-                    .emplace_back(wname, conn.global_index());
+        auto slot_region_id = std::vector<int>(num_slots);
+        std::ranges::transform(active_cells, slot_region_id.begin(),
+                               [&region](const std::size_t cell)
+                               { return region[cell]; });
 
-                if (first) {
-                    this->well_map[reg_pair].push_back(wname);
+        auto& index = this->slot_index[fipReg];
 
-                    first = false;
-                }
-            }
+        index.regions = slot_region_id;
+        std::ranges::sort(index.regions);
+        index.regions.erase(std::unique(index.regions.begin(), index.regions.end()),
+                            index.regions.end());
+
+        // Stable counting sort of slots by region.  Preserves well and
+        // connection order within each region.
+        index.slot_region.resize(num_slots);
+        index.start.assign(index.regions.size() + 1, 0);
+        for (auto slot = 0*num_slots; slot < num_slots; ++slot) {
+            const auto pos = static_cast<std::size_t>
+                (std::ranges::lower_bound(index.regions, slot_region_id[slot])
+                 - index.regions.begin());
+
+            index.slot_region[slot] = pos;
+            ++index.start[pos + 1];
+        }
+
+        std::partial_sum(index.start.begin(), index.start.end(), index.start.begin());
+
+        index.slots.resize(num_slots);
+        auto fill = std::vector<std::size_t>(index.start.begin(), index.start.end() - 1);
+        for (auto slot = 0*num_slots; slot < num_slots; ++slot) {
+            index.slots[fill[index.slot_region[slot]]++] = slot;
+        }
+
+        // Per-region connection and well lists.  A well is assigned to the
+        // region of its first active connection.
+        for (auto slot = 0*num_slots; slot < num_slots; ++slot) {
+            const auto& wconn = this->connection_slots[slot];
+            const auto reg_pair = std::make_pair(fipReg, slot_region_id[slot]);
+
+            this->connection_map[reg_pair].push_back(wconn);
 
-            ++regID;
+            if ((slot == 0) || (this->connection_slots[slot - 1].first != wconn.first)) {
+                this->well_map[reg_pair].push_back(wconn.first);
+            }
         }
     }
 }
@@ -113,3 +150,35 @@ Opm::out::RegionCache::wells(const std::string& region_name,
         ? std::vector<std::string> {}
         : iter->second;
 }
+
+const Opm::out::RegionCache::SlotIndex*
+Opm::out::RegionCache::slotIndex(const std::string& region_name) const
+{
+    auto iter = this->slot_index.find(region_name);
+
+    return (iter == this->slot_index.end())
+        ? nullptr
+        : &iter->second;
+}
+
+std::span<const std::size_t>
+Opm::out::RegionCache::regionSlots(const std::string& region_name,
+                                   const int          region_id) const
+{
+    const auto* index = this->slotIndex(region_name);
+    if (index == nullptr) {
+        return {};
+    }
+
+    auto pos = std::ranges::lower_bound(index->regions, region_id);
+    if ((pos == index->regions.end()) || (*pos != region_id)) {
+        return {};
+    }
+
+    const auto i = pos - index->regions.begin();
+
+    return std::span<const std::size_t> {
+        index->slots.data() + index->start[i],
+        index->start[i + 1] - index->start[i]
+    };
+}
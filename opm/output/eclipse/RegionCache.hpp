@@ -23,7 +23,9 @@
 #include <cstddef>
 #include <map>
 #include <set>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -35,6 +37,31 @@ namespace Opm {
 namespace Opm { namespace out {
     class RegionCache {
     public:
+        using WellConn = std::pair<std::string, std::size_t>; // { Well name, cell ID }
+
+        /// Inverted index from region ID to connection slots--i.e.,
+        /// positions in connectionSlots()--for a single region set.
+        ///
+        /// Compressed sparse row format.  The slots of region regions[i]
+        /// are slots[start[i] .. start[i + 1]), in the same order as the
+        /// corresponding connections(region_name, regions[i]).
+        struct SlotIndex
+        {
+            /// Sorted unique region IDs of all active connections.
+            std::vector<int> regions{};
+
+            /// Start pointers into 'slots'.  Size regions.size() + 1.
+            std::vector<std::size_t> start{};
+
+            /// Connection slots, grouped by region.
+            std::vector<std::size_t> slots{};
+
+            /// Position in 'regions' of each connection slot's region.
+            /// Enables scatter-add accumulation in a single pass over the
+            /// connection slots.
+            std::vector<std::size_t> slot_region{};
+        };
+
         RegionCache() = default;
         RegionCache(const std::set<std::string>& fip_regions,
                     const FieldPropsManager&     fp,
@@ -52,11 +79,27 @@ namespace Opm { namespace out {
         // A well is assigned to the region_id of its first connection.
         std::vector<std::string> wells(const std::string& region_name, int region_id) const;
 
+        // All active cell connections of all wells, in well order.
+        const std::vector<WellConn>& connectionSlots() const
+        {
+            return this->connection_slots;
+        }
+
+        // Inverted region index of a region set.  Nullptr if the region set
+        // is not known to the cache.
+        const SlotIndex* slotIndex(const std::string& region_name) const;
+
+        // Connection slots of a single region.  Empty if the region has no
+        // active connections.
+        std::span<const std::size_t>
+        regionSlots(const std::string& region_name, int region_id) const;
+
     private:
         using RegID = std::pair<std::string, int>;            // { Region set, region ID }
-        using WellConn = std::pair<std::string, std::size_t>; // { Well name, cell ID }
 
         std::vector<WellConn> connections_empty{};
+        std::vector<WellConn> connection_slots{};
+        std::map<std::string, SlotIndex> slot_index{};
         std::map<RegID, std::vector<WellConn>> connection_map{};
         std::map<RegID, std::vector<std::string>> well_map{};
     };
@@ -24,6 +24,7 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/KeywordLocation.hpp>
+#include <opm/common/TimingMacros.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
@@ -660,6 +661,208 @@ struct quantity {
 };
 
 
+/// Efficiency factor of a single well, including the efficiency factors
+/// of all groups in the well's flow group tree.
+///
+/// \param[in] stop_group Name of group at which to stop the upwards
+///   traversal of the group tree, excluding that group's efficiency
+///   factor.  Nullptr to include the factors of all groups up to and
+///   including FIELD.
+double wellEfficiencyFactor(const Opm::Schedule&    schedule,
+                            const Opm::Well&        well,
+                            const int               sim_step,
+                            const Opm::data::Wells& sim_res,
+                            const std::string*      stop_group = nullptr)
+{
+    const auto res_it = sim_res.find(well.name());
+    double efficiency_scaling_factor = 1.0;
+    if (res_it != sim_res.end()) {
+        efficiency_scaling_factor = res_it->second.efficiency_scaling_factor;
+    }
+
+    double eff_factor = well.getEfficiencyFactor() * efficiency_scaling_factor;
+    const auto* group_ptr = std::addressof(schedule.getGroup(well.groupName(), sim_step));
+
+    while (group_ptr) {
+        if ((stop_group != nullptr) && (group_ptr->name() == *stop_group))
+            break;
+
+        eff_factor *= group_ptr->getGroupEfficiencyFactor();
+
+        const auto parent_group = group_ptr->flow_group();
+
+        if (parent_group.has_value())
+            group_ptr = std::addressof(schedule.getGroup( parent_group.value(), sim_step ));
+        else
+            group_ptr = nullptr;
+    }
+
+    return eff_factor;
+}
+
+/// Region level surface rates (ROPR, RWIT &c) of all regions at a single
+/// report step.
+///
+/// Evaluated on first request in a single pass over all well connections
+/// of the region cache, with one scatter-add into per-region sums for
+/// each region set.  Replaces traversing the connections of each region
+/// once for every region level summary vector.  Connections are
+/// accumulated in the same order as in the per-region traversal so the
+/// resulting sums are identical.
+class RegionRates
+{
+public:
+    explicit RegionRates(const Opm::out::RegionCache& regionCache,
+                         const Opm::Schedule&         schedule,
+                         const int                    sim_step,
+                         const Opm::data::Wells&      wells)
+        : regionCache_ { regionCache }
+        , schedule_    { schedule }
+        , sim_step_    { sim_step }
+        , wells_       { wells }
+    {}
+
+    /// Sum of injection or production rates, including efficiency
+    /// factors, of all connections in a single region.  Production rates
+    /// are negative.
+    double get(const std::string& region_set,
+               const int          region_id,
+               const rt           phase,
+               const bool         injection) const
+    {
+        const auto* index = this->regionCache_.slotIndex(region_set);
+        if (index == nullptr) {
+            return 0.0;
+        }
+
+        const auto pos = std::ranges::lower_bound(index->regions, region_id);
+        if ((pos == index->regions.end()) || (*pos != region_id)) {
+            return 0.0;
+        }
+
+        const auto& totals = this->regionTotals(region_set, *index, phase);
+        const auto i = pos - index->regions.begin();
+
+        return injection ? totals.injection[i] : totals.production[i];
+    }
+
+private:
+    struct Totals
+    {
+        std::vector<double> injection{};
+        std::vector<double> production{};
+    };
+
+    const Opm::out::RegionCache& regionCache_;
+    const Opm::Schedule& schedule_;
+    int sim_step_{};
+    const Opm::data::Wells& wells_;
+
+    /// Simulated connection results of each connection slot.  Nullptr if
+    /// the simulator did not report results for that connection.
+    mutable std::vector<const Opm::data::Connection*> slotResults_{};
+
+    /// Efficiency factor of each connection slot's well.
+    mutable std::vector<double> slotFactors_{};
+
+    mutable bool slotsPrepared_{false};
+
+    mutable std::map<std::pair<std::string, rt>, Totals> totals_{};
+
+    void prepareSlots() const
+    {
+        const auto& slots = this->regionCache_.connectionSlots();
+
+        this->slotResults_.assign(slots.size(), nullptr);
+        this->slotFactors_.assign(slots.size(), 1.0);
+
+        // Slots are grouped by well, so look up each well only once.
+        for (auto begin = 0*slots.size(); begin < slots.size(); ) {
+            const auto& wname = slots[begin].first;
+
+            auto end = begin + 1;
+            while ((end < slots.size()) && (slots[end].first == wname)) {
+                ++end;
+            }
+
+            const auto factor = this->efficiencyFactor(wname);
+
+            const auto xwPos = this->wells_.find(wname);
+            for (auto slot = begin; slot < end; ++slot) {
+                this->slotFactors_[slot] = factor;
+
+                if (xwPos == this->wells_.end()) {
+                    continue;
+                }
+
+                const auto& conns = xwPos->second.connections;
+                const auto conn = std::ranges::find_if(conns,
+                    [cell = slots[slot].second](const Opm::data::Connection& c)
+                    { return c.index == cell; });
+
+                if (conn != conns.end()) {
+                    this->slotResults_[slot] = &*conn;
+                }
+            }
+
+            begin = end;
+        }
+    }
+
+    double efficiencyFactor(const std::string& wname) const
+    {
+        const auto& schedule = this->schedule_;
+
+        if (! schedule.hasWell(wname, this->sim_step_)) {
+            return 1.0;
+        }
+
+        const auto& well = schedule.getWell(wname, this->sim_step_);
+        if (! well.hasBeenDefined(this->sim_step_)) {
+            return 1.0;
+        }
+
+        return wellEfficiencyFactor(schedule, well, this->sim_step_, this->wells_);
+    }
+
+    const Totals& regionTotals(const std::string&                       region_set,
+                               const Opm::out::RegionCache::SlotIndex& index,
+                               const rt                                 phase) const
+    {
+        auto totPos = this->totals_.find(std::make_pair(region_set, phase));
+        if (totPos != this->totals_.end()) {
+            return totPos->second;
+        }
+
+        if (! this->slotsPrepared_) {
+            this->prepareSlots();
+            this->slotsPrepared_ = true;
+        }
+
+        auto& totals = this->totals_[std::make_pair(region_set, phase)];
+        totals.injection.assign(index.regions.size(), 0.0);
+        totals.production.assign(index.regions.size(), 0.0);
+
+        for (auto slot = 0*index.slot_region.size(); slot < index.slot_region.size(); ++slot) {
+            const auto* conn = this->slotResults_[slot];
+            const double Rate = ((conn != nullptr) ? conn->rates.get(phase, 0.0) : 0.0)
+                * this->slotFactors_[slot];
+
+            // Clamped rates contribute zero to the other total, exactly as
+            // in the per-region traversal.
+            const auto reg = index.slot_region[slot];
+            totals.injection [reg] += (Rate > 0) ? Rate : 0.0;
+            totals.production[reg] += (Rate > 0) ? 0.0 : Rate;
+        }
+
+        for (auto& prod : totals.production) {
+            prod = -prod;
+        }
+
+        return totals;
+    }
+};
+
 /*
  * All functions must have the same parameters, so they're gathered in a struct
  * and functions use whatever information they care about.
@@ -689,6 +892,10 @@ struct fn_args
     const Opm::UnitSystem& unit_system;
     const Opm::data::ReservoirCouplingGroupRates* rc_rates{nullptr};
 
+    // Region level rates of all regions at this report step.  Nullptr if
+    // not available, e.g., when inferring units.
+    const RegionRates* region_rates{nullptr};
+
     // When set, restrict per-connection lookups (e.g. crate<>) to the
     // connection identified by (lgr_grid_filter, lgr_cell_filter) instead
     // of the (num-1)-derived global Cartesian.  Used by the LC* dispatch
@@ -2306,6 +2513,14 @@ quantity region_rate( const fn_args& args )
         return { sum, rate_unit<phase>() };
     }
 
+    if (args.region_rates != nullptr) {
+        return {
+            args.region_rates->get(std::get<std::string>(*args.extra_data),
+                                   args.num, phase, injection),
+            rate_unit<phase>()
+        };
+    }
+
     const auto& well_connections = args.regionCache.connections( std::get<std::string>(*args.extra_data), args.num );
 
     for (const auto& pair : well_connections) {
@@ -4267,34 +4482,16 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
     if (!is_field && !is_group && !is_region && is_rate)
         return;
 
+    const auto* stop_group = (is_group && is_rate)
+        ? std::addressof(node.wgname) : nullptr;
+
     for (const auto* well : schedule_wells) {
         if (!well->hasBeenDefined(sim_step))
             continue;
 
-        const auto res_it = sim_res.find(well->name());
-        double efficiency_scaling_factor = 1.0;
-        if (res_it != sim_res.end()) {
-            efficiency_scaling_factor = res_it->second.efficiency_scaling_factor;
-        }
-
-        double eff_factor = well->getEfficiencyFactor() * efficiency_scaling_factor;
-        const auto* group_ptr = std::addressof(schedule.getGroup(well->groupName(), sim_step));
-
-        while (group_ptr) {
-            if (is_group && is_rate && (group_ptr->name() == node.wgname))
-                break;
-
-            eff_factor *= group_ptr->getGroupEfficiencyFactor();
-
-            const auto parent_group = group_ptr->flow_group();
-
-            if (parent_group.has_value())
-                group_ptr = std::addressof(schedule.getGroup( parent_group.value(), sim_step ));
-            else
-                group_ptr = nullptr;
-        }
-
-        this->factors.emplace_back(well->name(), eff_factor);
+        this->factors.emplace_back(well->name(),
+                                   wellEfficiencyFactor(schedule, *well, sim_step,
+                                                        sim_res, stop_group));
     }
 }
 
@@ -4321,6 +4518,7 @@ namespace Evaluator {
         const Opm::data::Aquifers& aquifers;
         const std::unordered_map<std::string, Opm::data::InterRegFlowMap>& ireg;
         const Opm::data::ReservoirCouplingGroupRates* rc_rates;
+        const RegionRates* region_rates{nullptr};
     };
 
     class Base
@@ -4369,7 +4567,12 @@ namespace Evaluator {
                 return;
             }
 
-            const auto wells = need_wells(this->node_)
+            // Region level rates include the efficiency factors directly
+            // when available so skip the per-region well search.
+            const auto use_region_rates = (simRes.region_rates != nullptr)
+                && (this->node_.category == Opm::EclIO::SummaryNode::Category::Region);
+
+            const auto wells = !use_region_rates && need_wells(this->node_)
                 ? find_wells(input.sched, this->node_,
                              static_cast<int>(sim_step), input.reg)
                 : std::vector<const Opm::Well*>{};
@@ -4387,7 +4590,8 @@ namespace Evaluator {
                 std::move(eFac.factors),
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits(),
-                simRes.rc_rates
+                simRes.rc_rates,
+                simRes.region_rates
             };
 
             const auto& usys = input.es.getUnits();
@@ -4533,6 +4737,7 @@ namespace Evaluator {
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits(),
                 simRes.rc_rates,
+                /*region_rates=*/nullptr,
                 /*lgr_grid_filter=*/lgr_id,
                 /*lgr_cell_filter=*/gridLocalCellIndex,
             };
@@ -6224,6 +6429,10 @@ eval(const int                    sim_step,
     const auto& well_solution = (values.well_solution != nullptr)
         ? *values.well_solution : data::Wells{};
 
+    const auto region_rates = RegionRates {
+        this->regCache_, this->sched_, sim_step, well_solution
+    };
+
     const auto& wbp = (values.wbp != nullptr)
         ? *values.wbp : data::WellBlockAveragePressures{};
 
@@ -6259,7 +6468,8 @@ eval(const int                    sim_step,
         lgr_block_values,
         aquifer_values,
         interreg_flows,
-        values.rc_group_rates
+        values.rc_group_rates,
+        &region_rates
     };
 
     for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
@@ -6754,6 +6964,8 @@ void Summary::eval(const int                    report_step,
                    const DynamicSimulatorState& values,
                    SummaryState&                st) const
 {
+    OPM_TIMEFUNCTION();
+
     // Report_step is the one-based sequence number of the containing report.
     // Report_step = 0 for the initial condition, before simulation starts.
     // We typically don't get reports_step = 0 here.  When outputting
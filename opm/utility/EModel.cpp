@@ -22,7 +22,9 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <filesystem>
 #include <iterator>
@@ -31,6 +33,145 @@
 using EclEntry = std::tuple<std::string, Opm::EclIO::eclArrType, long int>;
 using ParamEntry = std::tuple<std::string, Opm::EclIO::eclArrType>;
 
+namespace {
+
+    constexpr std::size_t cellsPerWord = 64;
+
+    // Bit i set if keep(values[i]).  Branch free, so the compiler is able
+    // to vectorise the loop.
+    template <typename T, typename Keep>
+    std::uint64_t matchingCells(const T* values, const std::size_t n, Keep keep)
+    {
+        auto bits = std::uint64_t{0};
+
+        for (std::size_t i = 0; i < n; i++)
+            bits |= static_cast<std::uint64_t>(keep(values[i])) << i;
+
+        return bits;
+    }
+
+    bool isGridIndex(const std::string& param)
+    {
+        return (param == "I") || (param == "ROW") ||
+            (param == "J") || (param == "COLUMN") ||
+            (param == "K") || (param == "LAYER");
+    }
+
+    std::map<std::string, int> solutionArrays(Opm::EclIO::ERst& rstfile, int rstep, std::size_t nActive)
+    {
+        std::map<std::string, int> arrays;
+
+        auto rstArrList = rstfile.listOfRstArrays(rstep);
+
+        bool solparam = false;
+
+        for (std::size_t n = 0; n < rstArrList.size(); n++) {
+            std::string name = std::get<0>(rstArrList[n]);
+            auto sizeArray = std::get<2>(rstArrList[n]);
+
+            if (name == "ENDSOL")
+                solparam = false;
+
+            if ((solparam == true) && (static_cast<std::size_t>(sizeArray) == nActive))
+                arrays[name] = n;
+
+            if (name == "STARTSOL")
+                solparam = true;
+        }
+
+        return arrays;
+    }
+
+} // Anonymous namespace
+
+// Filter criterion with its parameter resolved to the cell values.
+struct EModel::BoundPredicate
+{
+    FilterPipeline::Operator op;
+
+    const int* intValues = nullptr;
+    std::pair<int, int> intBounds{};
+
+    const float* floatValues = nullptr;
+    std::pair<float, float> floatBounds{};
+
+    std::uint64_t match(std::size_t begin, std::size_t n) const
+    {
+        if (intValues != nullptr)
+            return match(intValues + begin, n, intBounds);
+        else
+            return match(floatValues + begin, n, floatBounds);
+    }
+
+    // Cells are kept unless they fail the comparison, as in the original
+    // filter loops, which also decides the outcome for NaN values.
+    template <typename T>
+    std::uint64_t match(const T* values, std::size_t n, const std::pair<T, T>& bounds) const
+    {
+        const auto [value1, value2] = bounds;
+
+        switch (op) {
+        case FilterPipeline::Operator::Eq:
+            return matchingCells(values, n, [value1](const T v) { return !(v != value1); });
+
+        case FilterPipeline::Operator::Lt:
+            return matchingCells(values, n, [value1](const T v) { return !(v >= value1); });
+
+        case FilterPipeline::Operator::Gt:
+            return matchingCells(values, n, [value1](const T v) { return !(v <= value1); });
+
+        case FilterPipeline::Operator::Between:
+            return matchingCells(values, n, [value1, value2](const T v)
+            { return !((v <= value1) | (v >= value2)); });
+        }
+
+        return 0;
+    }
+};
+
+template <typename T>
+EModel::FilterPipeline&
+EModel::FilterPipeline::add(const std::string& param, const std::string& opperator, T num)
+{
+    Operator op;
+
+    if ((opperator == "eq") || (opperator == "=="))
+        op = Operator::Eq;
+    else if ((opperator == "lt") || (opperator == "<"))
+        op = Operator::Lt;
+    else if ((opperator == "gt") || (opperator == ">"))
+        op = Operator::Gt;
+    else {
+        const std::string message =
+            fmt::format("Unknown operator {} used to set filter", opperator);
+        throw std::invalid_argument(message);
+    }
+
+    predicates.push_back({ param, op, std::pair { num, num } });
+
+    return *this;
+}
+
+template <typename T>
+EModel::FilterPipeline&
+EModel::FilterPipeline::add(const std::string& param, const std::string& opperator, T num1, T num2)
+{
+    if ((opperator != "in") && (opperator != "between")) {
+        const std::string message =
+            fmt::format("Unknown operator {} used to set filter", opperator);
+        throw std::invalid_argument(message);
+    }
+
+    predicates.push_back({ param, Operator::Between, std::pair { num1, num2 } });
+
+    return *this;
+}
+
+template EModel::FilterPipeline& EModel::FilterPipeline::add<int>(const std::string&, const std::string&, int);
+template EModel::FilterPipeline& EModel::FilterPipeline::add<float>(const std::string&, const std::string&, float);
+template EModel::FilterPipeline& EModel::FilterPipeline::add<int>(const std::string&, const std::string&, int, int);
+template EModel::FilterPipeline& EModel::FilterPipeline::add<float>(const std::string&, const std::string&, float, float);
+
 
 EModel::EModel(const std::string& filename) :
     initfile(filename)
@@ -70,7 +211,7 @@ EModel::EModel(const std::string& filename) :
     J.reserve(nActive);
     K.reserve(nActive);
 
-    ActFilter.resize(nActive, true);
+    ActFilter = allCells();
 
     std::vector<float> porv_all = initfile.get<float>("PORV");
 
@@ -223,7 +364,17 @@ std::vector<ParamEntry> EModel::getListOfParameters() const
 
 int EModel::getNumberOfActiveCells()
 {
-    return std::ranges::count(ActFilter, true);
+    return countCells(ActFilter);
+}
+
+std::size_t EModel::countCells(const CellMask& mask)
+{
+    std::size_t count = 0;
+
+    for (const auto word : mask)
+        count += std::popcount(word);
+
+    return count;
 }
 
 bool EModel::hasInitParameter(const std::string &name) const
@@ -256,53 +407,9 @@ bool EModel::hasReportStep(int rstep)
 void EModel::resetFilter()
 {
     activeFilter = false;
-    std::fill(ActFilter.begin(), ActFilter.end(), true);
-}
-
-
-template <typename T>
-void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value)
-{
-    if ((opperator == "eq") || (opperator == "==")){
-       for (std::size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] != value))
-                ActFilter[i] = false;
-
-    } else if ((opperator=="lt") || (opperator=="<")) {
-        for (std::size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] >= value))
-                ActFilter[i] = false;
-
-    } else if ((opperator == "gt") || (opperator == ">")){
-        for (std::size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] <= value))
-                ActFilter[i] = false;
-
-    } else {
-        const std::string message =
-            fmt::format("Unknown operator {} used to set filter", opperator);
-        throw std::invalid_argument(message);
-    }
-
-    activeFilter = true;
+    ActFilter = allCells();
 }
 
-template <typename T>
-void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2)
-{
-    if ((opperator == "in") || (opperator == "between")) {
-        for (std::size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && ((paramVect[i] <= value1) || (paramVect[i] >= value2)))
-                ActFilter[i] = false;
-
-    } else {
-        const std::string message =
-            fmt::format("Unknown operator {} used to set filter", opperator);
-        throw std::invalid_argument(message);
-    }
-
-    activeFilter = true;
-}
 
 template <typename T>
 const std::vector<T>& EModel::get_filter_param(const std::string& param)
@@ -348,30 +455,184 @@ const std::vector<T>& EModel::get_filter_param(const std::string& param)
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);
-    updateActiveFilter(paramVect, opperator, num);
+    addFilter(FilterPipeline{}.add(param1, opperator, num));
 }
 
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num1, int num2)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);;
-    updateActiveFilter(paramVect, opperator, num1, num2);
+    addFilter(FilterPipeline{}.add(param1, opperator, num1, num2));
 }
 
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
-    updateActiveFilter(paramVect, opperator, num);
+    addFilter(FilterPipeline{}.add(param1, opperator, num));
 }
 
 
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num1, float num2)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
-    updateActiveFilter(paramVect, opperator, num1, num2);
+    addFilter(FilterPipeline{}.add(param1, opperator, num1, num2));
+}
+
+
+void EModel::addFilter(const FilterPipeline& filter)
+{
+    const auto solution = (activeReportStep == -1)
+        ? std::map<std::string, int>{}
+        : solutionArrays(*rstfile, activeReportStep, nActive);
+
+    auto predicates = bindPredicates(filter, true, solution, activeReportStep);
+    auto solutionPredicates = bindPredicates(filter, false, solution, activeReportStep);
+    predicates.insert(predicates.end(), solutionPredicates.begin(), solutionPredicates.end());
+
+    applyPredicates(predicates, ActFilter);
+    activeFilter = true;
+}
+
+
+EModel::CellMask EModel::evaluateFilter(const FilterPipeline& filter)
+{
+    auto mask = allCells();
+
+    const auto solution = (activeReportStep == -1)
+        ? std::map<std::string, int>{}
+        : solutionArrays(*rstfile, activeReportStep, nActive);
+
+    auto predicates = bindPredicates(filter, true, solution, activeReportStep);
+    auto solutionPredicates = bindPredicates(filter, false, solution, activeReportStep);
+    predicates.insert(predicates.end(), solutionPredicates.begin(), solutionPredicates.end());
+
+    applyPredicates(predicates, mask);
+
+    return mask;
+}
+
+
+std::vector<EModel::CellMask>
+EModel::evaluateFilter(const FilterPipeline& filter, const std::vector<int>& rsteps)
+{
+    for (const auto rstep : rsteps) {
+        if (!hasReportStep(rstep)) {
+            const std::string message =
+                fmt::format("report step {} not found in restart file", rstep);
+            throw std::invalid_argument(message);
+        }
+    }
+
+    auto initMask = allCells();
+    applyPredicates(bindPredicates(filter, true, {}, -1), initMask);
+
+    std::vector<CellMask> masks;
+    masks.reserve(rsteps.size());
+
+    for (const auto rstep : rsteps) {
+        auto& mask = masks.emplace_back(initMask);
+
+        const auto solution = solutionArrays(*rstfile, rstep, nActive);
+        applyPredicates(bindPredicates(filter, false, solution, rstep), mask);
+
+        if (rstep != activeReportStep)
+            rstfile->unloadReportStepNumber(rstep);
+    }
+
+    return masks;
+}
+
+
+EModel::CellMask EModel::allCells() const
+{
+    CellMask mask((nActive + cellsPerWord - 1) / cellsPerWord, ~std::uint64_t{0});
+
+    if (const auto rest = nActive % cellsPerWord; rest != 0)
+        mask.back() = (std::uint64_t{1} << rest) - 1;
+
+    return mask;
+}
+
+
+std::vector<EModel::BoundPredicate>
+EModel::bindPredicates(const FilterPipeline& filter, const bool init,
+                       const std::map<std::string, int>& solution,
+                       const int rstep)
+{
+    std::vector<BoundPredicate> predicates;
+
+    for (const auto& predicate : filter.predicates) {
+        const bool isInit = isGridIndex(predicate.param) || (predicate.param == "PORV") ||
+            (predicate.param == "CELLVOL") || hasInitParameter(predicate.param);
+
+        if (isInit != init)
+            continue;
+
+        auto& bound = predicates.emplace_back();
+        bound.op = predicate.op;
+
+        if (const auto* bounds = std::get_if<std::pair<int, int>>(&predicate.bounds)) {
+            bound.intValues = get_filter_param<int>(predicate.param).data();
+            bound.intBounds = *bounds;
+            continue;
+        }
+
+        bound.floatBounds = std::get<std::pair<float, float>>(predicate.bounds);
+
+        if (init) {
+            bound.floatValues = get_filter_param<float>(predicate.param).data();
+            continue;
+        }
+
+        auto search = solution.find(predicate.param);
+
+        if (search == solution.end()) {
+            const std::string message =
+                fmt::format("parameter {}, used to set filter, could not be found",
+                            predicate.param);
+            throw std::invalid_argument(message);
+        }
+
+        bound.floatValues = rstfile->getRestartData<float>(search->second, rstep).data();
+    }
+
+    return predicates;
+}
+
+
+void EModel::applyPredicates(const std::vector<BoundPredicate>& predicates, CellMask& mask) const
+{
+    if (predicates.empty())
+        return;
+
+#pragma omp parallel for schedule(static) if (mask.size() >= (std::size_t{1} << 12))
+    for (std::size_t w = 0; w < mask.size(); w++) {
+        const auto begin = w * cellsPerWord;
+        const auto n = std::min(cellsPerWord, nActive - begin);
+
+        auto word = mask[w];
+
+        for (const auto& predicate : predicates) {
+            if (word == 0)
+                break;
+
+            word &= predicate.match(begin, n);
+        }
+
+        mask[w] = word;
+    }
+}
+
+
+template <typename T>
+void EModel::extractFiltered(const std::vector<T>& param, std::vector<T>& filtered) const
+{
+    filtered.clear();
+    filtered.reserve(countCells(ActFilter));
+
+    for (std::size_t w = 0; w < ActFilter.size(); w++) {
+        for (auto word = ActFilter[w]; word != 0; word &= word - 1)
+            filtered.push_back(param[w * cellsPerWord + std::countr_zero(word)]);
+    }
 }
 
 
@@ -390,8 +651,8 @@ void EModel::addHCvolFilter()
         int eql = eqlnum[n];
         float fwl = FreeWaterlevel[eql-1];
 
-        if ((ActFilter[n]) && (depth[n] > fwl))
-            ActFilter[n] = false;
+        if (depth[n] > fwl)
+            ActFilter[n / cellsPerWord] &= ~(std::uint64_t{1} << (n % cellsPerWord));
     }
 }
 
@@ -400,13 +661,7 @@ template <>
 const std::vector<float>& EModel::getParam<float>(const std::string& name)
 {
     if (activeFilter) {
-        std::vector<float> param = get_filter_param<float>(name);
-        filteredFloatVect.clear();
-
-        for (std::size_t i = 0; i < param.size(); i++)
-            if (ActFilter[i])
-                filteredFloatVect.push_back(param[i]);
-
+        extractFiltered(get_filter_param<float>(name), filteredFloatVect);
         return filteredFloatVect;
 
     } else {
@@ -420,13 +675,7 @@ template <>
 const std::vector<int>& EModel::getParam<int>(const std::string& name)
 {
     if (activeFilter) {
-        std::vector<int> param = get_filter_param<int>(name);
-        filteredIntVect.clear();
-
-        for (std::size_t i = 0; i < param.size(); i++)
-            if (ActFilter[i])
-                filteredIntVect.push_back(param[i]);
-
+        extractFiltered(get_filter_param<int>(name), filteredIntVect);
         return filteredIntVect;
 
     } else {
@@ -25,15 +25,51 @@
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <map>
 #include <string>
+#include <utility>
+#include <variant>
 #include <vector>
 
 class EModel
 {
 public:
 
+    // Packed selection of active cells, one bit per cell and 64 cells
+    // per word.
+    using CellMask = std::vector<std::uint64_t>;
+
+    // List of filter criteria, combined with logical and.  Parameters
+    // and operators are the same as for addFilter().  All criteria are
+    // evaluated together, in a single pass over the cells.
+    class FilterPipeline
+    {
+    public:
+        template <typename T>
+        FilterPipeline& add(const std::string& param, const std::string& opperator, T num);
+
+        template <typename T>
+        FilterPipeline& add(const std::string& param, const std::string& opperator, T num1, T num2);
+
+        bool empty() const { return predicates.empty(); }
+
+    private:
+        friend class EModel;
+
+        enum class Operator { Eq, Lt, Gt, Between };
+
+        struct Predicate
+        {
+            std::string param;
+            Operator op;
+            std::variant<std::pair<int, int>, std::pair<float, float>> bounds;
+        };
+
+        std::vector<Predicate> predicates;
+    };
+
     explicit EModel(const std::string& filename);
 
     bool hasParameter(const std::string &name) const;
@@ -57,6 +93,20 @@ public:
     template <typename T>
     void addFilter(const std::string& param1, const std::string& opperator, T num1, T num2);
 
+    void addFilter(const FilterPipeline& filter);
+
+    // Cells selected by filter, at active report step.  Not combined
+    // with the active filter.
+    CellMask evaluateFilter(const FilterPipeline& filter);
+
+    // Cells selected by filter at each of the report steps.  Criteria on
+    // init parameters are evaluated once, and solution arrays are read
+    // one report step at a time and released after use, except for those
+    // of the active report step.
+    std::vector<CellMask> evaluateFilter(const FilterPipeline& filter, const std::vector<int>& rsteps);
+
+    static std::size_t countCells(const CellMask& mask);
+
     void setDepthfwl(const std::vector<float>& fwl);
 
     void addHCvolFilter();
@@ -80,7 +130,7 @@ private:
     std::vector<float> PORV;
     std::vector<float> CELLVOL;
     std::vector<int> I, J, K;
-    std::vector<bool> ActFilter;
+    CellMask ActFilter;
 
     Opm::EclIO::EclFile initfile;
     std::optional<Opm::EclipseGrid> grid;
@@ -112,11 +162,18 @@ private:
     template <typename T>
     const std::vector<T>& get_filter_param(const std::string& param1);
 
-    template <typename T>
-    void updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value);
+    struct BoundPredicate;
+
+    CellMask allCells() const;
+
+    std::vector<BoundPredicate> bindPredicates(const FilterPipeline& filter, bool init,
+                                               const std::map<std::string, int>& solution,
+                                               int rstep);
+
+    void applyPredicates(const std::vector<BoundPredicate>& predicates, CellMask& mask) const;
 
     template <typename T>
-    void updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2);
+    void extractFiltered(const std::vector<T>& param, std::vector<T>& filtered) const;
 
 };
 
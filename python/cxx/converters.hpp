@@ -1,7 +1,14 @@
 #ifndef SUNBEAM_CONVERTERS_HPP
 #define SUNBEAM_CONVERTERS_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 
@@ -42,8 +49,66 @@ py::array_t<T> numpy_array(const std::vector<T>& input) {
     auto output =  py::array_t<T>(input.size());
     T * py_array_ptr = (T*)output.request().ptr;
 
-    for (size_t i = 0; i < input.size(); i++)
-        py_array_ptr[i] = input[i];
+    std::copy(input.begin(), input.end(), py_array_ptr);
+
+    return output;
+}
+
+/*
+  Take ownership of a temporary vector without copying its elements.  The
+  vector is released when the array is garbage collected.
+*/
+template <class T>
+py::array_t<T> numpy_array(std::vector<T>&& input) {
+    if constexpr (std::is_same_v<T, bool>) {
+        // std::vector<bool> has no contiguous storage of bools.
+        return numpy_array(static_cast<const std::vector<T>&>(input));
+    }
+    else {
+        auto* data = new std::vector<T>(std::move(input));
+        py::capsule owner(data, [](void* p) { delete static_cast<std::vector<T>*>(p); });
+
+        return py::array_t<T>({ data->size() }, { sizeof(T) }, data->data(), owner);
+    }
+}
+
+/*
+  Read-only array sharing the storage of a vector held by the C++ object
+  of a Python object, e.g., an array loaded by an EclFile.  The Python
+  object is kept alive for as long as the array, so the vector must not be
+  modified or destroyed during the lifetime of its owner.  Vectors of bool
+  are copied.
+*/
+template <class T, class Owner>
+py::array_t<T> numpy_view(const std::vector<T>& input, const Owner* owner) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return numpy_array(input);
+    }
+    else {
+        auto base = py::cast(owner, py::return_value_policy::reference);
+        auto output = py::array_t<T>({ input.size() }, { sizeof(T) }, input.data(), base);
+
+        py::detail::array_proxy(output.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+
+        return output;
+    }
+}
+
+/*
+  Two dimensional array with one row per input vector.  All vectors must
+  have the same size.
+*/
+template <class T>
+py::array_t<T> numpy_array_2d(const std::vector<const std::vector<T>*>& rows, const std::size_t row_size) {
+    auto output = py::array_t<T>({ rows.size(), row_size });
+    T * py_array_ptr = (T*)output.request().ptr;
+
+    for (const auto* row : rows) {
+        if (row->size() != row_size)
+            throw std::invalid_argument("Cannot form two-dimensional array of vectors of different sizes");
+
+        py_array_ptr = std::copy(row->begin(), row->end(), py_array_ptr);
+    }
 
     return output;
 }
@@ -3,7 +3,9 @@
 #include <pybind11/numpy.h>
 #include <pybind11/chrono.h>
 #include <filesystem>
+#include <optional>
 #include <stdexcept>
+#include <utility>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
@@ -73,9 +75,37 @@ public:
     py::array get_smry_vector(const std::string& key)
     {
         if (m_esmry != nullptr)
-            return convert::numpy_array( m_esmry->get(key) );
+            return convert::numpy_view( m_esmry->get(key), this );
         else
-            return convert::numpy_array( m_ext_esmry->get(key) );
+            return convert::numpy_view( m_ext_esmry->get(key), this );
+    }
+
+    py::array get_smry_vectors(const std::vector<std::string>& keys, bool at_rstep)
+    {
+        // Vectors at report steps are formed on demand, so they must be
+        // kept until copied.
+        std::vector<std::vector<float>> rstep_vectors;
+        std::vector<const std::vector<float>*> rows;
+        rows.reserve(keys.size());
+
+        for (const auto& key : keys) {
+            if (at_rstep) {
+                rstep_vectors.push_back(m_esmry != nullptr
+                                        ? m_esmry->get_at_rstep(key)
+                                        : m_ext_esmry->get_at_rstep(key));
+            }
+            else {
+                rows.push_back(m_esmry != nullptr
+                               ? &m_esmry->get(key)
+                               : &m_ext_esmry->get(key));
+            }
+        }
+
+        for (const auto& vector : rstep_vectors)
+            rows.push_back(&vector);
+
+        std::size_t row_size = rows.empty() ? 0 : rows.front()->size();
+        return convert::numpy_array_2d(rows, row_size);
     }
 
     py::array get_smry_vector_at_rsteps(const std::string& key)
@@ -208,16 +238,16 @@ npArray get_vector_index(Opm::EclIO::EclFile * file_ptr, std::size_t array_index
     auto array_type = std::get<1>(file_ptr->getList()[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<int>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<int>(array_index), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<float>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<float>(array_index), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<double>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<double>(array_index), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<bool>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<bool>(array_index), file_ptr ), array_type);
 
     if ((array_type == Opm::EclIO::CHAR) || (array_type == Opm::EclIO::C0NN))
         return std::make_tuple (convert::numpy_string_array( file_ptr->get<std::string>(array_index)), array_type);
@@ -281,16 +311,16 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
     auto array_type = std::get<1>(arrList[index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<int>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<int>(index, rstep), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<float>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<float>(index, rstep), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<double>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<double>(index, rstep), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<bool>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<bool>(index, rstep), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRestartData<std::string>(index, rstep)), array_type);
@@ -299,6 +329,55 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
 }
 
 
+template <class T>
+py::array stack_erst_vectors(Opm::EclIO::ERst * file_ptr, const std::string& key,
+                             const std::vector<int>& rsteps, int occurrence)
+{
+    std::vector<const std::vector<T>*> rows;
+    rows.reserve(rsteps.size());
+
+    for (const auto rstep : rsteps)
+        rows.push_back(&file_ptr->getRestartData<T>(key, rstep, occurrence));
+
+    std::size_t row_size = rows.empty() ? 0 : rows.front()->size();
+    return convert::numpy_array_2d(rows, row_size);
+}
+
+py::array get_erst_stacked(Opm::EclIO::ERst * file_ptr, const std::string& key,
+                           const std::vector<int>& rsteps, size_t occurrence)
+{
+    if (rsteps.empty())
+        throw std::invalid_argument("At least one report step is required");
+
+    std::optional<Opm::EclIO::eclArrType> array_type;
+    for (const auto rstep : rsteps) {
+        if (occurrence >= static_cast<size_t>(file_ptr->occurrence_count(key, rstep)))
+            throw std::out_of_range("Array " + key + " not found in report step " + std::to_string(rstep));
+
+        auto array_list = file_ptr->listOfRstArrays(rstep);
+        auto type = std::get<1>(array_list[get_array_index(array_list, key, occurrence)]);
+
+        if (array_type.has_value() && (*array_type != type))
+            throw std::invalid_argument("Array " + key + " has different types in different report steps");
+
+        array_type = type;
+    }
+
+    if (array_type == Opm::EclIO::INTE)
+        return stack_erst_vectors<int>(file_ptr, key, rsteps, occurrence);
+
+    if (array_type == Opm::EclIO::REAL)
+        return stack_erst_vectors<float>(file_ptr, key, rsteps, occurrence);
+
+    if (array_type == Opm::EclIO::DOUB)
+        return stack_erst_vectors<double>(file_ptr, key, rsteps, occurrence);
+
+    if (array_type == Opm::EclIO::LOGI)
+        return stack_erst_vectors<bool>(file_ptr, key, rsteps, occurrence);
+
+    throw std::invalid_argument("Array " + key + " is not numeric");
+}
+
 npArray get_erst_vector(Opm::EclIO::ERst * file_ptr, const std::string& key, size_t rstep, size_t occurrence)
 {
     if (occurrence >= static_cast<size_t>(file_ptr->occurrence_count(key, rstep)))
@@ -377,7 +456,7 @@ py::array get_cellvolumes_mask(Opm::EclIO::EGrid * file_ptr, std::vector<int> ma
         }
     }
 
-    return convert::numpy_array( celvol );
+    return convert::numpy_array( std::move(celvol) );
 }
 
 py::array get_cellvolumes(Opm::EclIO::EGrid * file_ptr)
@@ -396,19 +475,19 @@ npArray get_rft_vector_WellDate(Opm::EclIO::ERft * file_ptr,const std::string& n
     Opm::EclIO::eclArrType array_type = std::get<1>(arrList[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<int>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<int>(name, well, y, m, d), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<float>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<float>(name, well, y, m, d), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<double>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<double>(name, well, y, m, d), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRft<std::string>(name, well, y, m, d) ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<bool>(name, well, y, m, d) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<bool>(name, well, y, m, d), file_ptr ), array_type);
 
     throw std::logic_error("Data type not supported");
 }
@@ -420,19 +499,19 @@ npArray get_rft_vector_Index(Opm::EclIO::ERft * file_ptr,const std::string& name
     Opm::EclIO::eclArrType array_type = std::get<1>(arrList[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<int>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<int>(name, reportIndex), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<float>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<float>(name, reportIndex), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<double>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<double>(name, reportIndex), file_ptr ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRft<std::string>(name, reportIndex) ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRft<bool>(name, reportIndex) ), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRft<bool>(name, reportIndex), file_ptr ), array_type);
 
     throw std::logic_error("Data type not supported");
 }
@@ -491,7 +570,8 @@ void python::common::export_IO(py::module& m) {
         .def("arrays", (std::vector< std::tuple<std::string, Opm::EclIO::eclArrType, int64_t> >
                         (Opm::EclIO::ERst::*)(int, const std::string&) ) &Opm::EclIO::ERst::listOfRstArrays, py::arg("report_step"), py::arg("lgr_name"), ERst_arrays_with_string_docstring)
         .def("__get_data", &get_erst_by_index, py::arg("index"), py::arg("report_step"), ERst_get_data_by_index_docstring)
-        .def("__get_data", &get_erst_vector, py::arg("name"), py::arg("report_step"), py::arg("occurrence"), ERst_get_data_vector_docstring);
+        .def("__get_data", &get_erst_vector, py::arg("name"), py::arg("report_step"), py::arg("occurrence"), ERst_get_data_vector_docstring)
+        .def("stacked", &get_erst_stacked, py::arg("name"), py::arg("report_steps"), py::arg("occurrence") = 0, ERst_stacked_docstring);
 
 
    py::class_<ESmryBind>(m, "ESmry", ESmry_docstring)
@@ -501,6 +581,7 @@ void python::common::export_IO(py::module& m) {
         .def("__len__", &ESmryBind::numberOfTimeSteps, ESmry_len_docstring)
         .def("__get_all", &ESmryBind::get_smry_vector, py::arg("key"), ESmry_get_all_docstring)
         .def("__get_at_rstep", &ESmryBind::get_smry_vector_at_rsteps, py::arg("key"), ESmry_get_at_rstep_docstring)
+        .def("vectors", &ESmryBind::get_smry_vectors, py::arg("keys"), py::arg("report_step") = false, ESmry_vectors_docstring)
         .def("__start_date", &ESmryBind::smry_start_date, ESmry_start_date_docstring)
         .def("keys", (const std::vector<std::string>& (ESmryBind::*) (void) const)
             &ESmryBind::keywordList, ESmry_keys1_docstring)
@@ -31,6 +31,47 @@ class TestERst(unittest.TestCase):
         self.assertEqual(len(rst1), 2)
 
 
+    def test_stacked(self):
+
+        rst1 = ERst(test_path("data/SPE9.UNRST"))
+
+        inteh = rst1.stacked("INTEHEAD", [37, 74])
+
+        self.assertEqual(inteh.shape, (2, 411))
+        self.assertEqual(inteh.dtype, "int32")
+
+        self.assertTrue(np.array_equal(inteh[0], rst1["INTEHEAD", 37]))
+        self.assertTrue(np.array_equal(inteh[1], rst1["INTEHEAD", 74]))
+
+        with self.assertRaises(ValueError):
+            rst1.stacked("ZWEL", [37])
+
+        with self.assertRaises(IndexError):
+            rst1.stacked("XXXX", [37])
+
+        # arrays are views of data held by the file object
+        inteh = rst1["INTEHEAD", 37]
+
+        self.assertFalse(inteh.flags.writeable)
+        self.assertTrue(inteh.base is not None)
+
+
+    def test_view_after_reload(self):
+
+        rst1 = ERst(test_path("data/SPE9.UNRST"))
+
+        pres = rst1["PRESSURE", 37]
+        expected = pres.copy()
+
+        # loading the report step again keeps the arrays already loaded
+        rst1.load_report_step(37)
+        rst1.load_report_step(74)
+
+        self.assertTrue(np.array_equal(pres, expected))
+        self.assertEqual(pres.sum(), expected.sum())
+        self.assertTrue(np.array_equal(rst1["PRESSURE", 37], expected))
+
+
     def test_contains(self):
 
         rst1 = ERst(test_path("data/SPE9.UNRST"))
@@ -50,6 +50,29 @@ class TestEclFile(unittest.TestCase):
 
         self.assertEqual(len(time1b), 64)
 
+    def test_vectors(self):
+
+        smry1 = ESmry(test_path("data/SPE1CASE1.SMSPEC"))
+
+        time = smry1["TIME"]
+
+        self.assertFalse(time.flags.writeable)
+        self.assertTrue(time.base is not None)
+
+        data = smry1.vectors(["TIME", "FOPR"])
+
+        self.assertEqual(data.shape, (2, len(smry1)))
+        self.assertTrue(np.array_equal(data[0], time))
+        self.assertTrue(np.array_equal(data[1], smry1["FOPR"]))
+
+        data = smry1.vectors(["TIME", "FOPR"], True)
+
+        self.assertEqual(data.shape, (2, 64))
+        self.assertTrue(np.array_equal(data[0], smry1["TIME", True]))
+
+        with self.assertRaises(ValueError):
+            smry1.vectors(["XXX"])
+
     def test_start_date(self):
 
         smry1 = ESmry(test_path("data/T1_STARTD.SMSPEC"))
@@ -406,3 +406,65 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction3, Scalar, Types)
     test.compareTableWithAnalyticFn2(xytab, xMin, xMax, m,
                                      yMin, yMax, n, test.testFn3, tolerance);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedSegmentLookup, Scalar, Types)
+{
+    using Table = Opm::UniformXTabulated2DFunction<Scalar>;
+
+    // Non-uniform x positions and columns of differing, non-uniform
+    // y positions, resembling a PVTO table.
+    Table bisection(Table::InterpolationPolicy::Vertical);
+    for (unsigned i = 0; i < 20; ++i) {
+        const Scalar x = Scalar(i*i) / 10;
+        bisection.appendXPos(x);
+
+        const unsigned n = 4 + i % 5;
+        for (unsigned j = 0; j < n; ++j) {
+            const Scalar y = x + Scalar(j*j*j) / 7;
+            bisection.appendSamplePoint(i, y, Test<Scalar>::testFn3(x, y));
+        }
+    }
+
+    auto lookup = bisection;
+    BOOST_CHECK(!lookup.hasSegmentLookup());
+
+    lookup.buildSegmentLookup();
+    BOOST_CHECK(lookup.hasSegmentLookup());
+
+    for (int kx = 0; kx <= 400; ++kx) {
+        const Scalar x = Scalar(-1.0) + Scalar(kx) * Scalar(40.0) / 400;
+        BOOST_CHECK_EQUAL(lookup.xSegmentIndex(x, /*extrapolate=*/true),
+                          bisection.xSegmentIndex(x, /*extrapolate=*/true));
+
+        for (int ky = 0; ky <= 200; ++ky) {
+            const Scalar y = x + Scalar(-1.0) + Scalar(ky) * Scalar(12.0) / 200;
+            BOOST_CHECK_EQUAL(lookup.eval(x, y, /*extrapolate=*/true),
+                              bisection.eval(x, y, /*extrapolate=*/true));
+        }
+    }
+
+    // Every column, queried at its own sampling points.
+    for (unsigned i = 0; i < bisection.numX(); ++i) {
+        for (unsigned j = 0; j < bisection.numY(i); ++j) {
+            const Scalar y = bisection.yAt(i, j);
+            BOOST_CHECK_EQUAL(lookup.ySegmentIndex(y, i, /*extrapolate=*/true),
+                              bisection.ySegmentIndex(y, i, /*extrapolate=*/true));
+        }
+    }
+
+    // Appending sampling points removes the lookup.
+    lookup.appendSamplePoint(0, Scalar(100.0), Scalar(0.0));
+    BOOST_CHECK(!lookup.hasSegmentLookup());
+
+    // Tables too small for an interior search do not get a lookup.
+    Table small(Table::InterpolationPolicy::Vertical);
+    for (unsigned i = 0; i < 3; ++i) {
+        small.appendXPos(Scalar(i));
+        for (unsigned j = 0; j < 3; ++j) {
+            small.appendSamplePoint(i, Scalar(j), Scalar(i + j));
+        }
+    }
+
+    small.buildSegmentLookup();
+    BOOST_CHECK(!small.hasSegmentLookup());
+}
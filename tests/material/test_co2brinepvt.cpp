@@ -51,6 +51,8 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
 #include <iostream>
+#include <random>
+#include <vector>
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -278,3 +280,50 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Water, Scalar, Types)
     ensurePvtApiGas<Scalar>(co2Pvt);
     ensurePvtApiBrine<Eval>(brinePvt);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Tabulation, Scalar, Types)
+{
+    const std::vector<Scalar> salinity { 0.05 };
+    const Opm::BrineCo2Pvt<Scalar> brinePvt(salinity);
+    const Opm::Co2GasPvt<Scalar> co2Pvt(salinity);
+
+    Opm::Co2BrineTabulationParams<Scalar> params;
+    params.tolerance = 1.0e-3;
+
+    auto tabulatedBrinePvt = brinePvt;
+    auto tabulatedCo2Pvt = co2Pvt;
+    tabulatedBrinePvt.enableTabulation(params);
+    tabulatedCo2Pvt.enableTabulation(params);
+    BOOST_CHECK(tabulatedBrinePvt.tabulationEnabled());
+    BOOST_CHECK(tabulatedCo2Pvt.tabulationEnabled());
+
+    // Relative tolerance of the tables, in percent.  The tables are refined
+    // until it is met at the midpoints between the sampling points, and
+    // the largest error at these random points is about 0.8 of it.
+    const Scalar tol = 100*params.tolerance;
+    std::mt19937 gen{1};
+    std::uniform_real_distribution<Scalar> temperature{params.temperatureMin, params.temperatureMax};
+    std::uniform_real_distribution<Scalar> pressure{50.0e5, params.pressureMax};
+    for (int i = 0; i < 100; ++i) {
+        const Scalar T = temperature(gen);
+        const Scalar p = pressure(gen);
+        BOOST_CHECK_CLOSE(tabulatedBrinePvt.saturatedGasDissolutionFactor(0, T, p),
+                          brinePvt.saturatedGasDissolutionFactor(0, T, p), tol);
+        BOOST_CHECK_CLOSE(tabulatedBrinePvt.saturatedInverseFormationVolumeFactor(0, T, p),
+                          brinePvt.saturatedInverseFormationVolumeFactor(0, T, p), tol);
+        BOOST_CHECK_CLOSE(tabulatedBrinePvt.saturatedViscosity(0, T, p),
+                          brinePvt.saturatedViscosity(0, T, p), tol);
+        BOOST_CHECK_CLOSE(tabulatedCo2Pvt.saturatedWaterVaporizationFactor(0, T, p),
+                          co2Pvt.saturatedWaterVaporizationFactor(0, T, p), tol);
+        BOOST_CHECK_CLOSE(tabulatedCo2Pvt.saturatedViscosity(0, T, p),
+                          co2Pvt.saturatedViscosity(0, T, p), tol);
+    }
+
+    // Outside of the tabulated range, the correlations are used.
+    const Scalar T = params.temperatureMax + 10.0;
+    const Scalar p = 100.0e5;
+    BOOST_CHECK_EQUAL(tabulatedBrinePvt.saturatedGasDissolutionFactor(0, T, p),
+                      brinePvt.saturatedGasDissolutionFactor(0, T, p));
+    BOOST_CHECK_EQUAL(tabulatedCo2Pvt.saturatedWaterVaporizationFactor(0, T, p),
+                      co2Pvt.saturatedWaterVaporizationFactor(0, T, p));
+}
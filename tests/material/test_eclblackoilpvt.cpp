@@ -55,7 +55,11 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Units/Units.hpp>
 
+#include <cstddef>
+#include <stdexcept>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -299,6 +303,77 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ApiConformance, Scalar, Types)
     ensurePvtApi<FooEval>(oilPvt, gasPvt, waterPvt);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedEvaluation, Scalar, Types)
+{
+    Opm::GasPvtMultiplexer<Scalar> gasPvt;
+    Opm::OilPvtMultiplexer<Scalar> oilPvt;
+    Opm::WaterPvtMultiplexer<Scalar> waterPvt;
+
+    gasPvt.initFromState(eclState, schedule);
+    oilPvt.initFromState(eclState, schedule);
+    waterPvt.initFromState(eclState, schedule);
+
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 2>;
+
+    // Interleaved PVT regions to exercise the region grouping.
+    const std::size_t numCells = 17;
+    std::vector<unsigned> regionIdx(numCells);
+    std::vector<Eval> temperature(numCells), pressure(numCells),
+        Rs(numCells), Rv(numCells), zero(numCells, Eval{0.0});
+
+    for (std::size_t cell = 0; cell < numCells; ++cell) {
+        regionIdx[cell] = (cell % 3 == 1) ? 0 : 1;
+        temperature[cell] = Eval{Scalar(273.15 + 20.0 + cell)};
+        pressure[cell] = Eval::createVariable(Scalar(1e5 + cell*2e6), 0);
+        Rs[cell] = Eval::createVariable(Scalar(cell*5.0), 1);
+        Rv[cell] = Eval{Scalar(1e-3 + cell*1e-5)};
+    }
+
+    const auto checkEqual = [](const Eval& batch, const Eval& single)
+    {
+        BOOST_CHECK_EQUAL(batch.value(), single.value());
+        BOOST_CHECK_EQUAL(batch.derivative(0), single.derivative(0));
+        BOOST_CHECK_EQUAL(batch.derivative(1), single.derivative(1));
+    };
+
+    std::vector<Eval> invB(numCells), mu(numCells), satRs(numCells);
+
+    oilPvt.template inverseFormationVolumeFactorAndViscosity<Eval>
+        (regionIdx, temperature, pressure, Rs, invB, mu);
+    oilPvt.template saturatedGasDissolutionFactor<Eval>
+        (regionIdx, temperature, pressure, satRs);
+    for (std::size_t cell = 0; cell < numCells; ++cell) {
+        const auto r = regionIdx[cell];
+        checkEqual(invB[cell], oilPvt.inverseFormationVolumeFactor(r, temperature[cell], pressure[cell], Rs[cell]));
+        checkEqual(mu[cell], oilPvt.viscosity(r, temperature[cell], pressure[cell], Rs[cell]));
+        checkEqual(satRs[cell], oilPvt.saturatedGasDissolutionFactor(r, temperature[cell], pressure[cell]));
+    }
+
+    gasPvt.template inverseFormationVolumeFactorAndViscosity<Eval>
+        (regionIdx, temperature, pressure, Rv, zero, invB, mu);
+    gasPvt.template saturatedOilVaporizationFactor<Eval>
+        (regionIdx, temperature, pressure, satRs);
+    for (std::size_t cell = 0; cell < numCells; ++cell) {
+        const auto r = regionIdx[cell];
+        checkEqual(invB[cell], gasPvt.inverseFormationVolumeFactor(r, temperature[cell], pressure[cell], Rv[cell], zero[cell]));
+        checkEqual(mu[cell], gasPvt.viscosity(r, temperature[cell], pressure[cell], Rv[cell], zero[cell]));
+        checkEqual(satRs[cell], gasPvt.saturatedOilVaporizationFactor(r, temperature[cell], pressure[cell]));
+    }
+
+    waterPvt.template inverseFormationVolumeFactorAndViscosity<Eval>
+        (regionIdx, temperature, pressure, zero, zero, invB, mu);
+    for (std::size_t cell = 0; cell < numCells; ++cell) {
+        const auto r = regionIdx[cell];
+        checkEqual(invB[cell], waterPvt.inverseFormationVolumeFactor(r, temperature[cell], pressure[cell], zero[cell], zero[cell]));
+        checkEqual(mu[cell], waterPvt.viscosity(r, temperature[cell], pressure[cell], zero[cell], zero[cell]));
+    }
+
+    mu.pop_back();
+    BOOST_CHECK_THROW(waterPvt.template inverseFormationVolumeFactorAndViscosity<Eval>
+                      (regionIdx, temperature, pressure, zero, zero, invB, mu),
+                      std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(ConstantCompressibilityWater, Scalar, Types)
 {
     constexpr Scalar tolerance = std::numeric_limits<Scalar>::epsilon()*1e3;
@@ -331,6 +406,187 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ConstantCompressibilityWater, Scalar, Types)
                         refTmp << ". (is " << tmp << ")");
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(FusedPvtValues, Scalar, Types)
+{
+    const auto deck2 = Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+  1 1 1 /
+TABDIMS
+  1 1 /
+OIL
+GAS
+DISGAS
+VAPOIL
+METRIC
+GRID
+DX
+  100 /
+DY
+  100 /
+DZ
+  10 /
+TOPS
+  1000 /
+PORO
+  0.2 /
+PROPS
+DENSITY
+  850 1030 0.9 /
+PVTO
+  20  50  1.10 1.5
+     150  1.09 1.6
+     250  1.08 1.7 /
+  60 120  1.20 1.2
+     220  1.19 1.3
+     320  1.18 1.4 /
+/
+PVTG
+  50  0.0004  0.025   0.015
+      0.0     0.0249  0.0149 /
+ 150  0.0010  0.0087  0.018
+      0.0     0.0086  0.0179 /
+ 300  0.0030  0.0046  0.024
+      0.0     0.0045  0.0239 /
+/
+SCHEDULE
+END
+)");
+    const Opm::EclipseState eclState2(deck2);
+    const Opm::Schedule schedule2(deck2, eclState2, std::make_shared<Opm::Python>());
+
+    Opm::LiveOilPvt<Scalar> oilPvt;
+    oilPvt.initFromState(eclState2, schedule2);
+
+    Opm::WetGasPvt<Scalar> gasPvt;
+    gasPvt.initFromState(eclState2, schedule2);
+
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 2>;
+
+    const auto checkEqual = [](const Eval& fused, const Eval& single)
+    {
+        BOOST_CHECK_EQUAL(fused.value(), single.value());
+        BOOST_CHECK_EQUAL(fused.derivative(0), single.derivative(0));
+        BOOST_CHECK_EQUAL(fused.derivative(1), single.derivative(1));
+    };
+
+    const Eval T{Scalar(350.0)};
+    for (const auto pBar : {30.0, 100.0, 200.0, 400.0}) {
+        const auto p = Eval::createVariable(Scalar(pBar * 1e5), 0);
+
+        // Saturated, undersaturated and extrapolated Rs and Rv values.
+        for (const auto Rs : {0.0, 20.0, 45.0, 80.0}) {
+            const auto rs = Eval::createVariable(Scalar(Rs), 1);
+            const auto values = oilPvt.pvtValues(0, T, p, rs);
+
+            checkEqual(values.invB, oilPvt.inverseFormationVolumeFactor(0, T, p, rs));
+            checkEqual(values.mu, oilPvt.viscosity(0, T, p, rs));
+            checkEqual(values.mu, values.invB / values.invBMu);
+            checkEqual(values.saturatedFactor, oilPvt.saturatedGasDissolutionFactor(0, T, p));
+        }
+
+        for (const auto Rv : {0.0, 5e-4, 2e-3}) {
+            const auto rv = Eval::createVariable(Scalar(Rv), 1);
+            const auto values = gasPvt.pvtValues(0, T, p, rv, Eval{0.0});
+
+            checkEqual(values.invB, gasPvt.inverseFormationVolumeFactor(0, T, p, rv, Eval{0.0}));
+            checkEqual(values.mu, gasPvt.viscosity(0, T, p, rv, Eval{0.0}));
+            checkEqual(values.saturatedFactor, gasPvt.saturatedOilVaporizationFactor(0, T, p));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(PvtTableSegmentLookup, Scalar, Types)
+{
+    const auto deck2 = Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+  1 1 1 /
+TABDIMS
+  1 1 /
+OIL
+GAS
+DISGAS
+METRIC
+GRID
+DX
+  100 /
+DY
+  100 /
+DZ
+  10 /
+TOPS
+  1000 /
+PORO
+  0.2 /
+PROPS
+DENSITY
+  850 1030 0.9 /
+PVTO
+  20  50  1.10 1.5
+     100  1.095 1.55
+     150  1.09 1.6
+     250  1.08 1.7 /
+  40  80  1.15 1.35
+     130  1.145 1.4
+     200  1.14 1.45
+     290  1.13 1.55 /
+  60 120  1.20 1.2
+     170  1.195 1.25
+     220  1.19 1.3
+     320  1.18 1.4 /
+  80 160  1.25 1.1
+     210  1.245 1.15
+     260  1.24 1.2
+     360  1.23 1.3 /
+  100 200 1.30 1.0
+     250  1.295 1.05
+     300  1.29 1.1
+     400  1.28 1.2 /
+/
+SCHEDULE
+END
+)");
+    const Opm::EclipseState eclState2(deck2);
+    const Opm::Schedule schedule2(deck2, eclState2, std::make_shared<Opm::Python>());
+
+    Opm::LiveOilPvt<Scalar> oilPvt;
+    oilPvt.initFromState(eclState2, schedule2);
+
+    const auto& invB = oilPvt.inverseOilBTable()[0];
+    const auto& invBMu = oilPvt.inverseOilBMuTable()[0];
+    BOOST_CHECK(invB.hasSegmentLookup());
+    BOOST_CHECK(invBMu.hasSegmentLookup());
+    BOOST_CHECK(oilPvt.inverseSaturatedOilBTable()[0].hasSegmentLookup());
+    BOOST_CHECK(oilPvt.saturatedGasDissolutionFactorTable()[0].hasSegmentLookup());
+
+    // Same sampling points, searched by bisection.
+    const auto withoutLookup = [](const auto& table)
+    {
+        std::decay_t<decltype(table)> plain(table.interpolationGuide());
+        for (std::size_t i = 0; i < table.numX(); ++i) {
+            plain.appendXPos(table.xAt(i));
+            for (std::size_t j = 0; j < table.numY(i); ++j) {
+                plain.appendSamplePoint(i, table.yAt(i, j), table.valueAt(i, j));
+            }
+        }
+        return plain;
+    };
+
+    const auto plainInvB = withoutLookup(invB);
+    const auto plainInvBMu = withoutLookup(invBMu);
+    BOOST_CHECK(!plainInvB.hasSegmentLookup());
+
+    for (int i = 0; i <= 60; ++i) {
+        const Scalar rs = Scalar(10.0 + 1.6*i);
+        for (int j = 0; j <= 60; ++j) {
+            const Scalar p = Scalar((30.0 + 7.0*j) * 1e5);
+            BOOST_CHECK_EQUAL(invB.eval(rs, p, /*extrapolate=*/true),
+                              plainInvB.eval(rs, p, /*extrapolate=*/true));
+            BOOST_CHECK_EQUAL(invBMu.eval(rs, p, /*extrapolate=*/true),
+                              plainInvBMu.eval(rs, p, /*extrapolate=*/true));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(RSCONST_RequiresDeadOilMode)
 {
     const auto deck2 = makeRSCONSTDeck("0.37 101.5", "GAS\nDISGAS\n");
@@ -750,6 +750,46 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Fam1Fam2Hysteresis, Scalar, Types)
     }
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(PerCellHysteresisState, Scalar, Types)
+{
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(hysterDeckString);
+    const Opm::EclipseState eclState(deck);
+    const std::size_t n = eclState.getInputGrid().getCartesianSize();
+
+    MaterialLawManager materialLawManager;
+    materialLawManager.initFromState(eclState);
+    materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    // The two-phase parameters of neighbouring cells share storage blocks,
+    // so make sure that each cell nevertheless has its own state.
+    const auto value = [](const unsigned elemIdx, const int k)
+    { return Scalar(0.1) + Scalar((7*elemIdx + k) % 50) / 100; };
+
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        materialLawManager.setOilWaterHysteresisParams(value(elemIdx, 0), value(elemIdx, 1),
+                                                       value(elemIdx, 2), elemIdx);
+        materialLawManager.setGasOilHysteresisParams(value(elemIdx, 3), value(elemIdx, 4),
+                                                     value(elemIdx, 5), elemIdx);
+    }
+
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        std::array<Scalar,3> sowmax_out = {0.0, 0.0, 0.0};
+        std::array<Scalar,3> sgomax_out = {0.0, 0.0, 0.0};
+        materialLawManager.oilWaterHysteresisParams(sowmax_out[0], sowmax_out[1],
+                                                    sowmax_out[2], elemIdx);
+        materialLawManager.gasOilHysteresisParams(sgomax_out[0], sgomax_out[1],
+                                                  sgomax_out[2], elemIdx);
+
+        for (int k = 0; k < 3; ++k) {
+            BOOST_CHECK_CLOSE(sowmax_out[k], value(elemIdx, k), 1e-3);
+            BOOST_CHECK_CLOSE(sgomax_out[k], value(elemIdx, 3 + k), 1e-3);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(GasOil, Scalar, Types)
 {
     using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
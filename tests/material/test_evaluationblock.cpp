@@ -0,0 +1,227 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Check that blocks of dense-AD evaluations yield the same values and
+ *        derivatives as the individual evaluations.
+ */
+#include "config.h"
+
+#include <boost/mpl/list.hpp>
+
+#define BOOST_TEST_MODULE EvaluationBlock
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/densead/EvaluationBlock.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityWaterPvt.hpp>
+
+#include <array>
+#include <random>
+
+namespace {
+
+template <int numDerivsT, int blockSizeT>
+struct Config
+{
+    static constexpr int numDerivs = numDerivsT;
+    static constexpr int blockSize = blockSizeT;
+
+    using Eval = Opm::DenseAd::Evaluation<double, numDerivs>;
+    using Block = Opm::DenseAd::EvaluationBlock<double, numDerivs, blockSize>;
+};
+
+// Three and six derivatives use the generated specializations, fifteen the
+// generic implementation.
+using Configs = boost::mpl::list<Config<3, 4>, Config<6, 8>, Config<15, 2>>;
+
+template <class C>
+std::array<typename C::Eval, C::blockSize>
+randomEvals(std::mt19937& gen, const double lo, const double hi)
+{
+    std::uniform_real_distribution<double> value{lo, hi};
+    std::uniform_real_distribution<double> deriv{-1.0, 1.0};
+
+    std::array<typename C::Eval, C::blockSize> evals;
+    for (auto& eval : evals) {
+        eval = value(gen);
+        for (int varIdx = 0; varIdx < C::numDerivs; ++varIdx) {
+            eval.setDerivative(varIdx, deriv(gen));
+        }
+    }
+
+    return evals;
+}
+
+template <class C>
+void checkLanes(const typename C::Block& block,
+                const std::array<typename C::Eval, C::blockSize>& expected)
+{
+    for (int lane = 0; lane < C::blockSize; ++lane) {
+        const auto eval = Opm::DenseAd::extractLane(block, lane);
+        BOOST_CHECK_CLOSE(eval.value(), expected[lane].value(), 1.0e-10);
+        for (int varIdx = 0; varIdx < C::numDerivs; ++varIdx) {
+            BOOST_CHECK_CLOSE(eval.derivative(varIdx), expected[lane].derivative(varIdx), 1.0e-10);
+        }
+    }
+}
+
+// Evaluate a function on every lane of the input blocks and on the blocks,
+// and compare the results.
+template <class C, class Function>
+void checkFunction(const std::array<typename C::Eval, C::blockSize>& a,
+                   const std::array<typename C::Eval, C::blockSize>& b,
+                   Function&& f)
+{
+    std::array<typename C::Eval, C::blockSize> expected;
+    for (int lane = 0; lane < C::blockSize; ++lane) {
+        expected[lane] = f(a[lane], b[lane]);
+    }
+
+    const auto blockA = Opm::DenseAd::loadBlock<C::blockSize>(a.data());
+    const auto blockB = Opm::DenseAd::loadBlock<C::blockSize>(b.data());
+    checkLanes<C>(f(blockA, blockB), expected);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(LoadStore, C, Configs)
+{
+    std::mt19937 gen{1};
+    const auto evals = randomEvals<C>(gen, -1.0, 1.0);
+
+    const auto block = Opm::DenseAd::loadBlock<C::blockSize>(evals.data());
+    checkLanes<C>(block, evals);
+
+    std::array<typename C::Eval, C::blockSize> stored;
+    Opm::DenseAd::storeBlock(block, stored.data());
+    for (int lane = 0; lane < C::blockSize; ++lane) {
+        BOOST_CHECK_EQUAL(stored[lane].value(), evals[lane].value());
+        for (int varIdx = 0; varIdx < C::numDerivs; ++varIdx) {
+            BOOST_CHECK_EQUAL(stored[lane].derivative(varIdx), evals[lane].derivative(varIdx));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Arithmetic, C, Configs)
+{
+    std::mt19937 gen{2};
+    const auto a = randomEvals<C>(gen, 0.5, 2.0);
+    const auto b = randomEvals<C>(gen, 0.5, 2.0);
+
+    checkFunction<C>(a, b, [](const auto& x, const auto& y) { return x + y; });
+    checkFunction<C>(a, b, [](const auto& x, const auto& y) { return x - y; });
+    checkFunction<C>(a, b, [](const auto& x, const auto& y) { return x * y; });
+    checkFunction<C>(a, b, [](const auto& x, const auto& y) { return x / y; });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return -x; });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return 2.0*x - 1.0; });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return 3.0/x + x/4.0; });
+    checkFunction<C>(a, b, [](const auto& x, const auto& y)
+    {
+        auto result = x;
+        result += y;
+        result *= x;
+        result -= 0.5;
+        result /= y;
+        return result;
+    });
+
+    // Typical flux expression, density times mobility times potential
+    // difference.
+    checkFunction<C>(a, b, [](const auto& x, const auto& y)
+    { return (1000.0*x) * (y*y/1.0e-3) * (x - y - 9.81*x*0.5); });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Functions, C, Configs)
+{
+    std::mt19937 gen{3};
+    const auto a = randomEvals<C>(gen, 0.1, 0.9);
+    const auto b = randomEvals<C>(gen, 0.1, 0.9);
+
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::exp(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::log(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::log10(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::sqrt(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::sin(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::cos(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::tan(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::asin(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::acos(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::atan(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto& y) { return Opm::atan2(x, y); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::pow(x, 2.5); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::pow(2.5, x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto& y) { return Opm::pow(x, y); });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(LaneWiseSelection, C, Configs)
+{
+    std::mt19937 gen{4};
+    auto a = randomEvals<C>(gen, -1.0, 1.0);
+    const auto b = randomEvals<C>(gen, -1.0, 1.0);
+
+    // Make sure that both branches are taken, and that a zero base is
+    // treated like for single evaluations.
+    a[0] = 0.0;
+
+    checkFunction<C>(a, b, [](const auto& x, const auto& y) { return Opm::min(x, y); });
+    checkFunction<C>(a, b, [](const auto& x, const auto& y) { return Opm::max(x, y); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::min(x, 0.25); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::max(-0.25, x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::abs(x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::pow(x, 2.0); });
+    checkFunction<C>(a, b, [](const auto& x, const auto&) { return Opm::pow(0.0, x); });
+    checkFunction<C>(a, b, [](const auto& x, const auto& y) { return Opm::pow(Opm::abs(x), y + 2.0); });
+}
+
+BOOST_AUTO_TEST_CASE(PvtRelation)
+{
+    using C = Config<3, 4>;
+
+    Opm::ConstantCompressibilityWaterPvt<double> pvt;
+    pvt.setNumRegions(1);
+    pvt.setReferencePressure(0, 1.0e5);
+    pvt.setReferenceFormationVolumeFactor(0, 1.02);
+    pvt.setCompressibility(0, 4.5e-10);
+    pvt.setViscosity(0, 0.4e-3, 1.0e-10);
+    pvt.setReferenceDensities(0, 800.0, 1.0, 1030.0);
+    pvt.initEnd();
+
+    std::mt19937 gen{5};
+    auto p = randomEvals<C>(gen, 100.0e5, 300.0e5);
+    const std::array<C::Eval, C::blockSize> zero{};
+    const std::array<C::Eval, C::blockSize> T{ 350.0, 350.0, 350.0, 350.0 };
+
+    const auto blockP = Opm::DenseAd::loadBlock<C::blockSize>(p.data());
+    const auto blockT = Opm::DenseAd::loadBlock<C::blockSize>(T.data());
+    const auto blockZero = Opm::DenseAd::loadBlock<C::blockSize>(zero.data());
+
+    std::array<C::Eval, C::blockSize> invB, mu;
+    for (int lane = 0; lane < C::blockSize; ++lane) {
+        invB[lane] = pvt.inverseFormationVolumeFactor(0, T[lane], p[lane], zero[lane], zero[lane]);
+        mu[lane] = pvt.viscosity(0, T[lane], p[lane], zero[lane], zero[lane]);
+    }
+
+    checkLanes<C>(pvt.inverseFormationVolumeFactor(0, blockT, blockP, blockZero, blockZero), invB);
+    checkLanes<C>(pvt.viscosity(0, blockT, blockP, blockZero, blockZero), mu);
+}
@@ -34,11 +34,16 @@
 #define BOOST_TEST_MODULE Tabulation
 #include <boost/test/unit_test.hpp>
 
+#include <opm/material/common/Tabulated1DFunction.hpp>
 #include <opm/material/components/H2O.hpp>
 #include <opm/material/components/TabulatedComponent.hpp>
+#include <opm/material/densead/Evaluation.hpp>
 
+#include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <tuple>
+#include <vector>
 
 using Types = boost::mpl::list<float,double>;
 
@@ -108,3 +113,54 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(H2O, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(SegmentLookup1D, Scalar, Types)
+{
+    // Strongly non-uniform sampling points, including a repeated abscissa,
+    // as is common in saturation function tables.
+    std::vector<Scalar> x { 0.0, 0.1, 0.1, 0.12, 0.125, 0.3, 0.31, 0.5, 0.75, 0.9, 0.99, 1.0 };
+    std::vector<Scalar> y(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        y[i] = x[i]*x[i];
+    }
+
+    const Opm::Tabulated1DFunction<Scalar> bisection(x, y, /*sortInputs=*/false);
+
+    auto lookup = bisection;
+    BOOST_CHECK(!lookup.hasSegmentLookup());
+
+    lookup.buildSegmentLookup();
+    BOOST_CHECK(lookup.hasSegmentLookup());
+
+    // Sampling points, midpoints and a dense sweep including
+    // extrapolation on both sides.
+    std::vector<Scalar> queries = x;
+    for (std::size_t i = 0; i + 1 < x.size(); ++i) {
+        queries.push_back((x[i] + x[i + 1]) / 2);
+        queries.push_back(std::nextafter(x[i + 1], x[i]));
+    }
+    for (int k = 0; k <= 2000; ++k) {
+        queries.push_back(Scalar(-0.2) + Scalar(k)*Scalar(1.4)/2000);
+    }
+
+    for (const auto xq : queries) {
+        BOOST_CHECK_EQUAL(lookup.findSegmentIndex(xq, /*extrapolate=*/true).value,
+                          bisection.findSegmentIndex(xq, /*extrapolate=*/true).value);
+        BOOST_CHECK_EQUAL(lookup.eval(xq, /*extrapolate=*/true),
+                          bisection.eval(xq, /*extrapolate=*/true));
+
+        // Queries of higher precision than the sampling points.
+        const double xd = static_cast<double>(xq) + 1.0e-12;
+        BOOST_CHECK_EQUAL(lookup.findSegmentIndex(xd, /*extrapolate=*/true).value,
+                          bisection.findSegmentIndex(xd, /*extrapolate=*/true).value);
+
+        using Eval = Opm::DenseAd::Evaluation<Scalar, 1>;
+        const auto xe = Eval::createVariable(xq, 0);
+        BOOST_CHECK_EQUAL(lookup.findSegmentIndex(xe, /*extrapolate=*/true).value,
+                          bisection.findSegmentIndex(xe, /*extrapolate=*/true).value);
+    }
+
+    // Changing the sampling points removes the lookup.
+    lookup.setXYContainers(x, y);
+    BOOST_CHECK(!lookup.hasSegmentLookup());
+}
@@ -42,6 +42,7 @@
 #include <opm/common/OpmLog/StreamLog.hpp>
 
 #include <opm/material/constraintsolvers/PTFlash.hpp>
+#include <opm/material/constraintsolvers/PTFlashBatch.hpp>
 #include <opm/material/fluidsystems/ThreeComponentFluidSystem.hh>
 
 #include <opm/material/densead/Evaluation.hpp>
@@ -57,6 +58,9 @@
 
 #include <iostream>
 #include <memory>
+#include <random>
+#include <span>
+#include <vector>
 
 // It is a three component system
 using Scalar = double;
@@ -234,3 +238,167 @@ for (const auto& sample : test_methods) {
 }
 #endif
 }
+
+namespace {
+
+// Cells around the state of the PtFlash test, which are two-phase, and at
+// higher pressures, which are mostly single-phase.
+std::vector<FluidState> batchStates(const double pressureFactor)
+{
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> lowPressure{8e5, 12e5};
+    std::uniform_real_distribution<double> highPressure{100e5, 200e5};
+    std::uniform_real_distribution<double> temperature{295.0, 305.0};
+    std::uniform_real_distribution<double> factor{0.9, 1.1};
+
+    std::vector<FluidState> states(100);
+    for (std::size_t cell = 0; cell < states.size(); ++cell) {
+        const double p = pressureFactor * (cell % 4 == 0 ? highPressure(gen) : lowPressure(gen));
+        const Evaluation p_init = Evaluation::createVariable(p, 0);
+        const Evaluation T_init = Evaluation::createVariable(temperature(gen), 1);
+
+        const double z0 = 0.5*factor(gen);
+        const double z1 = 0.3*factor(gen);
+        const double z2 = 0.2*factor(gen);
+        const double sum = z0 + z1 + z2;
+        ComponentVector comp;
+        comp[0] = Evaluation::createVariable(z0/sum, 2);
+        comp[1] = Evaluation::createVariable(z1/sum, 3);
+        comp[2] = 1. - comp[0] - comp[1];
+
+        auto& fluid_state = states[cell];
+        fluid_state.setPressure(FluidSystem::oilPhaseIdx, p_init);
+        fluid_state.setPressure(FluidSystem::gasPhaseIdx, p_init);
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluid_state.setMoleFraction(compIdx, comp[compIdx]);
+        }
+        fluid_state.setTemperature(T_init);
+
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluid_state.setKvalue(compIdx, fluid_state.wilsonK_(compIdx));
+        }
+        fluid_state.setLvalue(1.);
+    }
+
+    return states;
+}
+
+} // Anonymous namespace
+
+#if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 > 66
+BOOST_DATA_TEST_CASE(PtFlashBatch, test_methods)
+#else
+BOOST_AUTO_TEST_CASE(PtFlashBatch)
+#endif
+{
+#if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 67
+for (const auto& sample : test_methods) {
+#endif
+    using Flash = Opm::PTFlash<double, FluidSystem, true>;
+    using FlashBatch = Opm::PTFlashBatch<double, FluidSystem, true>;
+    const double flash_tolerance = 1.e-8;
+
+    for (const auto& eos_type : test_eos_types) {
+        const auto eos_string = Opm::CompositionalConfig::eosTypeToString(eos_type);
+        FlashBatch::Workspace workspace;
+
+        // The second batch is warm-started from the first one.
+        for (const double pressureFactor : { 1.0, 1.01 }) {
+            const bool warm = pressureFactor != 1.0;
+            // The warm-started flash converges to a slightly different
+            // solution within the tolerance of the flash.
+            const double tolerance = warm ? 1e-5 : 1e-8;
+
+            auto states = batchStates(pressureFactor);
+            auto batch_states = states;
+            FlashBatch::solve(std::span{batch_states}, workspace, sample, flash_tolerance, eos_type);
+
+            for (std::size_t cell = 0; cell < states.size(); ++cell) {
+                const bool is_single_phase = Flash::solve(states[cell], sample, flash_tolerance, eos_type);
+                BOOST_CHECK_MESSAGE(workspace.isSinglePhase(cell) == is_single_phase,
+                                    "EOS type " << eos_string << ": phase state of cell " << cell << " does not match");
+
+                const auto& fs = states[cell];
+                const auto& batch_fs = batch_states[cell];
+                for (int comp_idx = 0; comp_idx < numComponents; ++comp_idx) {
+                    BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(batch_fs.moleFraction(FluidSystem::oilPhaseIdx, comp_idx),
+                                                                             fs.moleFraction(FluidSystem::oilPhaseIdx, comp_idx), tolerance),
+                                        "EOS type " << eos_string << ": x of cell " << cell << " does not match");
+                    BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(batch_fs.moleFraction(FluidSystem::gasPhaseIdx, comp_idx),
+                                                                             fs.moleFraction(FluidSystem::gasPhaseIdx, comp_idx), tolerance),
+                                        "EOS type " << eos_string << ": y of cell " << cell << " does not match");
+                }
+                BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(batch_fs.L(), fs.L(), tolerance),
+                                    "EOS type " << eos_string << ": L of cell " << cell << " does not match");
+            }
+        }
+    }
+#if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 67
+}
+#endif
+}
+
+#if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 > 66
+BOOST_DATA_TEST_CASE(PtFlashStabilityCache, test_methods)
+#else
+BOOST_AUTO_TEST_CASE(PtFlashStabilityCache)
+#endif
+{
+#if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 67
+for (const auto& sample : test_methods) {
+#endif
+    using Flash = Opm::PTFlash<double, FluidSystem, true>;
+    const double flash_tolerance = 1.e-8;
+
+    for (const auto& eos_type : test_eos_types) {
+        const auto eos_string = Opm::CompositionalConfig::eosTypeToString(eos_type);
+        Flash::StabilityCache cache(batchStates(1.0).size());
+
+        // The first step fills the cache, the second one changes the pressure
+        // by less than the threshold and may skip the stability test, the
+        // third one changes it by more than the threshold.
+        std::size_t expected_lookups = 0;
+        for (const double pressureFactor : { 1.0, 1.0001, 1.1 }) {
+            const bool skip = pressureFactor == 1.0001;
+            const double tolerance = skip ? 1e-5 : 1e-8;
+            const auto hits_before = cache.counters().singlePhaseHits + cache.counters().twoPhaseHits;
+
+            auto states = batchStates(pressureFactor);
+            auto cached_states = states;
+            for (std::size_t cell = 0; cell < states.size(); ++cell) {
+                const bool is_single_phase = Flash::solve(states[cell], sample, flash_tolerance, eos_type);
+                const bool is_single_phase_cached = Flash::solve(cached_states[cell], sample, flash_tolerance,
+                                                                 eos_type, cache, cell);
+                BOOST_CHECK_MESSAGE(is_single_phase_cached == is_single_phase,
+                                    "EOS type " << eos_string << ": phase state of cell " << cell << " does not match");
+
+                const auto& fs = states[cell];
+                const auto& cached_fs = cached_states[cell];
+                for (int comp_idx = 0; comp_idx < numComponents; ++comp_idx) {
+                    BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(cached_fs.moleFraction(FluidSystem::oilPhaseIdx, comp_idx),
+                                                                             fs.moleFraction(FluidSystem::oilPhaseIdx, comp_idx), tolerance),
+                                        "EOS type " << eos_string << ": x of cell " << cell << " does not match");
+                    BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(cached_fs.moleFraction(FluidSystem::gasPhaseIdx, comp_idx),
+                                                                             fs.moleFraction(FluidSystem::gasPhaseIdx, comp_idx), tolerance),
+                                        "EOS type " << eos_string << ": y of cell " << cell << " does not match");
+                }
+                BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(cached_fs.L(), fs.L(), tolerance),
+                                    "EOS type " << eos_string << ": L of cell " << cell << " does not match");
+            }
+
+            expected_lookups += states.size();
+            const auto counters = cache.counters();
+            const auto hits = counters.singlePhaseHits + counters.twoPhaseHits;
+            BOOST_CHECK_EQUAL(counters.lookups, expected_lookups);
+            if (skip) {
+                BOOST_CHECK_MESSAGE(hits > hits_before, "EOS type " << eos_string << ": no stability test skipped");
+            }
+            else {
+                BOOST_CHECK_EQUAL(hits, hits_before);
+            }
+        }
+    }
+#if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 67
+}
+#endif
+}
@@ -48,6 +48,8 @@
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
 #include <opm/input/eclipse/Schedule/Action/Actions.hpp>
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/Action/CompiledCondition.hpp>
 #include <opm/input/eclipse/Schedule/Action/SimulatorUpdate.hpp>
 #include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/Action/WGNames.hpp>
@@ -857,6 +859,89 @@ BOOST_AUTO_TEST_CASE(TestFieldAND)
     }
 }
 
+BOOST_AUTO_TEST_CASE(CompiledConditionMatchesAST)
+{
+    const auto conditions = std::vector<std::vector<std::string>> {
+        {"WOPR", "*", ">", "1.0"},
+        {"WOPR", "P*", ">", "1.0", "AND", "WWCT", "*", "<", "0.50"},
+        {"WOPR", "*", ">", "1.0", "OR", "WWCT", "*", "<", "0.50"},
+        {"FOPR", ">", "100", "AND", "WWCT", "'P*'", "<", "0.5"},
+        {"FOPR", "<", "100", "OR", "WOPR", "'P1'", ">=", "1"},
+        {"WOPR", "'P1'", ">", "FOPR", "AND", "WWCT", "I*", "!=", "0"},
+        {"WOPR", "*LIST1", ">", "1.0", "AND", "(", "FOPR", ">", "100", "OR", "WWCT", "*", "<=", "0.5", ")"},
+        {"FOPR", ">", "100", "OR", "FOPR", "<", "10"},
+    };
+
+    SummaryState st(TimeService::now(), 0.0);
+    WListManager wlm;
+    wlm.newList("*LIST1", {"P1", "I1", "P2"});
+    Action::Context context(st, wlm);
+
+    auto compiled = std::vector<Action::CompiledCondition>{};
+    auto trees = std::vector<std::unique_ptr<Action::ASTNode>>{};
+    for (const auto& condition : conditions) {
+        trees.push_back(Action::Parser::parseCondition(condition));
+
+        auto compiled_condition = Action::CompiledCondition::compile(*trees.back());
+        BOOST_REQUIRE_MESSAGE(compiled_condition.has_value(),
+                              "Condition " << trees.size() << " must be compiled");
+
+        compiled.push_back(std::move(*compiled_condition));
+    }
+
+    auto check_all = [&]()
+    {
+        for (auto i = 0*trees.size(); i < trees.size(); ++i) {
+            const auto result = compiled[i].eval(context);
+            if (! result.has_value()) {
+                // Evaluation fails only if the AST fails too, e.g., for
+                // well list members without summary values.
+                BOOST_CHECK_THROW(trees[i]->eval(context), std::exception);
+                continue;
+            }
+
+            BOOST_CHECK_MESSAGE(*result == trees[i]->eval(context),
+                                "Condition " << i << " must match AST");
+        }
+    };
+
+    st.update("FOPR", 150.0);
+    st.update_well_var("P1", "WOPR", 2.0);
+    st.update_well_var("P2", "WOPR", 0.5);
+    st.update_well_var("I1", "WOPR", 3.0);
+    st.update_well_var("P1", "WWCT", 0.2);
+    st.update_well_var("P2", "WWCT", 0.7);
+    st.update_well_var("I1", "WWCT", 0.0);
+    check_all();
+
+    st.update("FOPR", 5.0);
+    st.update_well_var("P2", "WOPR", 1.5);
+    st.update_well_var("I1", "WWCT", 0.3);
+    check_all();
+
+    // New well.  Well name patterns must be expanded anew.
+    st.update_well_var("P3", "WOPR", 4.0);
+    st.update_well_var("P3", "WWCT", 0.1);
+    check_all();
+    {
+        const auto result = compiled[0].eval(context);
+        BOOST_REQUIRE(result.has_value());
+        BOOST_CHECK(result->matches().hasWell("P3"));
+    }
+
+    st.erase_well_var("P1", "WOPR");
+    check_all();
+
+    // Missing summary vector.  Evaluation fails, the AST throws.
+    st.erase("FOPR");
+    BOOST_CHECK(! compiled[3].eval(context).has_value());
+    BOOST_CHECK_THROW(trees[3]->eval(context), std::exception);
+
+    // Well pattern on right hand side is not supported.
+    BOOST_CHECK(! Action::CompiledCondition::compile
+                (*Action::Parser::parseCondition({"FOPR", ">", "WOPR", "P*"})).has_value());
+}
+
 BOOST_AUTO_TEST_CASE(Conditions)
 {
     auto location = KeywordLocation("Keyword", "File", 100);
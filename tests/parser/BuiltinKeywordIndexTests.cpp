@@ -0,0 +1,198 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE BuiltinKeywordIndexTests
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/json/JsonObject.hpp>
+
+#include <opm/input/eclipse/Parser/BuiltinKeywordIndex.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Parser/ParserKeyword.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Opm;
+
+namespace {
+
+    // Parser with all built-in keywords constructed up front, in generator
+    // order, as Parser() did before built-in keywords were constructed on
+    // first use.
+    Parser eagerParser()
+    {
+        const auto& index = ParserKeywords::builtinKeywordIndex();
+
+        auto parser = Parser { false };
+        for (auto keyword = 0*index.numKeywords(); keyword < index.numKeywords(); ++keyword) {
+            parser.addParserKeyword(index.create(keyword));
+        }
+
+        return parser;
+    }
+
+    std::vector<std::string> sorted(std::vector<std::string> names)
+    {
+        std::sort(names.begin(), names.end());
+        return names;
+    }
+
+    // Names which differ from 'name' by a single character.
+    std::vector<std::string> nearMisses(const std::string& name)
+    {
+        auto misses = std::vector<std::string> {
+            name.substr(0, name.size() - 1),
+            name.substr(1),
+            name + 'X',
+            'X' + name,
+        };
+
+        for (auto i = 0*name.size(); i < name.size(); ++i) {
+            for (const auto c : { 'A', 'Z', '0', '_' }) {
+                auto miss = name;
+                miss[i] = (miss[i] == c) ? 'Q' : c;
+                misses.push_back(miss);
+            }
+        }
+
+        return misses;
+    }
+
+    ParserKeyword explicitPORO()
+    {
+        return ParserKeyword {
+            Json::JsonObject { R"({"name": "EXPLICIT_PORO", "deck_names": ["PORO"], "sections": ["GRID"], "size": 0})" }
+        };
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Deck_Names_Resolve)
+{
+    const auto& index = ParserKeywords::builtinKeywordIndex();
+    const auto deck_names = index.deckNames();
+
+    BOOST_REQUIRE(! deck_names.empty());
+    BOOST_CHECK_EQUAL(std::set<std::string_view>(deck_names.begin(), deck_names.end()).size(),
+                      deck_names.size());
+
+    const auto parser = Parser{};
+    for (const auto& deck_name : deck_names) {
+        BOOST_TEST_CONTEXT("Deck name " << deck_name) {
+            const auto keyword = index.find(deck_name);
+            BOOST_REQUIRE(keyword.has_value());
+            BOOST_CHECK(index.create(*keyword).deck_names().count(std::string { deck_name }) == 1);
+
+            BOOST_CHECK(parser.hasKeyword(std::string { deck_name }));
+            BOOST_CHECK(parser.getParserKeywordFromDeckName(deck_name)
+                        .deck_names().count(std::string { deck_name }) == 1);
+        }
+    }
+
+    BOOST_CHECK_THROW(index.create(index.numKeywords()), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Non_Keywords_Miss)
+{
+    const auto& index = ParserKeywords::builtinKeywordIndex();
+    const auto deck_names = index.deckNames();
+    const auto known = std::set<std::string_view>(deck_names.begin(), deck_names.end());
+
+    for (const auto* name : { "", "X", "NOTAKEYWD", "poro", "PORO ", "WELSPECSX" }) {
+        BOOST_CHECK_MESSAGE(! index.find(name).has_value(), "Name '" << name << "' must not resolve");
+    }
+
+    for (const auto& deck_name : deck_names) {
+        for (const auto& miss : nearMisses(std::string { deck_name })) {
+            const auto keyword = index.find(miss);
+
+            BOOST_CHECK_MESSAGE(keyword.has_value() == known.contains(miss),
+                                "Name '" << miss << "' near '" << deck_name << "'");
+
+            if (keyword.has_value()) {
+                BOOST_CHECK(index.create(*keyword).deck_names().count(miss) == 1);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Same_As_Eager_Construction)
+{
+    const auto parser = Parser{};
+    const auto eager = eagerParser();
+
+    BOOST_CHECK_EQUAL(parser.size(), eager.size());
+
+    const auto names = sorted(parser.getAllDeckNames());
+    const auto eager_names = sorted(eager.getAllDeckNames());
+    BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                  eager_names.begin(), eager_names.end());
+
+    // Looking up keywords does not change the set of deck names.
+    for (const auto& name : { "PORO", "WELSPECS", "TSTEP" }) {
+        BOOST_CHECK(&parser.getKeyword(name) == &parser.getKeyword(name));
+    }
+
+    BOOST_CHECK_EQUAL(parser.size(), eager.size());
+}
+
+BOOST_AUTO_TEST_CASE(Explicit_Keyword_Takes_Precedence)
+{
+    BOOST_REQUIRE(ParserKeywords::builtinKeywordIndex().find("PORO").has_value());
+
+    // Built-in PORO not yet constructed.
+    {
+        auto parser = Parser{};
+        const auto size = parser.size();
+
+        parser.addParserKeyword(explicitPORO());
+
+        BOOST_CHECK_EQUAL(parser.getKeyword("PORO").getName(), "EXPLICIT_PORO");
+        BOOST_CHECK(parser.hasKeyword("PORO"));
+        BOOST_CHECK_EQUAL(parser.size(), size);
+    }
+
+    // Built-in PORO already constructed.
+    {
+        auto parser = Parser{};
+        BOOST_CHECK_EQUAL(parser.getKeyword("PORO").getName(), "PORO");
+
+        parser.addParserKeyword(explicitPORO());
+        BOOST_CHECK_EQUAL(parser.getKeyword("PORO").getName(), "EXPLICIT_PORO");
+    }
+
+    // Copies share constructed built-in keywords but not explicitly added
+    // ones.
+    {
+        const auto parser = Parser{};
+        auto copy = parser;
+
+        copy.addParserKeyword(explicitPORO());
+
+        BOOST_CHECK_EQUAL(copy.getKeyword("PORO").getName(), "EXPLICIT_PORO");
+        BOOST_CHECK_EQUAL(parser.getKeyword("PORO").getName(), "PORO");
+    }
+}
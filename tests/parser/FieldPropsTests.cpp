@@ -922,6 +922,336 @@ OPERATE
     BOOST_CHECK_EQUAL(multz[3], 0.75);
 }
 
+BOOST_AUTO_TEST_CASE(Fused_Scalar_Operations)
+{
+    const auto deck = Parser{}.parseString(R"(
+GRID
+
+PORO
+   12*0.25 /
+
+PERMX
+   12*100 /
+
+MULTIPLY
+    PERMX   2.0   1 3   1 2   1 1 /
+    PERMX   3.0   1 3   1 2   1 1 /
+    PORO    0.5   1 3   1 2   1 1 /
+    PERMX  10.0   1 3   1 2   2 2 /
+/
+
+ADD
+    PERMX   1.0   1 3   1 2   1 1 /
+    PERMX   2.0 /
+/
+
+MAXVALUE
+    PORO    0.2 /
+    PORO    0.15 /
+/
+)");
+
+    UnitSystem unit_system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    auto to_si = [&unit_system](double raw_value) { return unit_system.to_si(UnitSystem::measure::permeability, raw_value); };
+
+    // Note: 'grid' must be mutable.
+    auto grid = EclipseGrid { 3, 2, 2 };
+    const auto fpm = FieldPropsManager { deck, Phases{true, true, true}, grid, TableManager{} };
+
+    const auto& permx = fpm.get_double("PERMX");
+    const auto& poro = fpm.get_double("PORO");
+    for (std::size_t i = 0; i < 6; ++i) {
+        BOOST_CHECK_CLOSE(permx[i], to_si(603.0), 1.0e-10);
+        BOOST_CHECK_CLOSE(permx[i + 6], to_si(1000.0), 1.0e-10);
+
+        BOOST_CHECK_CLOSE(poro[i], 0.125, 1.0e-10);
+        BOOST_CHECK_CLOSE(poro[i + 6], 0.15, 1.0e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Fused_Scalar_Operations_Undefined)
+{
+    const auto deck = Parser{}.parseString(R"(
+GRID
+
+PERMY
+   12*100 /
+
+EQUALS
+    PERMZ   1.0   1 1   1 1   1 1 /
+/
+
+MULTIPLY
+    PERMZ   2.0   1 1   1 1   1 1 /
+    PERMZ   2.0   1 3   1 2   1 1 /
+/
+)");
+
+    // Note: 'grid' must be mutable.
+    auto grid = EclipseGrid { 3, 2, 2 };
+
+    BOOST_CHECK_THROW(FieldPropsManager(deck, Phases{true, true, true}, grid, TableManager{}),
+                      OpmInputError);
+}
+
+BOOST_AUTO_TEST_CASE(Fused_Region_Operations)
+{
+    const auto deck = Parser{}.parseString(R"(
+GRID
+
+PORO
+   6*0.2 /
+
+PERMX
+   6*100 /
+
+MULTNUM
+   1 1 1 2 2 2 /
+
+FLUXNUM
+   1 2 1 2 1 2 /
+
+MULTIREG
+    PERMX   2.0   1 M /
+    PERMX   3.0   1 /
+    PERMX   7.0   1 F /
+    PERMX   5.0   2 M /
+    PORO    0.5   1 M /
+/
+
+EQUALREG
+    SATNUM  1   1 M /
+    SATNUM  3   1 M /
+    SATNUM  2   2 M /
+/
+
+ADDREG
+    SATNUM  1   2 M /
+    SATNUM  1   2 M /
+/
+)");
+
+    UnitSystem unit_system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    auto to_si = [&unit_system](double raw_value) { return unit_system.to_si(UnitSystem::measure::permeability, raw_value); };
+
+    // Note: 'grid' must be mutable.
+    auto grid = EclipseGrid { 3, 2, 1 };
+    const auto fpm = FieldPropsManager { deck, Phases{true, true, true}, grid, TableManager{} };
+
+    // The defaulted region set is FLUXNUM, so the second and third PERMX
+    // records operate on the same region.
+    const auto expect_permx = std::vector<double> { 4200.0, 200.0, 4200.0, 500.0, 10500.0, 500.0 };
+    const auto expect_poro = std::vector<double> { 0.1, 0.1, 0.1, 0.2, 0.2, 0.2 };
+    const auto expect_satnum = std::vector<int> { 3, 3, 3, 4, 4, 4 };
+
+    const auto& permx = fpm.get_double("PERMX");
+    const auto& poro = fpm.get_double("PORO");
+    for (std::size_t i = 0; i < expect_permx.size(); ++i) {
+        BOOST_CHECK_CLOSE(permx[i], to_si(expect_permx[i]), 1.0e-10);
+        BOOST_CHECK_CLOSE(poro[i], expect_poro[i], 1.0e-10);
+    }
+
+    const auto& satnum = fpm.get_int("SATNUM");
+    BOOST_CHECK_EQUAL_COLLECTIONS(satnum.begin(), satnum.end(),
+                                  expect_satnum.begin(), expect_satnum.end());
+}
+
+BOOST_AUTO_TEST_CASE(Fused_Region_Operations_Undefined)
+{
+    const auto deck = Parser{}.parseString(R"(
+GRID
+
+MULTNUM
+   1 1 1 2 2 2 /
+
+EQUALREG
+    PERMZ   1.0   1 M /
+/
+
+MULTIREG
+    PERMZ   2.0   1 M /
+    PERMZ   2.0   2 M /
+/
+)");
+
+    // Note: 'grid' must be mutable.
+    auto grid = EclipseGrid { 3, 2, 1 };
+
+    BOOST_CHECK_THROW(FieldPropsManager(deck, Phases{true, true, true}, grid, TableManager{}),
+                      OpmInputError);
+}
+
+BOOST_AUTO_TEST_CASE(OPERATE_Slab_And_Subbox)
+{
+    const auto deck = Parser{}.parseString(R"(
+GRID
+
+PERMY
+   12*10 /
+
+OPERATE
+    PERMZ   1 3   1 2   2 2  'MULTA'  PERMY 2 1 /
+    PERMZ   2 3   1 2   1 1  'MULTA'  PERMY 3 0 /
+    PERMZ   1 1   1 2   1 1  'MULTA'  PERMY 1 5 /
+/
+)");
+
+    UnitSystem unit_system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    auto to_si = [&unit_system](double raw_value) { return unit_system.to_si(UnitSystem::measure::permeability, raw_value); };
+
+    // Deactivate one cell in the bottom layer.  The layer is still a
+    // contiguous range of active cells.
+    auto grid = EclipseGrid { 3, 2, 2 };
+    grid.resetACTNUM(std::vector<int> { 1, 1, 1, 1, 1, 1,   1, 0, 1, 1, 1, 1 });
+
+    const auto fpm = FieldPropsManager { deck, Phases{true, true, true}, grid, TableManager{} };
+
+    const auto& permz = fpm.get_double("PERMZ");
+    BOOST_REQUIRE_EQUAL(permz.size(), std::size_t{11});
+
+    const auto expect = std::vector<double> {
+        15.0, 30.0, 30.0, 15.0, 30.0, 30.0,
+        21.0,       21.0, 21.0, 21.0, 21.0,
+    };
+
+    for (std::size_t i = 0; i < expect.size(); ++i) {
+        BOOST_CHECK_CLOSE(permz[i], to_si(expect[i]), 1.0e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Deferred_Keywords_And_Release)
+{
+    const auto deck = Parser{}.parseString(R"(
+GRID
+
+BOX
+  1 3   1 2   1 1 /
+PERMX
+   6*100 /
+ENDBOX
+
+BOX
+  1 3   1 2   2 2 /
+PERMX
+   6*200 /
+ENDBOX
+
+PORO
+   12*0.25 /
+
+REGIONS
+
+SATNUM
+   6*1 6*2 /
+
+FIPABC
+   12*3 /
+)");
+
+    UnitSystem unit_system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    auto to_si = [&unit_system](double raw_value) { return unit_system.to_si(UnitSystem::measure::permeability, raw_value); };
+
+    // Note: 'grid' must be mutable.
+    auto grid = EclipseGrid { 3, 2, 2 };
+    auto fpm = FieldPropsManager { deck, Phases{true, true, true}, grid, TableManager{} };
+
+    // Deactivate a cell before any of the arrays have been requested.
+    auto actnum = std::vector<int>(12, 1);
+    actnum[0] = 0;
+    fpm.reset_actnum(actnum);
+
+    BOOST_CHECK(fpm.has_double("PERMX"));
+    BOOST_CHECK(fpm.has_int("FIPABC"));
+
+    const auto& permx = fpm.get_double("PERMX");
+    BOOST_REQUIRE_EQUAL(permx.size(), std::size_t{11});
+    for (std::size_t i = 0; i < 5; ++i) {
+        BOOST_CHECK_CLOSE(permx[i], to_si(100.0), 1.0e-10);
+        BOOST_CHECK_CLOSE(permx[i + 5], to_si(200.0), 1.0e-10);
+    }
+
+    const auto& satnum = fpm.get_int("SATNUM");
+    BOOST_REQUIRE_EQUAL(satnum.size(), std::size_t{11});
+    BOOST_CHECK_EQUAL(satnum[4], 1);
+    BOOST_CHECK_EQUAL(satnum[5], 2);
+
+    const auto fip_regions = fpm.fip_regions();
+    BOOST_CHECK(std::find(fip_regions.begin(), fip_regions.end(), "FIPABC") != fip_regions.end());
+
+    {
+        const auto keys = fpm.keys<double>();
+        BOOST_CHECK(std::find(keys.begin(), keys.end(), "PORO") != keys.end());
+    }
+
+    fpm.release<double>("PORO");
+    fpm.release<int>("FIPABC");
+
+    BOOST_CHECK(!fpm.has_double("PORO"));
+    BOOST_CHECK(!fpm.has_int("FIPABC"));
+    BOOST_CHECK(fpm.has_double("PERMX"));
+
+    {
+        const auto keys = fpm.keys<double>();
+        BOOST_CHECK(std::find(keys.begin(), keys.end(), "PORO") == keys.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Deferred_Keywords_Shared_Between_Copies)
+{
+    auto grid = EclipseGrid { 3, 2, 2 };
+
+    // The deck does not outlive the property container.
+    auto fp = [&grid]()
+    {
+        const auto deck = Parser{}.parseString(R"(
+GRID
+
+THCONR
+   12*100 /
+
+REGIONS
+
+SATNUM
+   6*1 6*2 /
+)");
+
+        auto props = FieldProps { deck, Phases{true, true, true}, grid, TableManager{}, 0 };
+
+        // Deferred keywords are copies of the deck's keywords.
+        const auto thconr = props.deferred_keywords<double>("THCONR");
+        BOOST_REQUIRE_EQUAL(thconr.size(), std::size_t{1});
+        BOOST_CHECK(*thconr.front() == deck["THCONR"].back());
+        BOOST_CHECK(&thconr.front()->getRecord(0) != &deck["THCONR"].back().getRecord(0));
+
+        return props;
+    }();
+
+    const auto thconr = fp.deferred_keywords<double>("THCONR");
+    const auto satnum = fp.deferred_keywords<int>("SATNUM");
+    BOOST_REQUIRE_EQUAL(thconr.size(), std::size_t{1});
+    BOOST_REQUIRE_EQUAL(satnum.size(), std::size_t{1});
+
+    // Copies of the property container share the deferred keywords.
+    auto copy = fp;
+    BOOST_CHECK(copy.deferred_keywords<double>("THCONR") == thconr);
+    BOOST_CHECK(copy.deferred_keywords<int>("SATNUM") == satnum);
+    BOOST_CHECK(copy == fp);
+
+    // Materialising a property in one copy leaves the other copy's
+    // deferred keywords in place.
+    const auto& copy_thconr = copy.get<double>("THCONR");
+    BOOST_CHECK_EQUAL(copy_thconr.size(), std::size_t{12});
+    BOOST_CHECK_CLOSE(copy_thconr[7], 100.0*prefix::kilo*unit::joule/(unit::day*unit::meter), 1.0e-10);
+
+    BOOST_CHECK(copy.deferred_keywords<double>("THCONR").empty());
+    BOOST_CHECK(fp.deferred_keywords<double>("THCONR") == thconr);
+    BOOST_CHECK_CLOSE(thconr.front()->getRawDoubleData()[7], 100.0, 1.0e-10);
+
+    const auto& thconr_data = fp.get<double>("THCONR");
+    BOOST_CHECK_CLOSE(thconr_data[7], copy_thconr[7], 1.0e-10);
+    BOOST_CHECK_EQUAL(fp.deferred_keywords<int>("SATNUM").size(), std::size_t{1});
+}
+
 BOOST_AUTO_TEST_CASE(OPERATE_With_Work_Arrays)
 {
     const auto deck = Parser{}.parseString(R"(RUNSPEC
@@ -28,6 +28,8 @@
 #include <opm/input/eclipse/EclipseState/Tables/TableSchema.hpp>
 
 #include <cstddef>
+#include <stdexcept>
+#include <vector>
 
 using namespace Opm;
 
@@ -82,3 +84,63 @@ BOOST_AUTO_TEST_CASE( CreateTest ) {
             BOOST_CHECK_EQUAL( col[i] , exportCol[i]);
     }
 }
+
+BOOST_AUTO_TEST_CASE( EvaluatorHandle ) {
+    TableSchema schema;
+
+    {
+        ColumnSchema col1("X" , Table::INCREASING , Table::DEFAULT_NONE);
+        ColumnSchema col2("Y" , Table::RANDOM , Table::DEFAULT_NONE);
+        ColumnSchema col3("Z" , Table::STRICTLY_DECREASING , Table::DEFAULT_NONE);
+        schema.addColumn( col1 );
+        schema.addColumn( col2 );
+        schema.addColumn( col3 );
+    }
+
+    SimpleTable table(schema);
+    table.addRow( {1.0, 10.0,  5.0}, "TableTested" );
+    table.addRow( {2.0, 30.0,  4.0}, "TableTested" );
+    table.addRow( {2.0, 35.0,  3.0}, "TableTested" );
+    table.addRow( {4.0, 20.0,  1.0}, "TableTested" );
+    table.addRow( {5.0, 40.0,  0.5}, "TableTested" );
+
+    // Monotone, repeated, and random positions, including the table's
+    // end-points, repeated values, and extrapolation.
+    const std::vector<double> xPos {
+        0.0, 1.0, 1.5, 1.9, 2.0, 2.5, 3.0, 4.0, 4.5, 5.0, 6.0,
+        4.2, 1.2, 3.3, 3.3, 2.0, 0.5, 4.9,
+    };
+
+    {
+        auto eval = table.evaluator("Y");
+        for (const auto& x : xPos) {
+            BOOST_CHECK_EQUAL( eval(x), table.evaluate("Y", x) );
+        }
+    }
+
+    {
+        auto eval = table.evaluator("Y");
+        std::vector<double> yVal(xPos.size());
+        eval(xPos, yVal);
+
+        for (std::size_t i = 0; i < xPos.size(); ++i) {
+            BOOST_CHECK_EQUAL( yVal[i], table.evaluate("Y", xPos[i]) );
+        }
+
+        std::vector<double> tooShort(xPos.size() - 1);
+        BOOST_CHECK_THROW( eval(xPos, tooShort), std::invalid_argument );
+    }
+
+    {
+        // Decreasing argument column.
+        auto eval = table.evaluator("Z", "X");
+        const auto& z = table.getColumn("Z");
+        const auto& x = table.getColumn("X");
+        for (const auto& zPos : { 6.0, 5.0, 4.5, 3.5, 3.0, 2.0, 1.0, 0.7, 0.5, 0.0, 2.2 }) {
+            BOOST_CHECK_EQUAL( eval(zPos), x.eval(z.lookup(zPos)) );
+        }
+    }
+
+    BOOST_CHECK_THROW( table.evaluator("NoSuchColumn"), std::invalid_argument );
+    BOOST_CHECK_THROW( table.evaluator("Y", "X"), std::invalid_argument );
+}
@@ -40,10 +40,12 @@
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQAssign.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQCompiledDefine.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQDefine.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEvalPlan.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
@@ -73,6 +75,7 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -566,6 +569,223 @@ BOOST_AUTO_TEST_CASE(UDQ_DEFINETEST) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_COMPILED_DEFINE)
+{
+    using namespace std::string_literals;
+
+    UDQParams udqp;
+    UDQFunctionTable udqft(udqp);
+    KeywordLocation location;
+
+    SummaryState st(TimeService::now(), udqp.undefinedValue());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2", "P3", "I1"}));
+    UDQContext context(udqft, wm, {}, {}, UDQContext::MatcherFactories{}, st, udq_state);
+
+    st.update_well_var("P1", "WOPR", 100);
+    st.update_well_var("P2", "WOPR", 200);
+    st.update_well_var("P3", "WOPR", 0);
+    st.update_well_var("P1", "WWCT", 0.5);
+    st.update_well_var("P2", "WWCT", 0.25);
+    st.update_well_var("P3", "WWCT", 0.75);
+    st.update_well_var("I1", "WWCT", 0);
+    st.update("FOPR", 300);
+
+    {
+        auto wux = UDQSet::wells("WUX", std::vector { "P1"s, "P2"s, "P3"s, "I1"s });
+        wux.assign("P1", 1.0);
+        wux.assign("P3", 3.0);
+        context.update_define(0, "WUX", wux);
+    }
+
+    const auto expressions = std::vector<std::pair<std::string, std::vector<std::string>>> {
+        { "WU1", { "WOPR", "*", "2" } },
+        { "WU2", { "WOPR", "/", "WWCT" } },
+        { "WU3", { "WOPR", "/", "(", "WWCT", "-", "0.5", ")" } },
+        { "WU4", { "SUM", "(", "WOPR", ")", "*", "WWCT" } },
+        { "WU5", { "-", "WOPR", "+", "WOPR", "'P2'" } },
+        { "WU6", { "SORTA", "(", "WOPR", ")" } },
+        { "WU7", { "SORTD", "(", "WWCT", ")" } },
+        { "WU8", { "IDV", "(", "WOPR", ")" } },
+        { "WU9", { "DEF", "(", "WOPR", ")", "+", "NINT", "(", "WWCT", ")" } },
+        { "WU10", { "EXP", "(", "WWCT", ")", "*", "ABS", "(", "WUX", ")" } },
+        { "WU11", { "WOPR", ">", "150" } },
+        { "WU12", { "WOPR", "<=", "100", "+", "(", "WWCT", "==", "0.25", ")" } },
+        { "WU13", { "WOPR", "UADD", "WUX" } },
+        { "WU14", { "WOPR", "UMIN", "WUX" } },
+        { "WU15", { "WUX", "^", "2", "+", "FOPR" } },
+        { "WU16", { "LN", "(", "WOPR", ")" } },
+        { "WU17", { "2", "*", "3" } },
+        { "FU1", { "SUM", "(", "WOPR", ")" } },
+        { "FU2", { "AVEA", "(", "WWCT", ")", "+", "MAX", "(", "WOPR", ")" } },
+        { "FU3", { "FOPR", "-", "WOPR", "'P1'" } },
+        { "FU4", { "NORM2", "(", "WOPR", ")", "*", "PROD", "(", "WUX", ")" } },
+        { "FU5", { "AVEG", "(", "WWCT", ")" } },
+        { "FU6", { "2", "*", "3" } },
+    };
+
+    for (const auto& [keyword, tokens] : expressions) {
+        BOOST_TEST_MESSAGE("UDQ " << keyword);
+
+        const auto def = UDQDefine { udqp, keyword, 0, location, tokens };
+        auto compiled = UDQCompiledDefine::compile(def, udqp.cmpEpsilon());
+        BOOST_REQUIRE_MESSAGE(compiled.has_value(),
+                              "UDQ " << keyword << " must be compiled");
+
+        const auto res = compiled->eval(context);
+        if (res.has_value()) {
+            BOOST_CHECK_MESSAGE(*res == def.eval(context),
+                                "Compiled UDQ " << keyword << " must match UDQDefine::eval()");
+        }
+        else {
+            BOOST_CHECK_THROW(def.eval(context), std::exception);
+        }
+    }
+
+    // LN(0), AVEG of zero
+    for (const auto* keyword : { "WU16", "FU5" }) {
+        const auto pos = std::find_if(expressions.begin(), expressions.end(),
+                                      [keyword](const auto& expr) { return expr.first == keyword; });
+
+        const auto def = UDQDefine { udqp, pos->first, 0, location, pos->second };
+        BOOST_CHECK_MESSAGE(! UDQCompiledDefine::compile(def, udqp.cmpEpsilon())->eval(context).has_value(),
+                            "Compiled UDQ " << keyword << " must fail at runtime");
+    }
+
+    // Well name patterns and random numbers are left to UDQDefine::eval().
+    {
+        const auto def = UDQDefine { udqp, "WUPAT", 0, location, { "WOPR", "'P*'" } };
+        BOOST_CHECK(! UDQCompiledDefine::compile(def, udqp.cmpEpsilon()).has_value());
+    }
+
+    {
+        const auto def = UDQDefine { udqp, "WURNG", 0, location, { "RANDN", "(", "WOPR", ")" } };
+        BOOST_CHECK(! UDQCompiledDefine::compile(def, udqp.cmpEpsilon()).has_value());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_INCREMENTAL_EVAL)
+{
+    UDQParams udqp;
+    UDQFunctionTable udqft(udqp);
+    KeywordLocation location;
+
+    auto definitions = std::unordered_map<std::string, UDQDefine>{};
+    auto defines = std::vector<const UDQDefine*>{};
+    for (const auto& [keyword, tokens] : std::vector<std::pair<std::string, std::vector<std::string>>> {
+            { "WU1", { "WOPR", "*", "2" } },
+            { "FU1", { "SUM", "(", "WU1", ")" } },
+            { "FU2", { "FOPR", "+", "1" } },
+            { "FU3", { "FU3", "+", "1" } },
+        })
+    {
+        definitions.emplace(keyword, UDQDefine { udqp, keyword, 0, location, tokens });
+    }
+
+    for (const auto* keyword : { "WU1", "FU1", "FU2", "FU3" }) {
+        defines.push_back(&definitions.at(keyword));
+    }
+
+    auto plan = UDQEvalPlan { defines, udqp.cmpEpsilon() };
+    BOOST_CHECK_EQUAL(plan.num_waves(), 2U);
+
+    SummaryState st(TimeService::now(), udqp.undefinedValue());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2"}));
+    UDQContext context(udqft, wm, {}, {}, UDQContext::MatcherFactories{}, st, udq_state);
+
+    st.update_well_var("P1", "WOPR", 100);
+    st.update_well_var("P2", "WOPR", 200);
+    st.update("FOPR", 300);
+    context.update_assign("FU3", UDQSet::scalar("FU3", 0.0));
+
+    auto check_counts = [&plan](const std::vector<std::size_t>& evaluations,
+                                const std::vector<std::size_t>& skipped)
+    {
+        const auto stats = plan.statistics();
+        BOOST_REQUIRE_EQUAL(stats.size(), evaluations.size());
+
+        for (auto i = 0*stats.size(); i < stats.size(); ++i) {
+            BOOST_CHECK_MESSAGE(stats[i].evaluations == evaluations[i],
+                                "UDQ " << stats[i].keyword << " must be evaluated "
+                                << evaluations[i] << " times");
+            BOOST_CHECK_MESSAGE(stats[i].skipped == skipped[i],
+                                "UDQ " << stats[i].keyword << " must be skipped "
+                                << skipped[i] << " times");
+            BOOST_CHECK(stats[i].seconds >= 0.0);
+        }
+    };
+
+    plan.eval(0, definitions, udq_state, context);
+    check_counts({1, 1, 1, 1}, {0, 0, 0, 0});
+    BOOST_CHECK_EQUAL(st.get("FU1"), 600.0);
+    BOOST_CHECK_EQUAL(st.get("FU2"), 301.0);
+
+    // Nothing changed.  Self referencing FU3 is always evaluated.
+    plan.eval(0, definitions, udq_state, context);
+    check_counts({1, 1, 1, 2}, {1, 1, 1, 0});
+
+    // FOPR changed.
+    st.update("FOPR", 310);
+    plan.eval(0, definitions, udq_state, context);
+    check_counts({1, 1, 2, 3}, {2, 2, 1, 0});
+    BOOST_CHECK_EQUAL(st.get("FU2"), 311.0);
+
+    // Same value for WOPR does not count as a change.
+    st.update_well_var("P1", "WOPR", 100);
+    plan.eval(0, definitions, udq_state, context);
+    check_counts({1, 1, 2, 4}, {3, 3, 2, 0});
+
+    // WOPR changed, and the change propagates to FU1 through WU1.
+    st.update_well_var("P1", "WOPR", 150);
+    plan.eval(0, definitions, udq_state, context);
+    check_counts({2, 2, 2, 5}, {3, 3, 3, 0});
+    BOOST_CHECK_EQUAL(st.get_well_var("P1", "WU1"), 300.0);
+    BOOST_CHECK_EQUAL(st.get("FU1"), 700.0);
+
+    // Assigning a value to a defined UDQ invalidates the stored value.
+    context.update_assign("FU2", UDQSet::scalar("FU2", 0.0));
+    plan.eval(0, definitions, udq_state, context);
+    check_counts({2, 2, 3, 6}, {4, 4, 3, 0});
+    BOOST_CHECK_EQUAL(st.get("FU2"), 311.0);
+
+    // Everything is evaluated at the start of a new report step.
+    plan.eval(1, definitions, udq_state, context);
+    check_counts({3, 3, 4, 7}, {4, 4, 3, 0});
+    BOOST_CHECK_EQUAL(st.get("FU3"), 7.0);
+}
+
+BOOST_AUTO_TEST_CASE(SUMMARY_STATE_REVISION)
+{
+    SummaryState st(TimeService::now(), 0.0);
+    st.update("FOPR", 100);
+    st.update_well_var("P1", "WOPR", 100);
+
+    // Changes are only tracked once the revision has been requested.
+    const auto fopr = st.revision("FOPR");
+    const auto wopr = st.revision("WOPR");
+    BOOST_CHECK(fopr > st.revision());
+    BOOST_CHECK(wopr > fopr);
+    BOOST_CHECK_EQUAL(st.revision("FOPR"), fopr);
+
+    // Same value does not count as a change.
+    st.update("FOPR", 100);
+    st.update_well_var("P1", "WOPR", 100);
+    BOOST_CHECK_EQUAL(st.revision("FOPR"), fopr);
+    BOOST_CHECK_EQUAL(st.revision("WOPR"), wopr);
+
+    st.update_well_var("P2", "WOPR", 200);
+    BOOST_CHECK_EQUAL(st.revision("FOPR"), fopr);
+    BOOST_CHECK(st.revision("WOPR") > wopr);
+
+    st.update("FOPR", 110);
+    BOOST_CHECK(st.revision("FOPR") > st.revision("WOPR"));
+
+    // A copy is new as a whole.
+    const auto copy = st;
+    BOOST_CHECK(copy.revision("FOPR") > st.revision("FOPR"));
+}
+
 BOOST_AUTO_TEST_CASE(Define_Update_Status)
 {
     using namespace std::string_literals;
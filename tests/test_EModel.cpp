@@ -0,0 +1,278 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE Test EModel
+#include <boost/test/unit_test.hpp>
+
+#include <opm/utility/EModel.hpp>
+
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ERst.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "tests/WorkArea.hpp"
+
+using namespace Opm::EclIO;
+
+namespace {
+
+// SPE1 grid of 10x10x3 active cells, which is not a multiple of the 64
+// cells per word of a cell mask.
+constexpr int nI = 10;
+constexpr int nJ = 10;
+constexpr int nK = 3;
+constexpr std::size_t nActive = nI * nJ * nK;
+
+const std::string rstFile = "SPE1_TESTCASE.UNRST";
+
+// NTG is undefined in every seventh cell.
+float ntg(const std::size_t cell)
+{
+    if (cell % 7 == 3)
+        return std::numeric_limits<float>::quiet_NaN();
+
+    return (cell % 2 == 0) ? 0.3f : 0.8f;
+}
+
+int fipnum(const std::size_t cell)
+{
+    return static_cast<int>(cell / (nI * nJ)) + 1;
+}
+
+int iIndex(const std::size_t cell)
+{
+    return static_cast<int>(cell % nI) + 1;
+}
+
+// Init file matching the restart file of the SPE1 test case, with some
+// extra cell properties to filter on.
+void writeInitFile()
+{
+    std::vector<int> intehead(411, 0);
+    intehead[8] = nI;
+    intehead[9] = nJ;
+    intehead[10] = nK;
+    intehead[11] = static_cast<int>(nActive);
+
+    std::vector<float> porv(nActive), ntgValues(nActive);
+    std::vector<int> fipnumValues(nActive);
+
+    for (std::size_t cell = 0; cell < nActive; cell++) {
+        porv[cell] = 1000.0f + static_cast<float>(cell);
+        ntgValues[cell] = ntg(cell);
+        fipnumValues[cell] = fipnum(cell);
+    }
+
+    EclOutput init("SPE1_TESTCASE.INIT", false);
+    init.write("INTEHEAD", intehead);
+    init.write("PORV", porv);
+    init.write("NTG", ntgValues);
+    init.write("FIPNUM", fipnumValues);
+}
+
+struct Bounds
+{
+    float low;
+    float high;
+};
+
+// Lower and upper quartile of the pressure at report step rstep.
+Bounds pressureBounds(const int rstep)
+{
+    ERst rst(rstFile);
+    auto pressure = rst.getRestartData<float>("PRESSURE", rstep, 0);
+    std::ranges::sort(pressure);
+
+    return { pressure[nActive / 4], pressure[3 * nActive / 4] };
+}
+
+EModel::FilterPipeline pipeline(const Bounds& bounds)
+{
+    EModel::FilterPipeline filter;
+
+    filter.add("FIPNUM", "lt", 3)
+        .add("I", "between", 1, 10)
+        .add("PRESSURE", "between", bounds.low, bounds.high)
+        .add("NTG", "gt", 0.5f);
+
+    return filter;
+}
+
+void addFilterChain(EModel& model, const Bounds& bounds)
+{
+    model.addFilter<int>("FIPNUM", "lt", 3);
+    model.addFilter<int>("I", "between", 1, 10);
+    model.addFilter<float>("PRESSURE", "between", bounds.low, bounds.high);
+    model.addFilter<float>("NTG", "gt", 0.5f);
+}
+
+// Cells selected by pipeline(bounds) at report step rstep, evaluated
+// cell by cell.  Cells are kept unless they fail a comparison, so cells
+// with an undefined NTG are kept.
+std::vector<std::size_t> referenceCells(const int rstep, const Bounds& bounds)
+{
+    ERst rst(rstFile);
+    const auto& pressure = rst.getRestartData<float>("PRESSURE", rstep, 0);
+
+    std::vector<std::size_t> cells;
+
+    for (std::size_t cell = 0; cell < nActive; cell++) {
+        const auto i = iIndex(cell);
+        const auto p = pressure[cell];
+
+        if ((fipnum(cell) >= 3) || (i <= 1) || (i >= 10))
+            continue;
+
+        if ((p <= bounds.low) || (p >= bounds.high) || (ntg(cell) <= 0.5f))
+            continue;
+
+        cells.push_back(cell);
+    }
+
+    return cells;
+}
+
+std::vector<std::size_t> maskCells(const EModel::CellMask& mask)
+{
+    std::vector<std::size_t> cells;
+
+    for (std::size_t w = 0; w < mask.size(); w++) {
+        for (std::size_t bit = 0; bit < 64; bit++) {
+            if ((mask[w] >> bit) & 1)
+                cells.push_back(w * 64 + bit);
+        }
+    }
+
+    return cells;
+}
+
+std::vector<int> iIndices(const std::vector<std::size_t>& cells)
+{
+    std::vector<int> indices;
+
+    for (const auto cell : cells)
+        indices.push_back(iIndex(cell));
+
+    return indices;
+}
+
+// Checks the cells selected by the active filter of model.
+void checkFiltered(EModel& model, const std::vector<std::size_t>& reference)
+{
+    BOOST_CHECK_EQUAL(model.getNumberOfActiveCells(), static_cast<int>(reference.size()));
+
+    const auto& i = model.getParam<int>("I");
+    const auto iRef = iIndices(reference);
+    BOOST_CHECK_EQUAL_COLLECTIONS(i.begin(), i.end(), iRef.begin(), iRef.end());
+
+    const auto& ntgValues = model.getParam<float>("NTG");
+    BOOST_CHECK_EQUAL(ntgValues.size(), reference.size());
+
+    const auto numUndefined = std::ranges::count_if(reference, [](const auto cell)
+                                                    { return std::isnan(ntg(cell)); });
+    BOOST_CHECK_EQUAL(std::ranges::count_if(ntgValues, [](const float v) { return std::isnan(v); }),
+                      numUndefined);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(FilterChains)
+{
+    WorkArea work;
+    work.copyIn(rstFile);
+    writeInitFile();
+
+    EModel model("SPE1_TESTCASE.INIT");
+
+    const auto rstep = model.getActiveReportStep();
+    const auto bounds = pressureBounds(rstep);
+    const auto reference = referenceCells(rstep, bounds);
+
+    BOOST_CHECK(!reference.empty());
+    BOOST_CHECK(std::ranges::any_of(reference, [](const auto cell) { return std::isnan(ntg(cell)); }));
+
+    // Bits beyond the last cell are never set.
+    const auto all = model.evaluateFilter(EModel::FilterPipeline{});
+    BOOST_CHECK_EQUAL(all.size(), (nActive + 63) / 64);
+    BOOST_CHECK_EQUAL(EModel::countCells(all), nActive);
+    BOOST_CHECK_EQUAL(model.getNumberOfActiveCells(), static_cast<int>(nActive));
+
+    // One criterion at a time.
+    addFilterChain(model, bounds);
+    checkFiltered(model, reference);
+
+    // All criteria in one pass.
+    model.resetFilter();
+    BOOST_CHECK_EQUAL(model.getNumberOfActiveCells(), static_cast<int>(nActive));
+
+    model.addFilter(pipeline(bounds));
+    checkFiltered(model, reference);
+
+    const auto mask = model.evaluateFilter(pipeline(bounds));
+    const auto cells = maskCells(mask);
+    BOOST_CHECK_EQUAL_COLLECTIONS(cells.begin(), cells.end(), reference.begin(), reference.end());
+}
+
+BOOST_AUTO_TEST_CASE(FilterReportSteps)
+{
+    WorkArea work;
+    work.copyIn(rstFile);
+    writeInitFile();
+
+    EModel model("SPE1_TESTCASE.INIT");
+
+    const std::vector<int> rsteps = {1, 5, 25, 120};
+    const auto bounds = pressureBounds(5);
+    const auto filter = pipeline(bounds);
+
+    model.setReportStep(5);
+    const auto* pressure = model.getParam<float>("PRESSURE").data();
+
+    const auto masks = model.evaluateFilter(filter, rsteps);
+    BOOST_REQUIRE_EQUAL(masks.size(), rsteps.size());
+
+    // The arrays of the active report step are still loaded.
+    BOOST_CHECK_EQUAL(model.getActiveReportStep(), 5);
+    BOOST_CHECK(model.getParam<float>("PRESSURE").data() == pressure);
+
+    for (std::size_t n = 0; n < rsteps.size(); n++) {
+        BOOST_TEST_MESSAGE("Report step " << rsteps[n]);
+
+        const auto reference = referenceCells(rsteps[n], bounds);
+        const auto cells = maskCells(masks[n]);
+        BOOST_CHECK_EQUAL_COLLECTIONS(cells.begin(), cells.end(), reference.begin(), reference.end());
+
+        model.setReportStep(rsteps[n]);
+        model.resetFilter();
+        model.addFilter(filter);
+
+        BOOST_CHECK_EQUAL(EModel::countCells(masks[n]),
+                          static_cast<std::size_t>(model.getNumberOfActiveCells()));
+        checkFiltered(model, reference);
+    }
+
+    BOOST_CHECK_THROW(model.evaluateFilter(filter, {1, 3}), std::invalid_argument);
+}
@@ -190,6 +190,21 @@ BOOST_AUTO_TEST_CASE(TestERst_1) {
     BOOST_CHECK_EQUAL(ref_logih_25==vect4, true);
     BOOST_CHECK_EQUAL(ref_zwel_25==vect5, true);
 
+    // loading a report step again keeps the arrays already loaded
+    const auto& pres25 = rst1.getRestartData<float>("PRESSURE",25, 0);
+    const auto* pres25Data = pres25.data();
+    rst1.loadReportStepNumber(25);
+
+    BOOST_CHECK(rst1.getRestartData<float>("PRESSURE",25, 0).data() == pres25Data);
+    BOOST_REQUIRE_CLOSE (calcSum(pres25), 1.92496e+06, 1e-3);
+
+    // released arrays are read again on demand
+    rst1.unloadReportStepNumber(25);
+
+    vect2 = rst1.getRestartData<float>("PRESSURE",25, 0);
+    BOOST_REQUIRE_CLOSE (calcSum(vect2), 1.92496e+06, 1e-3);
+
+    BOOST_CHECK_THROW(rst1.unloadReportStepNumber(4) , std::invalid_argument );
 }
 
 namespace {
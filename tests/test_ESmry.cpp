@@ -24,6 +24,7 @@
 #include <opm/io/eclipse/ESmry.hpp>
 
 #include <opm/common/utility/FileSystem.hpp>
+#include <opm/common/utility/shmatch.hpp>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
@@ -364,6 +365,33 @@ BOOST_AUTO_TEST_CASE(TestESmry_4) {
 
 }
 
+BOOST_AUTO_TEST_CASE(TestESmry_keys) {
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+
+    const auto& keys = smry1.keywordList();
+    BOOST_CHECK(std::ranges::is_sorted(keys));
+
+    BOOST_CHECK(smry1.hasKey("WBHP:PROD"));
+    BOOST_CHECK(!smry1.hasKey("WBHP:XXX"));
+
+    const auto handle = smry1.handle("WBHP:PROD");
+    BOOST_CHECK(smry1.get(handle) == smry1.get("WBHP:PROD"));
+    BOOST_CHECK(smry1.get_at_rstep(handle) == smry1.get_at_rstep("WBHP:PROD"));
+
+    BOOST_CHECK_THROW(smry1.handle("WBHP:XXX"), std::invalid_argument);
+
+    for (const std::string pattern : {"W*", "WBHP:*", "WBHP:P*", "*:INJ", "BPR:1,1,?", "F[GO]*", "WBHP:PROD", "XXX*"}) {
+        std::vector<std::string> ref;
+        std::ranges::copy_if(keys, std::back_inserter(ref),
+                             [&pattern](const auto& key) { return Opm::shmatch(pattern, key); });
+
+        BOOST_CHECK_MESSAGE(smry1.keywordList(pattern) == ref, "Pattern " << pattern);
+    }
+
+    BOOST_CHECK_EQUAL(smry1.keywordList("WBHP:*").size(), 2U);
+}
+
 BOOST_AUTO_TEST_CASE(TestESmry_5) {
 
     // file MODEL1_IX.SMSPEC and MODEL1_IX.UNSMRY are output from comercial simulator ix with
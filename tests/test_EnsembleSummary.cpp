@@ -0,0 +1,163 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE Test EnsembleSummary
+#include <boost/test/unit_test.hpp>
+
+#include <opm/io/eclipse/EnsembleSummary.hpp>
+
+#include <opm/io/eclipse/ESmry.hpp>
+#include <opm/io/eclipse/ExtESmry.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <vector>
+
+using namespace Opm::EclIO;
+
+namespace {
+
+const std::vector<std::string> caseFiles = {
+    "SPE1CASE1.SMSPEC",
+    "SPE1CASE1A.SMSPEC",
+    "SPE1CASE1_RST60.ESMRY",
+};
+
+const std::vector<float>& reference(std::size_t caseIdx, const std::string& key)
+{
+    static ESmry smry0(caseFiles[0]);
+    static ESmry smry1(caseFiles[1]);
+    static ExtESmry smry2(caseFiles[2]);
+
+    if (caseIdx == 0)
+        return smry0.get(key);
+    else if (caseIdx == 1)
+        return smry1.get(key);
+    else
+        return smry2.get(key);
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(TestEnsembleSummary_get) {
+
+    const EnsembleSummary ensemble(caseFiles, 2);
+
+    BOOST_CHECK_EQUAL(ensemble.numberOfCases(), 3U);
+
+    const std::vector<std::string> keys = {"TIME", "WBHP:PROD", "XXX:YYY"};
+    const auto data = ensemble.get(keys);
+
+    BOOST_CHECK_EQUAL(data.numCases, 3U);
+    BOOST_CHECK_EQUAL(data.numVectors, 3U);
+
+    std::size_t numTimes = 0;
+    for (std::size_t c = 0; c < data.numCases; c++)
+        numTimes = std::max(numTimes, ensemble.numberOfTimeSteps(c));
+
+    BOOST_CHECK_EQUAL(data.numTimes, numTimes);
+
+    for (std::size_t c = 0; c < data.numCases; c++) {
+        for (std::size_t v = 0; v < 2; v++) {
+            const auto& ref = reference(c, keys[v]);
+
+            BOOST_REQUIRE_EQUAL(ref.size(), ensemble.numberOfTimeSteps(c));
+
+            for (std::size_t t = 0; t < ref.size(); t++)
+                BOOST_CHECK_EQUAL(data(c, t, v), ref[t]);
+
+            // padding after end of case
+            for (std::size_t t = ref.size(); t < data.numTimes; t++)
+                BOOST_CHECK(std::isnan(data(c, t, v)));
+        }
+
+        // missing vector
+        BOOST_CHECK(!ensemble.hasKey(c, keys[2]));
+
+        for (std::size_t t = 0; t < data.numTimes; t++)
+            BOOST_CHECK(std::isnan(data(c, t, 2)));
+    }
+
+    // Same result whatever the number of threads.
+    const auto data1 = EnsembleSummary(caseFiles, 1).get(keys);
+
+    BOOST_CHECK_EQUAL(data1.numTimes, data.numTimes);
+
+    for (std::size_t i = 0; i < data.values.size(); i++) {
+        if (std::isnan(data.values[i]))
+            BOOST_CHECK(std::isnan(data1.values[i]));
+        else
+            BOOST_CHECK_EQUAL(data1.values[i], data.values[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEnsembleSummary_interpolate) {
+
+    const EnsembleSummary ensemble(caseFiles);
+
+    const auto dates = ensemble.dates(0);
+
+    const auto data = ensemble.get({"TIME", "WBHP:PROD"},
+                                   { dates[10],
+                                     dates[10] + (dates[11] - dates[10]) / 2,
+                                     dates.front() - std::chrono::hours(24),
+                                     dates.back() + std::chrono::hours(24),
+                                     dates.front(),
+                                     dates.back() });
+
+    BOOST_CHECK_EQUAL(data.numTimes, 6U);
+
+    const auto& time = reference(0, "TIME");
+    const auto& wbhp = reference(0, "WBHP:PROD");
+
+    BOOST_CHECK_CLOSE(data(0, 0, 0), time[10], 1e-5);
+    BOOST_CHECK_CLOSE(data(0, 0, 1), wbhp[10], 1e-5);
+
+    BOOST_CHECK_CLOSE(data(0, 1, 0), (time[10] + time[11]) / 2, 1e-5);
+    BOOST_CHECK_CLOSE(data(0, 1, 1), (wbhp[10] + wbhp[11]) / 2, 1e-5);
+
+    // outside time span of case
+    BOOST_CHECK(std::isnan(data(0, 2, 0)));
+    BOOST_CHECK(std::isnan(data(0, 3, 1)));
+
+    // first and last date of case
+    BOOST_CHECK_EQUAL(data(0, 4, 0), time.front());
+    BOOST_CHECK_EQUAL(data(0, 4, 1), wbhp.front());
+    BOOST_CHECK_EQUAL(data(0, 5, 0), time.back());
+    BOOST_CHECK_EQUAL(data(0, 5, 1), wbhp.back());
+
+    for (std::size_t c = 0; c < caseFiles.size(); c++) {
+        const auto caseDates = ensemble.dates(c);
+        const auto endpoints = ensemble.get({"TIME"}, {caseDates.front(), caseDates.back()});
+
+        BOOST_CHECK_EQUAL(endpoints(c, 0, 0), reference(c, "TIME").front());
+        BOOST_CHECK_EQUAL(endpoints(c, 1, 0), reference(c, "TIME").back());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEnsembleSummary_missing_case) {
+
+    BOOST_CHECK_THROW(EnsembleSummary({"SPE1CASE1.SMSPEC", "NO_SUCH_CASE.SMSPEC"}, 2),
+                      std::exception);
+}
@@ -23,6 +23,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <opm/common/OpmLog/AsyncLogBackend.hpp>
 #include <opm/common/OpmLog/CounterLog.hpp>
 #include <opm/common/OpmLog/KeywordLocation.hpp>
 #include <opm/common/OpmLog/LogBackend.hpp>
@@ -36,6 +37,9 @@
 #include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace Opm;
 
@@ -425,3 +429,87 @@ BOOST_AUTO_TEST_CASE(TestFormat)
     BOOST_CHECK_EQUAL(log_stream2.str(), expected2);
     BOOST_CHECK_EQUAL(log_stream3.str(), expected3);
 }
+
+BOOST_AUTO_TEST_CASE(TestAsyncLogBackend)
+{
+    OpmLog::removeAllBackends();
+
+    const int numThreads = 4;
+    const int numMessages = 500;
+
+    std::ostringstream log_stream;
+    {
+        auto streamLog = std::make_shared<StreamLog>(log_stream, Log::DefaultMessageTypes);
+        streamLog->setMessageFormatter(std::make_shared<SimpleMessageFormatter>(false));
+        OpmLog::addBackend("ASYNC", std::make_shared<AsyncLogBackend>(streamLog, 64));
+    }
+
+    {
+        auto threads = std::vector<std::thread>{};
+        for (int t = 0; t < numThreads; ++t) {
+            threads.emplace_back([t]()
+            {
+                for (int i = 0; i < numMessages; ++i) {
+                    OpmLog::info(std::to_string(t) + " " + std::to_string(i));
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    const auto dropped = OpmLog::getBackend<AsyncLogBackend>("ASYNC")->numDropped();
+
+    // Removing the backend outputs all pending messages.
+    OpmLog::removeAllBackends();
+
+    auto next = std::vector<int>(numThreads, 0);
+    auto numInfo = std::size_t{0};
+    auto numDroppedReported = std::size_t{0};
+
+    std::istringstream lines { log_stream.str() };
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        if (line.find("dropped") != std::string::npos) {
+            // "Warning: <n> log message(s) dropped ..."
+            numDroppedReported += std::stoul(line.substr(line.find(':') + 1));
+            continue;
+        }
+
+        int t = 0, i = 0;
+        std::istringstream { line } >> t >> i;
+
+        // Messages from a single thread are output in order.
+        BOOST_CHECK_GT(i + 1, next[t]);
+        next[t] = i + 1;
+        ++numInfo;
+    }
+
+    BOOST_CHECK_EQUAL(numInfo + dropped, std::size_t{numThreads * numMessages});
+    BOOST_CHECK_EQUAL(numDroppedReported, dropped);
+}
+
+BOOST_AUTO_TEST_CASE(TestAsyncLogBackendFlush)
+{
+    auto counter = std::make_shared<CounterLog>(Log::DefaultMessageTypes);
+    auto async = std::make_shared<AsyncLogBackend>(counter, 1024);
+
+    for (int i = 0; i < 100; ++i) {
+        async->addMessage(Log::MessageType::Warning, "Warning");
+    }
+    async->addMessage(Log::MessageType::Error, "Error");
+
+    async->flush();
+
+    BOOST_CHECK_EQUAL(counter->numMessages(Log::MessageType::Warning), std::size_t{100});
+    BOOST_CHECK_EQUAL(counter->numMessages(Log::MessageType::Error), std::size_t{1});
+    BOOST_CHECK_EQUAL(async->numDropped(), std::size_t{0});
+
+    BOOST_CHECK_THROW(AsyncLogBackend(nullptr), std::invalid_argument);
+}
@@ -0,0 +1,111 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE Profiler
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/Profiler.hpp>
+
+#include <opm/common/TimingMacros.hpp>  // Opm::Subsystem
+
+#include <sstream>
+#include <string>
+
+namespace {
+
+    const Opm::Profiler::Site outer { "outer", Opm::Subsystem::Output };
+    const Opm::Profiler::Site inner { "inner", Opm::Subsystem::Output };
+    const Opm::Profiler::Site solver { "solver", Opm::Subsystem::LinearSolver };
+
+    void run(const int n)
+    {
+        const Opm::Profiler::Scope scope { outer };
+
+        for (auto i = 0*n; i < n; ++i) {
+            const Opm::Profiler::Scope s1 { inner };
+            const Opm::Profiler::Scope s2 { solver };
+        }
+    }
+
+    std::string output(const Opm::Profiler::Format format)
+    {
+        std::ostringstream os;
+        Opm::Profiler::write(os, format);
+
+        return os.str();
+    }
+
+    bool contains(const std::string& s, const std::string& pattern)
+    {
+        return s.find(pattern) != std::string::npos;
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+    Opm::Profiler::enable(Opm::Subsystem::None);
+    Opm::Profiler::reset();
+
+    run(10);
+
+    BOOST_CHECK(! contains(output(Opm::Profiler::Format::Json), "outer"));
+}
+
+BOOST_AUTO_TEST_CASE(CallTree)
+{
+    Opm::Profiler::enable(Opm::Subsystem::Output);
+    Opm::Profiler::reset();
+
+    run(10);
+    run(5);
+
+    const auto json = output(Opm::Profiler::Format::Json);
+
+    BOOST_CHECK(contains(json, R"({"name": "outer", "subsystems": 16, "calls": 2,)"));
+    BOOST_CHECK(contains(json, R"({"name": "inner", "subsystems": 16, "calls": 15,)"));
+    BOOST_CHECK(! contains(json, "solver"));
+
+    // Inner scope is nested within outer scope.
+    BOOST_CHECK_LT(json.find("outer"), json.find("inner"));
+
+    const auto trace = output(Opm::Profiler::Format::ChromeTrace);
+
+    BOOST_CHECK(contains(trace, "\"traceEvents\""));
+    BOOST_CHECK(contains(trace, R"({"name": "inner", "ph": "X",)"));
+    BOOST_CHECK(contains(trace, R"("args": {"calls": 15}})"));
+
+    Opm::Profiler::enable(Opm::Subsystem::None);
+}
+
+BOOST_AUTO_TEST_CASE(SelectedSubsystems)
+{
+    Opm::Profiler::enable(Opm::Subsystem::LinearSolver);
+    Opm::Profiler::reset();
+
+    run(3);
+
+    const auto json = output(Opm::Profiler::Format::Json);
+
+    BOOST_CHECK(! contains(json, "outer"));
+    BOOST_CHECK(contains(json, R"({"name": "solver", "subsystems": 8, "calls": 3,)"));
+
+    Opm::Profiler::enable(Opm::Subsystem::None);
+}
@@ -332,3 +332,47 @@ END
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(Connection_Slot_Index)
+{
+    const auto  deck     = summaryDeck();
+    const auto  es       = Opm::EclipseState { deck };
+    const auto  schedule = Opm::Schedule { deck, es, std::make_shared<Opm::Python>() };
+    const auto& grid     = es.getInputGrid();
+
+    const auto regCache = Opm::out::RegionCache {
+        {"FIPNUM"}, es.fieldProps(), grid, schedule
+    };
+
+    BOOST_CHECK_MESSAGE(regCache.slotIndex("FIPXYZ") == nullptr,
+                        "There must be no slot index for unknown region set FIPXYZ");
+    BOOST_CHECK_MESSAGE(regCache.regionSlots("FIPNUM", 100).empty(),
+                        "There must be no connection slots for FIPNUM=100");
+
+    const auto* index = regCache.slotIndex("FIPNUM");
+    BOOST_REQUIRE_MESSAGE(index != nullptr, "There must be a slot index for FIPNUM");
+
+    const auto& slots = regCache.connectionSlots();
+    BOOST_CHECK_EQUAL(index->slot_region.size(), slots.size());
+    BOOST_CHECK_EQUAL(index->slots.size(), slots.size());
+    BOOST_REQUIRE_EQUAL(index->start.size(), index->regions.size() + 1);
+
+    // Every region's slots must reproduce connections() exactly, including
+    // order, and every slot must belong to exactly one region.
+    auto numSlots = std::size_t{0};
+    for (auto i = 0*index->regions.size(); i < index->regions.size(); ++i) {
+        const auto regSlots = regCache.regionSlots("FIPNUM", index->regions[i]);
+        const auto& conns = regCache.connections("FIPNUM", index->regions[i]);
+
+        BOOST_REQUIRE_EQUAL(regSlots.size(), conns.size());
+        for (auto j = 0*conns.size(); j < conns.size(); ++j) {
+            BOOST_CHECK_EQUAL(slots[regSlots[j]].first, conns[j].first);
+            BOOST_CHECK_EQUAL(slots[regSlots[j]].second, conns[j].second);
+            BOOST_CHECK_EQUAL(index->slot_region[regSlots[j]], i);
+        }
+
+        numSlots += regSlots.size();
+    }
+
+    BOOST_CHECK_EQUAL(numSlots, slots.size());
+}